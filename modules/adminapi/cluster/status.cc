@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "modules/adminapi/cluster/api_options.h"
 #include "modules/adminapi/cluster_set/cluster_set_impl.h"
@@ -262,7 +263,7 @@ Status::Member_stats_map Status::query_member_stats() {
 
   if (group_instance) {
     try {
-      auto member_stats = group_instance->query(
+      auto member_stats = group_instance->query_prepared(
           "SELECT * FROM performance_schema.replication_group_member_stats");
 
       while (auto row = member_stats->fetch_one_named()) {
@@ -515,7 +516,7 @@ void Status::collect_basic_local_status(shcore::Dictionary_t dict,
         }
       }
     } else {
-      auto result = instance.query(k_calculate_lag_query);
+      auto result = instance.query_prepared(k_calculate_lag_query);
       auto row = result->fetch_one_named();
       if (row) {
         std::string lag = row.get_string("cluster_member_lag", "");
@@ -578,22 +579,8 @@ void Status::collect_local_status(shcore::Dictionary_t dict,
   }
   sql += " FROM performance_schema.replication_applier_status_by_worker";
 
-  // this can return multiple rows per channel for
-  // multi-threaded applier, otherwise just one. If MT, we also
-  // get stuff in the coordinator table
-  auto result = instance.query(sql);
-  auto row = result->fetch_one_named();
-  while (row) {
-    std::string channel_name = row.get_string("CHANNEL_NAME");
-    if (channel_name == "group_replication_recovery") {
-      recovery_workers->push_back(applier_status(row));
-    }
-    if (channel_name == "group_replication_applier" &&
-        row.get_string("SERVICE_STATE") != "OFF") {
-      applier_workers->push_back(applier_status(row));
-    }
-    row = result->fetch_one_named();
-  }
+  std::vector<std::string> queries;
+  queries.emplace_back(std::move(sql));
 
   sql = "SELECT *";
   if (version >= Version(8, 0, 0)) {
@@ -614,19 +601,7 @@ void Status::collect_local_status(shcore::Dictionary_t dict,
     sql += " AS CURRENT_IMMEDIATE_COMMIT_TO_NOW_TIME";
   }
   sql += " FROM performance_schema.replication_applier_status_by_coordinator";
-  result = instance.query(sql);
-  row = result->fetch_one_named();
-  while (row) {
-    std::string channel_name = row.get_string("CHANNEL_NAME");
-    if (channel_name == "group_replication_recovery") {
-      (*recovery_node)["coordinator"] = coordinator_status(row);
-    }
-    if (channel_name == "group_replication_applier" &&
-        row.get_string("SERVICE_STATE") != "OFF") {
-      (*applier_node)["coordinator"] = coordinator_status(row);
-    }
-    row = result->fetch_one_named();
-  }
+  queries.emplace_back(std::move(sql));
 
   sql = "SELECT *";
   if (version >= Version(8, 0, 0)) {
@@ -647,19 +622,64 @@ void Status::collect_local_status(shcore::Dictionary_t dict,
     sql += " AS CURRENT_IMMEDIATE_COMMIT_TO_NOW_TIME";
   }
   sql += " FROM performance_schema.replication_connection_status";
-  result = instance.query(sql);
-  row = result->fetch_one_named();
-  while (row) {
-    std::string channel_name = row.get_string("CHANNEL_NAME");
-    if (channel_name == "group_replication_recovery") {
-      (*recovery_node)["connection"] = connection_status(row);
-    }
-    if (channel_name == "group_replication_applier" &&
-        row.get_string("SERVICE_STATE") != "OFF") {
-      (*applier_node)["connection"] = connection_status(row);
+  queries.emplace_back(std::move(sql));
+
+  // all the queries are sent in a single round-trip
+  instance.query_batch(queries, [&](std::size_t index,
+                                    mysqlshdk::db::IResult *result) {
+    switch (index) {
+      case 0: {
+        // this can return multiple rows per channel for
+        // multi-threaded applier, otherwise just one. If MT, we also
+        // get stuff in the coordinator table
+        auto row = result->fetch_one_named();
+        while (row) {
+          std::string channel_name = row.get_string("CHANNEL_NAME");
+          if (channel_name == "group_replication_recovery") {
+            recovery_workers->push_back(applier_status(row));
+          }
+          if (channel_name == "group_replication_applier" &&
+              row.get_string("SERVICE_STATE") != "OFF") {
+            applier_workers->push_back(applier_status(row));
+          }
+          row = result->fetch_one_named();
+        }
+        break;
+      }
+
+      case 1: {
+        auto row = result->fetch_one_named();
+        while (row) {
+          std::string channel_name = row.get_string("CHANNEL_NAME");
+          if (channel_name == "group_replication_recovery") {
+            (*recovery_node)["coordinator"] = coordinator_status(row);
+          }
+          if (channel_name == "group_replication_applier" &&
+              row.get_string("SERVICE_STATE") != "OFF") {
+            (*applier_node)["coordinator"] = coordinator_status(row);
+          }
+          row = result->fetch_one_named();
+        }
+        break;
+      }
+
+      case 2: {
+        auto row = result->fetch_one_named();
+        while (row) {
+          std::string channel_name = row.get_string("CHANNEL_NAME");
+          if (channel_name == "group_replication_recovery") {
+            (*recovery_node)["connection"] = connection_status(row);
+          }
+          if (channel_name == "group_replication_applier" &&
+              row.get_string("SERVICE_STATE") != "OFF") {
+            (*applier_node)["connection"] = connection_status(row);
+          }
+          row = result->fetch_one_named();
+        }
+        break;
+      }
     }
-    row = result->fetch_one_named();
-  }
+  });
 
   if (!applier_workers->empty()) {
     (*applier_node)["workers"] = shcore::Value(applier_workers);
@@ -1537,6 +1557,16 @@ shcore::Dictionary_t Status::get_topology(
     Parallel_applier_options parallel_applier_options;
 
     if (instance) {
+      // Read the variables used below, together with the parallel-applier
+      // ones, using a single query.
+      auto sysvar_names =
+          Parallel_applier_options::sysvar_names(instance->get_version());
+      sysvar_names.emplace_back("super_read_only");
+      sysvar_names.emplace_back("offline_mode");
+
+      mysqlshdk::mysql::Scoped_sysvar_snapshot sysvars{*instance,
+                                                       sysvar_names};
+
       // Get the current parallel-applier options
       parallel_applier_options = Parallel_applier_options(*instance);
 
@@ -508,6 +508,17 @@ void Group_replication_options::read_option_values(
     const mysqlshdk::mysql::IInstance &instance, bool switching_comm_stack) {
   mysqlshdk::utils::Version version = instance.get_version();
 
+  // read all the variables which may be needed below at once
+  mysqlshdk::mysql::Scoped_sysvar_snapshot sysvars{
+      instance,
+      {"group_replication_group_name", "group_replication_ssl_mode",
+       "group_replication_group_seeds", "group_replication_ip_whitelist",
+       "group_replication_ip_allowlist", "group_replication_local_address",
+       "group_replication_member_weight",
+       "group_replication_exit_state_action",
+       "group_replication_member_expel_timeout",
+       "group_replication_consistency", "group_replication_autorejoin_tries"}};
+
   if (!group_name.has_value()) {
     group_name = instance.get_sysvar_string("group_replication_group_name");
   }
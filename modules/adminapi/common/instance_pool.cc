@@ -25,6 +25,7 @@
 
 #include <errmsg.h>
 #include <mysql.h>
+#include <mysqld_error.h>
 #include <stack>
 
 #include "modules/adminapi/common/dba_errors.h"
@@ -36,6 +37,7 @@
 #include "mysqlshdk/include/scripting/types.h"  // exceptions
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/debug.h"
 
@@ -53,6 +55,10 @@ constexpr const char *k_default_sql_mode =
 constexpr char k_lock[] = "AdminAPI_lock";
 constexpr char k_lock_name_instance[] = "AdminAPI_instance";
 
+// Maximum number of statements prepared on a single session, server limits
+// the total number of prepared statements with max_prepared_stmt_count.
+constexpr std::size_t k_max_prepared_statements = 32;
+
 int64_t default_adminapi_connect_timeout() {
   return mysqlsh::current_shell_options()->get().dba_connect_timeout * 1000;
 }
@@ -224,6 +230,146 @@ void Instance::execute(const std::string &sql) const {
   mysqlshdk::mysql::Instance::execute(sql);
 }
 
+bool Instance::supports_batching() const {
+  // only available in sessions using the classic protocol which are actually
+  // connected to a server (i.e. replayed sessions don't have a handle)
+  const auto session =
+      std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(get_session());
+
+  if (!session || !session->is_open() || !session->get_handle()) {
+    return false;
+  }
+
+  if (session->get_connection_id() != m_prepared_statements_connection_id) {
+    // session was reconnected, prepared statements are gone
+    reset_statement_cache();
+  }
+
+  return true;
+}
+
+void Instance::reset_statement_cache() const {
+  m_prepared_statements.clear();
+  m_prepared_statements_connection_id = get_session()->get_connection_id();
+}
+
+std::shared_ptr<mysqlshdk::db::IResult> Instance::query_prepared(
+    const std::string &sql, bool buffered) const {
+  if (!supports_batching()) return query(sql, buffered);
+
+  auto it = m_prepared_statements.find(sql);
+
+  if (m_prepared_statements.end() == it) {
+    if (m_prepared_statements.size() >= k_max_prepared_statements) {
+      for (const auto &stmt : m_prepared_statements) {
+        execute("DEALLOCATE PREPARE " + stmt.second);
+      }
+
+      m_prepared_statements.clear();
+    }
+
+    // a prepared statement cannot be terminated with a delimiter
+    const auto stmt = shcore::str_rstrip(sql, " \r\n\t;");
+    auto name = "mysqlsh_stmt_" + std::to_string(++m_next_statement_id);
+
+    execute("PREPARE " + name + " FROM " + shcore::quote_sql_string(stmt));
+
+    it = m_prepared_statements.emplace(sql, std::move(name)).first;
+  }
+
+  try {
+    return query("EXECUTE " + it->second, buffered);
+  } catch (const mysqlshdk::db::Error &e) {
+    if (ER_UNKNOWN_STMT_HANDLER != e.code()) throw;
+
+    // statement was deallocated by someone else (i.e. RESET CONNECTION), it
+    // will be prepared again the next time
+    log_debug("Prepared statement %s is gone on %s", it->second.c_str(),
+              descr().c_str());
+    m_prepared_statements.erase(it);
+
+    return query(sql, buffered);
+  }
+}
+
+void Instance::query_batch(
+    const std::vector<std::string> &queries,
+    const std::function<void(std::size_t, mysqlshdk::db::IResult *)> &handler)
+    const {
+  const auto execute_one_by_one = [&]() {
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      handler(i, query(queries[i], true).get());
+    }
+  };
+
+  if (queries.size() < 2 || !supports_batching()) {
+    execute_one_by_one();
+    return;
+  }
+
+  const auto session =
+      std::static_pointer_cast<mysqlshdk::db::mysql::Session>(get_session());
+
+  if (mysql_set_server_option(session->get_handle(),
+                              MYSQL_OPTION_MULTI_STATEMENTS_ON)) {
+    log_debug("Unable to enable multi-statements on %s: %s", descr().c_str(),
+              mysql_error(session->get_handle()));
+    execute_one_by_one();
+    return;
+  }
+
+  // indexes of the queries which reported warnings before the last result
+  std::vector<std::size_t> with_warnings;
+
+  {
+    std::shared_ptr<mysqlshdk::db::IResult> result;
+
+    shcore::on_leave_scope restore_multi_statements([&]() {
+      try {
+        // all the results need to be consumed before the option can be
+        // changed (i.e. handler has thrown)
+        while (result && result->next_resultset()) {
+        }
+      } catch (const std::exception &e) {
+        log_debug("Error while discarding results of a batch on %s: %s",
+                  descr().c_str(), e.what());
+      }
+
+      if (mysql_set_server_option(session->get_handle(),
+                                  MYSQL_OPTION_MULTI_STATEMENTS_OFF)) {
+        log_warning("Unable to disable multi-statements on %s: %s",
+                    descr().c_str(), mysql_error(session->get_handle()));
+      }
+    });
+
+    // results need to be buffered, as the handler may not read all the rows
+    result = session->query(shcore::str_join(queries, ";\n"), true);
+    std::size_t index = 0;
+
+    do {
+      if (index >= queries.size()) {
+        throw std::logic_error("Unexpected number of results in a batch");
+      }
+
+      if (index + 1 < queries.size() && result->get_warning_count()) {
+        with_warnings.emplace_back(index);
+      }
+
+      handler(index++, result.get());
+    } while (result->next_resultset());
+
+    // all results were read, warnings of the last query can be fetched now
+    process_result_warnings(queries[index - 1], *result);
+  }
+
+  // warnings of the remaining queries were replaced by the ones generated by
+  // the subsequent queries, they are reported by executing these queries once
+  // again, this is rare, as only read-only queries are batched
+  for (const auto index : with_warnings) {
+    query(queries[index], true);
+  }
+}
+
 bool Instance::ensure_lock_service_is_installed(bool can_disable_sro) {
   if (is_lock_service_installed()) return true;
 
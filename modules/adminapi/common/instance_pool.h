@@ -24,10 +24,13 @@
 #ifndef MODULES_ADMINAPI_COMMON_INSTANCE_POOL_H_
 #define MODULES_ADMINAPI_COMMON_INSTANCE_POOL_H_
 
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/adminapi/common/cluster_types.h"
@@ -95,6 +98,46 @@ class Instance final : public mysqlshdk::mysql::Instance {
 
   void execute(const std::string &sql) const override;
 
+  /**
+   * Executes a query through a server-side prepared statement.
+   *
+   * The statement is prepared the first time the given SQL is seen and is
+   * kept for as long as the session stays open, so queries which are issued
+   * repeatedly (i.e. the ones used to check the state of the members) are
+   * parsed only once by the server. The cache is tied to the connection ID,
+   * so it's discarded if the session is reconnected.
+   *
+   * Falls back to a regular query if the session does not support it.
+   *
+   * @param sql query to execute, it must not have any placeholders
+   * @param buffered true if the result should be buffered
+   *
+   * @return result of the query
+   */
+  std::shared_ptr<mysqlshdk::db::IResult> query_prepared(
+      const std::string &sql, bool buffered = false) const;
+
+  /**
+   * Executes all the given queries in a single round-trip.
+   *
+   * The handler is called once for each query, in order, with its index and
+   * its result, which is valid only for the duration of the call.
+   *
+   * Multi-statements are enabled only for the duration of the call. Warnings
+   * are reported to the registered callback, just like for regular queries.
+   *
+   * Falls back to executing the queries one by one if the session does not
+   * support it.
+   *
+   * @param queries read-only queries to execute, each one must hold a single
+   *                statement
+   * @param handler callback which consumes the results
+   */
+  void query_batch(
+      const std::vector<std::string> &queries,
+      const std::function<void(std::size_t, mysqlshdk::db::IResult *)>
+          &handler) const;
+
   void prepare_session();
 
   void reconnect_if_needed(const char *what);
@@ -169,6 +212,15 @@ class Instance final : public mysqlshdk::mysql::Instance {
 
   [[nodiscard]] mysqlshdk::mysql::Lock_scoped get_lock(
       mysqlshdk::mysql::Lock_mode mode, std::chrono::seconds timeout = {});
+
+  bool supports_batching() const;
+
+  void reset_statement_cache() const;
+
+  // maps SQL to the name of the prepared statement
+  mutable std::unordered_map<std::string, std::string> m_prepared_statements;
+  mutable uint64_t m_prepared_statements_connection_id = 0;
+  mutable uint32_t m_next_statement_id = 0;
 };
 
 class Scoped_instance_list final {
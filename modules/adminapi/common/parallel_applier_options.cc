@@ -34,6 +34,11 @@ void Parallel_applier_options::read_option_values(
     const mysqlshdk::mysql::IInstance &instance) {
   mysqlshdk::utils::Version version = instance.get_version();
 
+  // read all the variables which may be needed below at once, this does not
+  // query the server if caller has already taken a snapshot of them
+  mysqlshdk::mysql::Scoped_sysvar_snapshot sysvars{instance,
+                                                   sysvar_names(version)};
+
   if (!binlog_transaction_dependency_tracking.has_value()) {
     binlog_transaction_dependency_tracking =
         instance.get_sysvar_string(kBinlogTransactionDependencyTracking);
@@ -64,6 +69,17 @@ void Parallel_applier_options::read_option_values(
   }
 }
 
+std::vector<std::string> Parallel_applier_options::sysvar_names(
+    const mysqlshdk::utils::Version &version) {
+  return {kBinlogTransactionDependencyTracking, kTransactionWriteSetExtraction,
+          mysqlshdk::mysql::get_replication_option_keyword(
+              version, kReplicaPreserveCommitOrder),
+          mysqlshdk::mysql::get_replication_option_keyword(
+              version, kReplicaParallelType),
+          mysqlshdk::mysql::get_replication_option_keyword(
+              version, kReplicaParallelWorkers)};
+}
+
 std::vector<std::tuple<std::string, std::string>>
 Parallel_applier_options::get_required_values(
     const mysqlshdk::utils::Version &version,
@@ -76,6 +76,17 @@ struct Parallel_applier_options {
   std::map<std::string, std::optional<std::string>> get_current_settings(
       const mysqlshdk::utils::Version &version) const;
 
+  /**
+   * Get the names of the system variables read by this class, i.e. to include
+   * them in a Scoped_sysvar_snapshot taken by the caller.
+   *
+   * @param version version of the target instance
+   *
+   * @return a list of system variable names
+   */
+  static std::vector<std::string> sysvar_names(
+      const mysqlshdk::utils::Version &version);
+
   std::optional<std::string> binlog_transaction_dependency_tracking;
   std::optional<std::string> replica_preserve_commit_order;
   std::optional<std::string> replica_parallel_type;
@@ -158,7 +158,7 @@ Default is 0.
 @li ssh.configFile string path default empty, custom path for SSH configuration.
 If not defined the standard SSH paths will be used (~/.ssh/config).
 
-@li ssh.bufferSize integer default 10240 bytes, used for tunnel data transfer
+@li ssh.bufferSize integer default 65536 bytes, used for tunnel data transfer
 
 The resultFormat option supports the following values to modify the
 format of printed query results:
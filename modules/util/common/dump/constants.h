@@ -54,6 +54,13 @@ constexpr inline std::array k_mhs_excluded_schemas = {
     "mysql_firewall",
 };
 
+// algorithm used to compute checksums of the data files
+constexpr inline char k_data_checksum_algorithm[] = "xxh64";
+
+// contents of all schema and table metadata files, written once dump is
+// complete, allows to fetch all metadata using a single request
+constexpr inline char k_metadata_snapshot_file[] = "@.metadata.json";
+
 }  // namespace common
 }  // namespace dump
 }  // namespace mysqlsh
@@ -24,6 +24,7 @@
 #include "modules/util/common/dump/utils.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "modules/util/dump/dump_manifest_config.h"
@@ -39,6 +40,7 @@ namespace {
 
 constexpr auto k_sql_ext = ".sql";
 constexpr auto k_separator = "@";
+constexpr std::string_view k_ddl_prefix = "@.ddl.";
 
 // Byte-values that are reserved and must be hex-encoded [0..255]
 // clang-format off
@@ -128,6 +130,14 @@ std::string get_table_data_filename(const std::string &basename,
          std::to_string(index) + "." + ext;
 }
 
+std::string get_ddl_filename(const std::string &hash) {
+  return std::string{k_ddl_prefix} + hash + k_sql_ext;
+}
+
+bool is_ddl_filename(std::string_view name) {
+  return shcore::str_beginswith(name, k_ddl_prefix);
+}
+
 void parse_schema_and_object(const std::string &str, const std::string &context,
                              const std::string &object_type,
                              std::string *out_schema, std::string *out_table) {
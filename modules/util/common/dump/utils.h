@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "mysqlshdk/libs/oci/oci_par.h"
@@ -61,6 +62,12 @@ std::string get_table_data_filename(const std::string &basename,
                                     const std::string &ext, size_t index,
                                     bool last_chunk);
 
+// Name of a file holding DDL which is shared by multiple objects, identified by
+// the hash of its contents
+std::string get_ddl_filename(const std::string &hash);
+
+bool is_ddl_filename(std::string_view name);
+
 void parse_schema_and_object(const std::string &str, const std::string &context,
                              const std::string &object_type,
                              std::string *out_schema, std::string *out_table);
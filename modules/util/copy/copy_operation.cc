@@ -28,6 +28,8 @@
 #include <condition_variable>
 #include <exception>
 #include <mutex>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 
 #include "mysqlshdk/include/shellcore/console.h"
@@ -37,6 +39,7 @@
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_config.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/textui/textui.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -190,7 +193,7 @@ class Console_with_prefix final : public IConsole {
 
 std::pair<std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>,
           std::unique_ptr<mysqlshdk::storage::IDirectory>>
-setup_virtual_storage() {
+setup_virtual_storage(std::size_t max_memory) {
   auto config = std::make_shared<mysqlshdk::storage::in_memory::Virtual_config>(
       32 * 1024 * 1024);  // 32MB
   config->fs()->set_uses_synchronized_io([](std::string_view name) {
@@ -198,6 +201,9 @@ setup_virtual_storage() {
     // compressed and use the .tsv extension
     return shcore::str_iendswith(name, ".tsv");
   });
+  // memory of the files which are held in memory is released once they are
+  // read by the loader, writes wait until this happens
+  config->fs()->set_memory_limit(max_memory, true);
 
   auto dir = directory(config);
   dir->create();
@@ -297,8 +303,54 @@ void copy(dump::Ddl_dumper *dumper, Dump_loader *loader,
     }
   };
 
+  // Memory of the files held in memory is released only when the loader reads
+  // them. If writes are waiting for memory, memory usage does not change, and
+  // in the meantime the loader, without any work in flight, repeatedly scanned
+  // the dump and did not find anything to load, then it is waiting for files
+  // which cannot be written (i.e. it needs all metadata before it reads the DDL
+  // files which use up the memory). A slow, but progressing copy is not
+  // affected, as the loader is busy or finds new files.
+  using namespace std::chrono_literals;
+  constexpr auto k_memory_check_interval = 1s;
+  // loader rescans the in-memory dump every 50ms
+  constexpr uint64_t k_min_idle_dump_scans = 20;
+  std::size_t memory_usage = 0;
+  uint64_t stalled_since = 0;
+
   while (true) {
-    const auto s = status.pop();
+    const auto popped = status.try_pop(k_memory_check_interval);
+
+    if (!popped.has_value()) {
+      const auto fs = storage->fs();
+      const auto usage = fs->memory_usage();
+      const auto scans = loader->idle_dump_scans();
+      const auto stalled =
+          fs->is_waiting_for_memory() && usage == memory_usage && scans > 0;
+
+      memory_usage = usage;
+
+      if (!stalled || 0 == stalled_since || scans < stalled_since) {
+        // something happened since the previous check, start counting here
+        stalled_since = stalled ? scans : 0;
+        continue;
+      }
+
+      if (scans - stalled_since < k_min_idle_dump_scans) {
+        continue;
+      }
+
+      dumper->abort();
+      loader->abort();
+      set_current_exception(std::make_exception_ptr(std::runtime_error(
+          "The copy cannot continue: memory used by the copy (" +
+          mysqlshdk::utils::format_bytes(usage) +
+          ") is held by the files which are waiting to be loaded, while the "
+          "target is waiting for the files which cannot be written, the value "
+          "of the 'maxMemory' option is too low")));
+      break;
+    }
+
+    const auto s = *popped;
 
     switch (s) {
       case Status::DUMPER_DONE:
@@ -336,6 +388,10 @@ void copy(dump::Ddl_dumper *dumper, Dump_loader *loader,
     std::rethrow_exception(current_exception);
   }
 
+  current_console()->print_status(
+      "Peak memory used by the in-memory storage: " +
+      mysqlshdk::utils::format_bytes(storage->fs()->peak_memory_usage()));
+
   // show metadata at the end, making sure it doesn't disappear in the noise
   loader->show_metadata(true);
 }
@@ -25,10 +25,13 @@
 #define MODULES_UTIL_COPY_COPY_OPTIONS_H_
 
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 
 #include "modules/util/dump/ddl_dumper_options.h"
 #include "modules/util/load/load_dump_options.h"
@@ -56,9 +59,11 @@ class Copy_options {
             .template ignore<mysqlshdk::azure::Blob_storage_options>()
             .template ignore<import_table::Dialect>()
             .ignore({"backgroundThreads", "characterSet", "compression",
-                     "createInvisiblePKs", "loadData", "loadDdl", "loadUsers",
-                     "ocimds", "progressFile", "resetProgress", "showMetadata",
-                     "targetVersion", "waitDumpTimeout"})
+                     "createInvisiblePKs", "dataChecksum", "loadData",
+                     "loadDdl", "loadUsers", "ocimds", "progressFile",
+                     "resetProgress", "showMetadata", "targetVersion",
+                     "waitDumpTimeout"})
+            .optional("maxMemory", &Copy_options::set_max_memory)
             .include(&Copy_options::m_dump_options)
             .include(&Copy_options::m_load_options)
             .on_done(&Copy_options::on_unpacked_options);
@@ -69,6 +74,8 @@ class Copy_options {
   T *dump_options() { return &m_dump_options; }
   Load_dump_options *load_options() { return &m_load_options; }
 
+  std::size_t max_memory() const { return m_max_memory; }
+
  protected:
   Copy_options() {
     on_unpacked_options();
@@ -85,6 +92,9 @@ class Copy_options {
     // wait indefinitely
     m_load_options.set_dump_wait_timeout_ms(
         std::numeric_limits<uint64_t>::max());
+    // dump is written to memory, rescanning is cheap, check often, so that
+    // loader does not idle when copying many small tables
+    m_load_options.set_dump_rescan_interval_ms(50);
     // disable the progress file
     m_load_options.set_progress_file({});
     // loader can divide data into sub-chunks on the fly, as it always receives
@@ -114,8 +124,19 @@ class Copy_options {
     m_load_options.set_load_users(m_dump_options.dump_users());
   }
 
+  void set_max_memory(const std::string &value) {
+    if (value.empty()) {
+      throw std::invalid_argument(
+          "The option 'maxMemory' cannot be set to an empty string.");
+    }
+
+    m_max_memory = mysqlshdk::utils::expand_to_bytes(value);
+  }
+
   T m_dump_options;
   Load_dump_options m_load_options;
+  // memory available to the in-memory storage, 0 - unlimited
+  std::size_t m_max_memory = 0;
 };
 
 }  // namespace copy
@@ -34,6 +34,7 @@ namespace {
 using mysqlshdk::utils::Version;
 
 const std::string k_partition_awareness_capability = "partition_awareness";
+const std::string k_deduplicated_ddl_capability = "deduplicated_ddl";
 
 }  // namespace
 
@@ -41,6 +42,9 @@ std::string id(Capability capability) {
   switch (capability) {
     case Capability::PARTITION_AWARENESS:
       return k_partition_awareness_capability;
+
+    case Capability::DEDUPLICATED_DDL:
+      return k_deduplicated_ddl_capability;
   }
 
   throw std::logic_error("Should not happen");
@@ -51,6 +55,10 @@ std::string description(Capability capability) {
     case Capability::PARTITION_AWARENESS:
       return "Partition awareness - dumper treats each partition as a separate "
              "table, improving both dump and load times.";
+
+    case Capability::DEDUPLICATED_DDL:
+      return "Deduplicated DDL - tables with identical definitions share a "
+             "single DDL file, referenced from the table metadata.";
   }
 
   throw std::logic_error("Should not happen");
@@ -60,13 +68,17 @@ Version version_required(Capability capability) {
   switch (capability) {
     case Capability::PARTITION_AWARENESS:
       return Version(8, 0, 27);
+
+    case Capability::DEDUPLICATED_DDL:
+      return Version(8, 3, 0);
   }
 
   throw std::logic_error("Should not happen");
 }
 
 bool is_supported(const std::string &id) {
-  if (k_partition_awareness_capability == id) {
+  if (k_partition_awareness_capability == id ||
+      k_deduplicated_ddl_capability == id) {
     return true;
   } else {
     return false;
@@ -33,6 +33,7 @@ namespace dump {
 
 enum class Capability {
   PARTITION_AWARENESS,
+  DEDUPLICATED_DDL,
 };
 
 namespace capability {
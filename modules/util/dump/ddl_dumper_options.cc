@@ -87,6 +87,8 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .optional("where", &Ddl_dumper_options::set_where_clause)
           .optional("partitions", &Ddl_dumper_options::set_partitions)
           .optional("checksum", &Ddl_dumper_options::m_checksum)
+          .optional("dataChecksum", &Ddl_dumper_options::m_data_checksum)
+          .optional("deduplicateDdl", &Ddl_dumper_options::m_deduplicate_ddl)
           .include(&Ddl_dumper_options::m_dump_manifest_options)
           .include(&Ddl_dumper_options::m_s3_bucket_options)
           .include(&Ddl_dumper_options::m_blob_storage_options)
@@ -162,6 +164,12 @@ void Ddl_dumper_options::on_unpacked_options() {
         "The 'ddlOnly' and 'dataOnly' options cannot be both set to true.");
   }
 
+  if (m_deduplicate_ddl && m_data_only) {
+    throw std::invalid_argument(
+        "The 'deduplicateDdl' option cannot be used when the 'dataOnly' option "
+        "is set to true.");
+  }
+
   if (compatibility_options().is_set(
           Compatibility_option::CREATE_INVISIBLE_PKS) &&
       compatibility_options().is_set(
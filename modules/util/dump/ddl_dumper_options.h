@@ -86,6 +86,10 @@ class Ddl_dumper_options : public Dump_options {
 
   bool checksum() const override { return m_checksum; }
 
+  bool data_checksum() const override { return m_data_checksum; }
+
+  bool deduplicate_ddl() const override { return m_deduplicate_ddl; }
+
   void enable_mds_compatibility_checks();
   using Dump_options::set_target_version;
   void set_output_url(const std::string &url) override;
@@ -131,6 +135,8 @@ class Ddl_dumper_options : public Dump_options {
   bool m_consistent_dump = true;
   bool m_skip_consistency_checks = false;
   bool m_checksum = false;
+  bool m_data_checksum = false;
+  bool m_deduplicate_ddl = false;
 };
 
 }  // namespace dump
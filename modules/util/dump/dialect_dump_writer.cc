@@ -23,10 +23,133 @@
 
 #include "modules/util/dump/dialect_dump_writer.h"
 
+#include <cstring>
+#include <utility>
+
 namespace mysqlsh {
 namespace dump {
 namespace detail {
 
+namespace {
+
+constexpr const char *k_numeric_types_alphabet = "0123456789-.";
+constexpr const char *k_hex_types_alphabet = "0123456789abcdefABCDEF";
+constexpr const char *k_base64_types_alphabet =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789+/=";
+
+inline bool in_alphabet(const char *alphabet, char c) {
+  return '\0' != c && nullptr != std::strchr(alphabet, c);
+}
+
+template <int features>
+bool create_writer(Dialect_data *dialect,
+                   std::unique_ptr<Dump_writer> *out_writer) {
+  if constexpr ((features & Dialect_feature::OPTIONALLY_ENCLOSED) &&
+                !(features & Dialect_feature::ENCLOSED)) {
+    // not a valid combination
+    return false;
+  } else {
+    if (features != dialect->features) {
+      return false;
+    }
+
+    *out_writer = std::make_unique<Custom_dialect_dump_writer<features>>(
+        std::move(*dialect));
+    return true;
+  }
+}
+
+template <int... features>
+std::unique_ptr<Dump_writer> create_writer(
+    Dialect_data &&dialect, std::integer_sequence<int, features...>) {
+  std::unique_ptr<Dump_writer> writer;
+
+  (create_writer<features>(&dialect, &writer) || ...);
+  assert(writer);
+
+  return writer;
+}
+
+}  // namespace
+
+Dialect_data::Dialect_data(const import_table::Dialect &dialect)
+    : fields_terminated_by(dialect.fields_terminated_by),
+      lines_terminated_by(dialect.lines_terminated_by.empty()
+                              ? dialect.fields_terminated_by
+                              : dialect.lines_terminated_by),
+      lines_starting_by(dialect.lines_starting_by) {
+  if (!dialect.fields_enclosed_by.empty()) {
+    features |= Dialect_feature::ENCLOSED;
+    enclosed_by = dialect.fields_enclosed_by[0];
+
+    if (dialect.fields_optionally_enclosed) {
+      features |= Dialect_feature::OPTIONALLY_ENCLOSED;
+    }
+
+    // FIELDS ENCLOSED BY character can also be escaped by doubling it,
+    // use this method if this character in combination with FIELDS ESCAPED BY
+    // character would create another escape sequence
+    const auto c = enclosed_by;
+    double_enclosed_by = ('0' == c || 'b' == c || 'n' == c || 'r' == c ||
+                          't' == c || 'Z' == c || 'N' == c);
+  }
+
+  if (!dialect.lines_starting_by.empty()) {
+    features |= Dialect_feature::LINES_STARTING_BY;
+  }
+
+  if (!dialect.fields_escaped_by.empty()) {
+    features |= Dialect_feature::ESCAPED;
+    escaped_by = dialect.fields_escaped_by[0];
+
+    // escape if character is:
+    // - FIELDS ESCAPED BY character
+    // - FIELDS ENCLOSED BY character
+    // - the first character of the FIELDS TERMINATED BY or LINES TERMINATED BY
+    //   values
+    std::string escaped{escaped_by};
+
+    if (enclosed_by) {
+      escaped += enclosed_by;
+    }
+
+    if (!dialect.fields_terminated_by.empty()) {
+      escaped += dialect.fields_terminated_by[0];
+    }
+
+    if (!dialect.lines_terminated_by.empty()) {
+      escaped += dialect.lines_terminated_by[0];
+    }
+
+    for (const auto c : escaped) {
+      escaped_as[static_cast<unsigned char>(c)] = c;
+
+      if (in_alphabet(k_numeric_types_alphabet, c)) {
+        numbers_need_escape = Escape_type::FULL;
+      }
+
+      if (in_alphabet(k_hex_types_alphabet, c)) {
+        hex_need_escape = Escape_type::FULL;
+      }
+
+      if (in_alphabet(k_base64_types_alphabet, c)) {
+        base64_need_escape = Escape_type::FULL;
+      }
+    }
+
+    // note: this doesn't produce output consistent with SELECT .. INTO
+    // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles this
+    // correctly and escaping i.e. carriage return characters helps with
+    // readability
+    escaped_as[static_cast<unsigned char>('\0')] = '0';
+    escaped_as[static_cast<unsigned char>('\b')] = 'b';
+    escaped_as[static_cast<unsigned char>('\n')] = 'n';
+    escaped_as[static_cast<unsigned char>('\r')] = 'r';
+    escaped_as[static_cast<unsigned char>('\t')] = 't';
+    escaped_as[0x1A] = 'Z';  // ASCII 26
+  }
+}
+
 constexpr char default_traits::lines_terminated_by[];
 constexpr char default_traits::fields_escaped_by[];
 constexpr char default_traits::fields_terminated_by[];
@@ -53,5 +176,14 @@ constexpr char csv_unix_traits::fields_terminated_by[];
 constexpr char csv_unix_traits::fields_enclosed_by[];
 
 }  // namespace detail
+
+std::unique_ptr<Dump_writer> create_custom_dialect_dump_writer(
+    const import_table::Dialect &dialect) {
+  return detail::create_writer(
+      detail::Dialect_data{dialect},
+      std::make_integer_sequence<int, detail::Dialect_feature::ALL_FEATURES +
+                                          1>{});
+}
+
 }  // namespace dump
 }  // namespace mysqlsh
@@ -24,15 +24,20 @@
 #ifndef MODULES_UTIL_DUMP_DIALECT_DUMP_WRITER_H_
 #define MODULES_UTIL_DUMP_DIALECT_DUMP_WRITER_H_
 
+#include <array>
+#include <cassert>
+#include <cctype>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "mysqlshdk/libs/utils/utils_encoding.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 #include "modules/util/dump/dump_writer.h"
+#include "modules/util/import_table/dialect.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -113,8 +118,8 @@ class Dialect_dump_writer : public Dump_writer {
  private:
   void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns) override {
-    read_metadata(metadata, pre_encoded_columns);
+      const std::vector<Encoding_type> &encoded_columns) override {
+    read_metadata(metadata, encoded_columns);
 
     // no preamble
   }
@@ -132,7 +137,7 @@ class Dialect_dump_writer : public Dump_writer {
   }
 
   void read_metadata(const std::vector<mysqlshdk::db::Column> &metadata,
-                     const std::vector<Encoding_type> &pre_encoded_columns) {
+                     const std::vector<Encoding_type> &encoded_columns) {
     m_num_fields = static_cast<uint32_t>(metadata.size());
 
     m_is_string_type.clear();
@@ -144,6 +149,9 @@ class Dialect_dump_writer : public Dump_writer {
     m_needs_escape.clear();
     m_needs_escape.resize(m_num_fields);
 
+    m_encoding.clear();
+    m_encoding.resize(m_num_fields, Encoding_type::NONE);
+
     std::size_t fixed_length = s_lines_terminated_by_length;
 
     if (m_num_fields > 0) {
@@ -161,15 +169,17 @@ class Dialect_dump_writer : public Dump_writer {
       // NULL
       m_is_number_type[i] = !is_string && mysqlshdk::db::Type::Bit != type;
 
-      // find columns that are safe to not escape
+      // find columns that are safe to not escape, none of the supported
+      // dialects uses characters which are used by numbers or encoded values
       m_needs_escape[i] = Escape_type::FULL;
       if (m_is_number_type[i]) {
         m_needs_escape[i] = Escape_type::NONE;
-      } else if (pre_encoded_columns.size() == metadata.size()) {
-        if (pre_encoded_columns[i] == Encoding_type::BASE64)
-          m_needs_escape[i] = Escape_type::BASE64;
-        else if (pre_encoded_columns[i] == Encoding_type::HEX)
+      } else if (encoded_columns.size() == metadata.size()) {
+        m_encoding[i] = encoded_columns[i];
+
+        if (Encoding_type::NONE != m_encoding[i]) {
           m_needs_escape[i] = Escape_type::NONE;
+        }
       }
 
       if (!T::fields_optionally_enclosed || is_string) {
@@ -207,23 +217,26 @@ class Dialect_dump_writer : public Dump_writer {
       store_null();
     } else {
       quote_field(idx);
-      switch (m_needs_escape[idx]) {
-        case Escape_type::FULL:
-          store_field(data, length);
-          break;
-        case Escape_type::BASE64:
-          store_base64_field(data, length);
-          break;
-        case Escape_type::NONE:
-          store_field<0>(data, length);
-          break;
+
+      if (Encoding_type::NONE != m_encoding[idx]) {
+        encode_field(idx, data, length);
+      } else if (Escape_type::FULL == m_needs_escape[idx]) {
+        store_field(data, length);
+      } else {
+        store_field<0>(data, length);
       }
+
       quote_field(idx);
     }
   }
 
-  inline void store_base64_field(const char *data, std::size_t length) {
-    buffer()->write_base64_data(data, length);
+  inline void encode_field(uint32_t idx, const char *data,
+                           std::size_t length) {
+    if (Encoding_type::BASE64 == m_encoding[idx]) {
+      buffer()->append_base64(data, length);
+    } else {
+      buffer()->append_hex(data, length);
+    }
   }
 
   inline void store_field(const char *data, std::size_t length) {
@@ -381,6 +394,304 @@ class Dialect_dump_writer : public Dump_writer {
   std::vector<int> m_is_number_type;
 
   std::vector<Escape_type> m_needs_escape;
+
+  std::vector<Encoding_type> m_encoding;
+};
+
+/**
+ * Features of a dialect which are resolved at compile time.
+ */
+enum Dialect_feature : int {
+  // FIELDS ESCAPED BY is set
+  ESCAPED = 1 << 0,
+  // FIELDS ENCLOSED BY is set
+  ENCLOSED = 1 << 1,
+  // FIELDS OPTIONALLY ENCLOSED is set, only used with ENCLOSED
+  OPTIONALLY_ENCLOSED = 1 << 2,
+  // LINES STARTING BY is set
+  LINES_STARTING_BY = 1 << 3,
+  ALL_FEATURES = (1 << 4) - 1,
+};
+
+/**
+ * Runtime values of a dialect used by the Custom_dialect_dump_writer.
+ */
+struct Dialect_data {
+  explicit Dialect_data(const import_table::Dialect &dialect);
+
+  std::string fields_terminated_by;
+  // FIELDS TERMINATED BY if LINES TERMINATED BY is not set
+  std::string lines_terminated_by;
+  std::string lines_starting_by;
+
+  char escaped_by = 0;
+  char enclosed_by = 0;
+
+  // FIELDS ENCLOSED BY character is escaped by doubling it
+  bool double_enclosed_by = false;
+
+  Escape_type numbers_need_escape = Escape_type::NONE;
+  Escape_type hex_need_escape = Escape_type::NONE;
+  Escape_type base64_need_escape = Escape_type::NONE;
+
+  // for each character: 0 if it's written as is, otherwise the character
+  // which is written after the escape character
+  std::array<char, 256> escaped_as{};
+
+  int features = 0;
+};
+
+/**
+ * Handles any dialect, branches which depend on the features of the dialect
+ * are resolved at compile time, characters are stored at runtime. Escaping is
+ * table-driven, runs of characters which do not need to be escaped are copied
+ * at once.
+ */
+template <int Features>
+class Custom_dialect_dump_writer : public Dump_writer {
+ public:
+  Custom_dialect_dump_writer() = delete;
+
+  explicit Custom_dialect_dump_writer(Dialect_data dialect)
+      : m_dialect(std::move(dialect)) {
+    assert(Features == m_dialect.features);
+  }
+
+  Custom_dialect_dump_writer(const Custom_dialect_dump_writer &) = delete;
+  Custom_dialect_dump_writer(Custom_dialect_dump_writer &&) = default;
+
+  Custom_dialect_dump_writer &operator=(const Custom_dialect_dump_writer &) =
+      delete;
+  Custom_dialect_dump_writer &operator=(Custom_dialect_dump_writer &&) =
+      default;
+
+  ~Custom_dialect_dump_writer() override = default;
+
+ private:
+  static constexpr bool k_escaped = Features & Dialect_feature::ESCAPED;
+  static constexpr bool k_enclosed = Features & Dialect_feature::ENCLOSED;
+  static constexpr bool k_optionally_enclosed =
+      Features & Dialect_feature::OPTIONALLY_ENCLOSED;
+  static constexpr bool k_lines_starting_by =
+      Features & Dialect_feature::LINES_STARTING_BY;
+
+  static_assert(k_enclosed || !k_optionally_enclosed,
+                "FIELDS OPTIONALLY ENCLOSED requires FIELDS ENCLOSED BY");
+
+  void store_preamble(
+      const std::vector<mysqlshdk::db::Column> &metadata,
+      const std::vector<Encoding_type> &encoded_columns) override {
+    read_metadata(metadata, encoded_columns);
+
+    // no preamble
+  }
+
+  void store_row(const mysqlshdk::db::IRow *row) override {
+    if constexpr (k_lines_starting_by) {
+      buffer()->append_fixed(m_dialect.lines_starting_by);
+    }
+
+    for (uint32_t idx = 0; idx < m_num_fields; ++idx) {
+      store_field(row, idx);
+    }
+
+    append_terminator(m_dialect.lines_terminated_by);
+  }
+
+  void store_postamble() override {
+    // no postamble
+  }
+
+  void read_metadata(const std::vector<mysqlshdk::db::Column> &metadata,
+                     const std::vector<Encoding_type> &encoded_columns) {
+    m_num_fields = static_cast<uint32_t>(metadata.size());
+
+    m_is_string_type.clear();
+    m_is_string_type.resize(m_num_fields);
+
+    m_is_number_type.clear();
+    m_is_number_type.resize(m_num_fields);
+
+    m_needs_escape.clear();
+    m_needs_escape.resize(m_num_fields);
+
+    m_encoding.clear();
+    m_encoding.resize(m_num_fields, Encoding_type::NONE);
+
+    std::size_t fixed_length = m_dialect.lines_starting_by.length() +
+                               m_dialect.lines_terminated_by.length();
+
+    if (m_num_fields > 0) {
+      fixed_length +=
+          (m_num_fields - 1) * m_dialect.fields_terminated_by.length();
+    }
+
+    for (uint32_t i = 0; i < m_num_fields; ++i) {
+      const auto type = metadata[i].get_type();
+      const auto is_string = mysqlshdk::db::is_string_type(type);
+
+      m_is_string_type[i] = is_string;
+      // bit fields are transferred in binary format, should not be inspected
+      // for any alpha characters, so they are not accidentally converted to
+      // NULL
+      m_is_number_type[i] = !is_string && mysqlshdk::db::Type::Bit != type;
+
+      m_needs_escape[i] = Escape_type::FULL;
+      if (m_is_number_type[i]) {
+        m_needs_escape[i] = m_dialect.numbers_need_escape;
+      } else if (encoded_columns.size() == metadata.size()) {
+        m_encoding[i] = encoded_columns[i];
+
+        if (Encoding_type::BASE64 == m_encoding[i]) {
+          m_needs_escape[i] = m_dialect.base64_need_escape;
+        } else if (Encoding_type::HEX == m_encoding[i]) {
+          m_needs_escape[i] = m_dialect.hex_need_escape;
+        }
+      }
+
+      if (k_enclosed && (!k_optionally_enclosed || is_string)) {
+        fixed_length += 2;
+      }
+    }
+
+    buffer()->set_fixed_length(fixed_length);
+  }
+
+  void store_field(const mysqlshdk::db::IRow *row, uint32_t idx) {
+    if (0 != idx) {
+      append_terminator(m_dialect.fields_terminated_by);
+    }
+
+    const char *data = nullptr;
+    std::size_t length = 0;
+    row->get_raw_data(idx, &data, &length);
+
+    bool is_null = nullptr == data;
+
+    if (!is_null) {
+      if (m_is_number_type[idx]) {
+        if ((length > 0 && std::isalpha(data[0])) ||
+            (length > 1 && '-' == data[0] && std::isalpha(data[1]))) {
+          // convert any strings ("inf", "-inf", "nan") into NULL
+          is_null = true;
+        }
+      }
+    }
+
+    if (is_null) {
+      store_null();
+      return;
+    }
+
+    quote_field(idx);
+
+    const auto encode = Encoding_type::NONE != m_encoding[idx];
+
+    if (k_escaped && Escape_type::NONE != m_needs_escape[idx]) {
+      if (encode) {
+        // encoded data needs to be escaped, use a temporary buffer
+        if (Encoding_type::BASE64 == m_encoding[idx]) {
+          m_encoded_field.resize(shcore::base64_encoded_length(length));
+          shcore::encode_base64({data, length}, m_encoded_field.data());
+        } else {
+          m_encoded_field.resize(2 * length);
+          shcore::encode_hex({data, length}, m_encoded_field.data());
+        }
+
+        data = m_encoded_field.data();
+        length = m_encoded_field.length();
+      }
+
+      escape_field(data, length);
+    } else if (encode) {
+      if (Encoding_type::BASE64 == m_encoding[idx]) {
+        buffer()->append_base64(data, length);
+      } else {
+        buffer()->append_hex(data, length);
+      }
+    } else {
+      buffer()->will_write(length);
+      buffer()->append(data, length);
+    }
+
+    quote_field(idx);
+  }
+
+  void escape_field(const char *data, std::size_t length) {
+    buffer()->will_write(2 * length);
+
+    const auto &escaped_as = m_dialect.escaped_as;
+    const auto end = data + length;
+
+    while (data != end) {
+      auto p = data;
+
+      while (p != end && !escaped_as[static_cast<unsigned char>(*p)]) {
+        ++p;
+      }
+
+      buffer()->append(data, p - data);
+
+      if (p == end) {
+        break;
+      }
+
+      const auto c = *p;
+      const auto doubled =
+          m_dialect.double_enclosed_by && c == m_dialect.enclosed_by;
+
+      buffer()->append(doubled ? c : m_dialect.escaped_by);
+      buffer()->append(escaped_as[static_cast<unsigned char>(c)]);
+
+      data = p + 1;
+    }
+  }
+
+  inline void quote_field(uint32_t idx) {
+    if constexpr (k_enclosed) {
+      if (!k_optionally_enclosed || m_is_string_type[idx]) {
+        buffer()->append_fixed(m_dialect.enclosed_by);
+      }
+    }
+  }
+
+  inline void store_null() {
+    if constexpr (k_escaped) {
+      // FIELDS ESCAPED BY character is specified, write "\N"
+      buffer()->will_write(2);
+      buffer()->append(m_dialect.escaped_by);
+      buffer()->append('N');
+    } else {
+      // if FIELDS ESCAPED BY character is not specified, write "NULL"
+      constexpr size_t length = 4;
+      buffer()->will_write(length);
+      buffer()->append("NULL", length);
+    }
+  }
+
+  inline void append_terminator(const std::string &terminator) {
+    if (1 == terminator.length()) {
+      buffer()->append_fixed(terminator[0]);
+    } else {
+      buffer()->append_fixed(terminator);
+    }
+  }
+
+  Dialect_data m_dialect;
+
+  uint32_t m_num_fields = 0;
+
+  // not using vectors of bool here, as they are not very efficient on access
+  std::vector<int> m_is_string_type;
+
+  std::vector<int> m_is_number_type;
+
+  std::vector<Escape_type> m_needs_escape;
+
+  std::vector<Encoding_type> m_encoding;
+
+  // holds an encoded value which needs to be escaped
+  std::string m_encoded_field;
 };
 
 }  // namespace detail
@@ -453,6 +764,13 @@ class Csv_unix_dump_writer
   ~Csv_unix_dump_writer() override = default;
 };
 
+/**
+ * Creates a writer which handles the given dialect, using an implementation
+ * specialized for the features of that dialect.
+ */
+std::unique_ptr<Dump_writer> create_custom_dialect_dump_writer(
+    const import_table::Dialect &dialect);
+
 }  // namespace dump
 }  // namespace mysqlsh
 
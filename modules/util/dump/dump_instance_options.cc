@@ -54,6 +54,8 @@ const shcore::Option_pack_def<Dump_instance_options>
           .optional("users", &Dump_instance_options::m_dump_users)
           .include(&Dump_instance_options::m_filtering_options,
                    &common::Filtering_options::users)
+          .optional("incrementalFrom",
+                    &Dump_instance_options::m_incremental_from)
           .on_done(&Dump_instance_options::on_unpacked_options)
           .on_log(&Dump_instance_options::on_log_options);
 
@@ -75,6 +77,17 @@ void Dump_instance_options::on_unpacked_options() {
     }
   }
 
+  if (is_incremental()) {
+    if (!dump_data()) {
+      throw std::invalid_argument(
+          "The 'incrementalFrom' option cannot be used if the 'ddlOnly' option "
+          "is set to true.");
+    }
+
+    // incremental dump contains only the changes recorded in the binary log
+    m_dump_users = false;
+  }
+
   if (mds_compatibility()) {
     // if MHS compatibility option is set, some schemas should be excluded
     // automatically
@@ -152,6 +152,10 @@ class Dump_options {
 
   bool rename_data_files() const { return m_rename_data_files; }
 
+  const std::string &incremental_from() const { return m_incremental_from; }
+
+  bool is_incremental() const { return !m_incremental_from.empty(); }
+
   virtual bool split() const = 0;
 
   virtual uint64_t bytes_per_chunk() const = 0;
@@ -188,6 +192,10 @@ class Dump_options {
 
   virtual bool checksum() const = 0;
 
+  virtual bool data_checksum() const = 0;
+
+  virtual bool deduplicate_ddl() const = 0;
+
  protected:
   void enable_mds_compatibility() { m_is_mds = true; }
 
@@ -225,6 +233,10 @@ class Dump_options {
 
   mutable bool m_filter_conflicts = false;
 
+  // currently used by dumpInstance(), location of the dump which is the base
+  // of an incremental dump
+  std::string m_incremental_from;
+
  protected:
   void on_start_unpack(const shcore::Dictionary_t &options);
 
@@ -28,6 +28,7 @@
 #include <utility>
 
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 
 #include "modules/util/dump/dump_errors.h"
@@ -102,32 +103,24 @@ void Dump_writer::Buffer::resize(std::size_t requested_capacity) {
   }
 }
 
-void Dump_writer::Buffer::write_base64_data(const char *data,
-                                            std::size_t length) {
-  // this function is meant to be used with base64 encoded data generated by
-  // MySQL, which has lines exactly 76 chars long, except for the last one.
-  // rfc2045 says at most 76 chars, so this will NOT work with arbitrary base64
-  // data.
+void Dump_writer::Buffer::append_base64(const char *data, std::size_t length) {
+  const auto encoded_length = shcore::base64_encoded_length(length);
 
-  if (length > 0) {
-    will_write(length);
+  will_write(encoded_length);
 
-    // the base64 decoder doesn't really require newlines so just strip them
-    const char *p = data;
-    const char *end = data + length - 76;
-    while (p < end) {
-      memcpy(m_ptr, p, 76);
-      m_ptr += 76;
-      m_length += 76;
+  shcore::encode_base64({data, length}, m_ptr);
+  m_ptr += encoded_length;
+  m_length += encoded_length;
+}
 
-      p += 77;
-    }
+void Dump_writer::Buffer::append_hex(const char *data, std::size_t length) {
+  const auto encoded_length = 2 * length;
 
-    size_t leftover = data + length - p;
-    memcpy(m_ptr, p, leftover);
-    m_ptr += leftover;
-    m_length += leftover;
-  }
+  will_write(encoded_length);
+
+  shcore::encode_hex({data, length}, m_ptr);
+  m_ptr += encoded_length;
+  m_length += encoded_length;
 }
 
 Dump_writer::Dump_writer() : m_buffer(std::make_unique<Buffer>()) {}
@@ -150,6 +143,16 @@ void Dump_writer::set_index_file(
   m_index = std::move(index);
 }
 
+void Dump_writer::enable_checksum() { m_checksum.emplace(); }
+
+std::optional<uint64_t> Dump_writer::checksum() const {
+  if (m_checksum.has_value()) {
+    return m_checksum->digest();
+  } else {
+    return {};
+  }
+}
+
 void Dump_writer::open() {
   if (m_index && !m_index->is_open()) {
     m_index->open(Mode::WRITE);
@@ -166,9 +169,9 @@ void Dump_writer::close() {
 
 Dump_write_result Dump_writer::write_preamble(
     const std::vector<mysqlshdk::db::Column> &metadata,
-    const std::vector<Encoding_type> &pre_encoded_columns) {
+    const std::vector<Encoding_type> &encoded_columns) {
   buffer()->clear();
-  store_preamble(metadata, pre_encoded_columns);
+  store_preamble(metadata, encoded_columns);
   return write_buffer("preamble");
 }
 
@@ -195,8 +198,7 @@ Dump_write_result Dump_writer::write_postamble() {
   return write_buffer("postamble");
 }
 
-Dump_write_result Dump_writer::write_buffer(const char *context,
-                                            bool row) const {
+Dump_write_result Dump_writer::write_buffer(const char *context, bool row) {
   assert(m_output);
 
   Dump_write_result result;
@@ -208,6 +210,10 @@ Dump_write_result Dump_writer::write_buffer(const char *context,
   }
 
   if (result.data_bytes() > 0) {
+    if (m_checksum.has_value()) {
+      m_checksum->update(buffer()->data(), result.data_bytes());
+    }
+
     const auto bytes_written =
         m_output->write(buffer()->data(), result.data_bytes());
 
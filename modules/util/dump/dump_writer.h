@@ -27,6 +27,7 @@
 #include <cassert>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -34,11 +35,12 @@
 #include "mysqlshdk/libs/db/row.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/xxhash.h"
 
 namespace mysqlsh {
 namespace dump {
 
-enum class Escape_type { NONE, FULL, BASE64 };
+enum class Escape_type { NONE, FULL };
 
 class Dump_write_result final {
  public:
@@ -92,13 +94,31 @@ class Dump_writer {
 
   void set_index_file(std::unique_ptr<mysqlshdk::storage::IFile> index);
 
+  /**
+   * Enables computation of a checksum of the uncompressed data written to the
+   * output file.
+   */
+  void enable_checksum();
+
+  /**
+   * Provides checksum of the data written so far, if checksum is enabled.
+   */
+  std::optional<uint64_t> checksum() const;
+
   void open();
 
   void close();
 
+  /**
+   * Writes the preamble.
+   *
+   * @param metadata Metadata of the columns.
+   * @param encoded_columns Encoding to be applied by the writer to each column,
+   *        if empty, columns are written as is.
+   */
   Dump_write_result write_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns = {});
+      const std::vector<Encoding_type> &encoded_columns = {});
 
   Dump_write_result write_row(const mysqlshdk::db::IRow *row);
 
@@ -142,7 +162,9 @@ class Dump_writer {
       m_length += length;
     }
 
-    void write_base64_data(const char *data, std::size_t length);
+    void append_base64(const char *data, std::size_t length);
+
+    void append_hex(const char *data, std::size_t length);
 
     void clear() noexcept;
 
@@ -166,13 +188,13 @@ class Dump_writer {
  private:
   virtual void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns) = 0;
+      const std::vector<Encoding_type> &encoded_columns) = 0;
 
   virtual void store_row(const mysqlshdk::db::IRow *row) = 0;
 
   virtual void store_postamble() = 0;
 
-  Dump_write_result write_buffer(const char *context, bool row = false) const;
+  Dump_write_result write_buffer(const char *context, bool row = false);
 
   void write_index();
 
@@ -187,6 +209,8 @@ class Dump_writer {
   uint64_t m_bytes_written = 0;
 
   uint64_t m_bytes_written_per_idx = 0;
+
+  std::optional<mysqlshdk::utils::Xxhash64> m_checksum;
 };
 
 }  // namespace dump
@@ -38,6 +38,7 @@
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include "mysqlshdk/include/scripting/shexcept.h"
 #include "mysqlshdk/include/shellcore/console.h"
@@ -45,6 +46,7 @@
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/mysql/binlog_reader.h"
 #include "mysqlshdk/libs/mysql/binlog_utils.h"
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
@@ -63,8 +65,10 @@
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/libs/utils/xxhash.h"
 
 #include "modules/mod_utils.h"
+#include "modules/util/common/dump/constants.h"
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/compatibility_option.h"
 #include "modules/util/dump/console_with_progress.h"
@@ -74,7 +78,6 @@
 #include "modules/util/dump/dump_manifest.h"
 #include "modules/util/dump/indexes.h"
 #include "modules/util/dump/schema_dumper.h"
-#include "modules/util/dump/text_dump_writer.h"
 #include "modules/util/upgrade_check.h"
 
 namespace mysqlsh {
@@ -91,6 +94,9 @@ namespace {
 static constexpr const int k_mysql_server_net_write_timeout = 30 * 60;
 static constexpr const int k_mysql_server_wait_timeout = 365 * 24 * 60 * 60;
 
+// maximum number of objects which have their DDL dumped by a single task
+static constexpr const std::size_t k_max_ddl_batch_size = 32;
+
 FI_DEFINE(dumper, [](const mysqlshdk::utils::FI::Args &args) {
   const auto op = args.get_string("op");
 
@@ -125,6 +131,75 @@ std::string quote_value(const std::string &value, mysqlshdk::db::Type type) {
   }
 }
 
+/**
+ * Estimates size of data of a table or a partition, using the statistics
+ * stored in the instance cache.
+ */
+template <typename T>
+uint64_t estimated_data_size(const T *info) {
+  return info ? info->row_count * info->average_row_length : 0;
+}
+
+/**
+ * Splits the objects into batches, each batch is dumped by a single task using
+ * one session. Batches are kept small enough to spread the work among all the
+ * threads.
+ */
+template <typename T>
+std::vector<std::vector<const T *>> ddl_batches(const std::vector<T> &objects,
+                                                std::size_t threads) {
+  std::vector<std::vector<const T *>> batches;
+
+  if (objects.empty()) {
+    return batches;
+  }
+
+  const auto batch_size = std::clamp<std::size_t>(
+      (objects.size() + threads - 1) / threads, 1, k_max_ddl_batch_size);
+  batches.reserve((objects.size() + batch_size - 1) / batch_size);
+
+  for (const auto &object : objects) {
+    if (batches.empty() || batches.back().size() == batch_size) {
+      batches.emplace_back().reserve(batch_size);
+    }
+
+    batches.back().emplace_back(&object);
+  }
+
+  return batches;
+}
+
+template <typename T>
+std::string ddl_batch_info(const std::vector<const T *> &batch) {
+  auto info = "writing DDL of " + batch.front()->quoted_name;
+
+  if (batch.size() > 1) {
+    info += " and " + std::to_string(batch.size() - 1) + " more object";
+
+    if (batch.size() > 2) {
+      info += 's';
+    }
+  }
+
+  return info;
+}
+
+/**
+ * Computes a 128-bit hash of the given DDL, used as the name of a file with
+ * deduplicated DDL.
+ */
+std::string ddl_hash(const std::string &ddl) {
+  std::string hash;
+
+  for (const uint64_t seed : {UINT64_C(0), ~UINT64_C(0)}) {
+    mysqlshdk::utils::Xxhash64 xxhash{seed};
+    xxhash.update(ddl.data(), ddl.length());
+    hash += xxhash.hex_digest();
+  }
+
+  return hash;
+}
+
 auto refs(const std::string &s) {
   return rapidjson::StringRef(s.c_str(), s.length());
 }
@@ -136,14 +211,25 @@ std::string to_string(rapidjson::Document *doc) {
   return std::string{buffer.GetString(), buffer.GetSize()};
 }
 
-void write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
-                rapidjson::Document *doc) {
-  const auto json = to_string(doc);
+std::string to_compact_string(rapidjson::Document *doc) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  doc->Accept(writer);
+  return std::string{buffer.GetString(), buffer.GetSize()};
+}
+
+void write_string(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                  const std::string &data) {
   file->open(Mode::WRITE);
-  file->write(json.c_str(), json.length());
+  file->write(data.c_str(), data.length());
   file->close();
 }
 
+void write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                rapidjson::Document *doc) {
+  write_string(std::move(file), to_string(doc));
+}
+
 Issue_status_set show_issues(const std::vector<Schema_dumper::Issue> &issues) {
   const auto console = current_console();
   Issue_status_set status;
@@ -402,9 +488,9 @@ class Dumper::Dump_writer_controller {
 
   virtual Dump_write_result start_writing(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns) {
+      const std::vector<Dump_writer::Encoding_type> &encoded_columns) {
     return update_stats(
-        m_writer->write_preamble(metadata, pre_encoded_columns));
+        m_writer->write_preamble(metadata, encoded_columns));
   }
 
   virtual Dump_write_result write_row(const mysqlshdk::db::IRow *row) {
@@ -437,10 +523,19 @@ class Dumper::Dump_writer_controller {
     (*stats)[output_filename()] += m_total_written.data_bytes();
   }
 
+  /**
+   * Stores checksums of the data files written by this controller. Only
+   * controllers which write whole files can provide them.
+   */
+  virtual void update_checksums(
+      std::unordered_map<std::string, uint64_t> *) const {}
+
  protected:
   explicit Dump_writer_controller(std::unique_ptr<Dump_writer> writer)
       : m_writer(std::move(writer)) {}
 
+  inline const Dump_writer *writer() const { return m_writer.get(); }
+
   void set_output(mysqlshdk::storage::IFile *output) { m_output = output; }
 
   void set_output_filename(const std::string &name) {
@@ -547,6 +642,13 @@ class Dumper::Default_writer_controller : public Dump_writer_controller {
     return result;
   }
 
+  void update_checksums(
+      std::unordered_map<std::string, uint64_t> *checksums) const override {
+    if (const auto checksum = writer()->checksum(); checksum.has_value()) {
+      (*checksums)[output_filename()] = *checksum;
+    }
+  }
+
  private:
   static constexpr std::string_view k_dump_in_progress_ext = ".dumping";
 
@@ -588,10 +690,10 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
 
   Dump_write_result start_writing(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns)
+      const std::vector<Dump_writer::Encoding_type> &encoded_columns)
       override {
     m_metadata = metadata;
-    m_pre_encoded_columns = pre_encoded_columns;
+    m_encoded_columns = encoded_columns;
 
     return start_writing();
   }
@@ -633,6 +735,13 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
     }
   }
 
+  void update_checksums(
+      std::unordered_map<std::string, uint64_t> *checksums) const override {
+    for (const auto &file : m_file_checksums) {
+      (*checksums)[file.first] = file.second;
+    }
+  }
+
  private:
   void create_controller(bool last_chunk) {
     m_controller = m_create_controller(common::get_table_data_filename(
@@ -642,7 +751,7 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
 
   Dump_write_result start_writing() {
     return update_stats(
-        m_controller->start_writing(m_metadata, m_pre_encoded_columns));
+        m_controller->start_writing(m_metadata, m_encoded_columns));
   }
 
   Dump_write_result initialize_controller(bool last_chunk) {
@@ -654,6 +763,7 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
     auto result = update_stats(m_controller->finish_writing());
     m_file_stats.emplace(m_controller->output_filename(),
                          m_controller->total_stats());
+    m_controller->update_checksums(&m_file_checksums);
     m_controller.reset();
     return result;
   }
@@ -664,8 +774,65 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
   std::size_t m_index = 0;
   std::unique_ptr<Dump_writer_controller> m_controller;
   std::vector<mysqlshdk::db::Column> m_metadata;
-  std::vector<Dump_writer::Encoding_type> m_pre_encoded_columns;
+  std::vector<Dump_writer::Encoding_type> m_encoded_columns;
   std::unordered_map<std::string, Dump_write_result> m_file_stats;
+  std::unordered_map<std::string, uint64_t> m_file_checksums;
+};
+
+class Dumper::Ordered_chunk_writer_controller : public Dump_writer_controller {
+ public:
+  using Wait_for_turn = std::function<void()>;
+  using Write_chunk = std::function<void(std::unique_ptr<Memory_file>)>;
+
+  Ordered_chunk_writer_controller() = delete;
+
+  Ordered_chunk_writer_controller(std::unique_ptr<Dump_writer> writer,
+                                  const std::string &filename,
+                                  Wait_for_turn wait_for_turn,
+                                  Write_chunk write_chunk)
+      : Dump_writer_controller(std::move(writer)),
+        m_wait_for_turn(std::move(wait_for_turn)),
+        m_write_chunk(std::move(write_chunk)) {
+    set_output_filename(filename);
+  }
+
+  Ordered_chunk_writer_controller(const Ordered_chunk_writer_controller &) =
+      delete;
+  Ordered_chunk_writer_controller(Ordered_chunk_writer_controller &&) =
+      default;
+
+  Ordered_chunk_writer_controller &operator=(
+      const Ordered_chunk_writer_controller &) = delete;
+  Ordered_chunk_writer_controller &operator=(
+      Ordered_chunk_writer_controller &&) = default;
+
+  ~Ordered_chunk_writer_controller() = default;
+
+  void prepare_for_writing() override {
+    // limits the number of chunks which are buffered at the same time
+    m_wait_for_turn();
+
+    // chunk is buffered in memory, it's written to the output file once all
+    // the preceding chunks are written
+    m_output = std::make_unique<Memory_file>(output_filename());
+    set_output(m_output.get());
+
+    Dump_writer_controller::prepare_for_writing();
+  }
+
+  Dump_write_result finish_writing() override {
+    auto result = Dump_writer_controller::finish_writing();
+
+    set_output(nullptr);
+    m_write_chunk(std::move(m_output));
+
+    return result;
+  }
+
+ private:
+  Wait_for_turn m_wait_for_turn;
+  Write_chunk m_write_chunk;
+  std::unique_ptr<Memory_file> m_output;
 };
 
 class Dumper::Table_worker final {
@@ -759,21 +926,29 @@ class Dumper::Table_worker final {
 
   std::string prepare_query(
       const Table_data_task &table,
-      std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
+      std::vector<Dump_writer::Encoding_type> *out_encoded_columns) const {
     const auto base64 = m_dumper->m_options.use_base64();
     std::string query = "SELECT SQL_NO_CACHE ";
 
     for (const auto &column : table.info->columns) {
-      if (column->csv_unsafe) {
+      if (column->csv_unsafe && mysqlshdk::db::Type::Bit == column->type) {
+        // HEX() treats BIT values as numbers, encoding is done by the server
+        // to keep the output format
         query += (base64 ? "TO_BASE64(" : "HEX(") + column->quoted_name + ")";
 
-        out_pre_encoded_columns->push_back(
-            base64 ? Dump_writer::Encoding_type::BASE64
-                   : Dump_writer::Encoding_type::HEX);
+        out_encoded_columns->push_back(Dump_writer::Encoding_type::NONE);
+      } else if (column->csv_unsafe) {
+        // binary data is fetched as is and encoded by the writer, this saves
+        // server's CPU and network bandwidth
+        query += column->quoted_name;
+
+        out_encoded_columns->push_back(base64
+                                           ? Dump_writer::Encoding_type::BASE64
+                                           : Dump_writer::Encoding_type::HEX);
       } else {
         query += column->quoted_name;
 
-        out_pre_encoded_columns->push_back(Dump_writer::Encoding_type::NONE);
+        out_encoded_columns->push_back(Dump_writer::Encoding_type::NONE);
       }
 
       query += ",";
@@ -813,8 +988,8 @@ class Dumper::Table_worker final {
     mysqlshdk::utils::Duration duration;
     duration.start();
 
-    std::vector<Dump_writer::Encoding_type> pre_encoded_columns;
-    const auto full_query = prepare_query(table, &pre_encoded_columns);
+    std::vector<Dump_writer::Encoding_type> encoded_columns;
+    const auto full_query = prepare_query(table, &encoded_columns);
     const auto controller = table.controller.get();
 
     try {
@@ -823,7 +998,7 @@ class Dumper::Table_worker final {
       if (Dry_run::DISABLED == m_dumper->m_options.dry_run_mode()) {
         const auto result = query(full_query);
 
-        controller->start_writing(result->get_metadata(), pre_encoded_columns);
+        controller->start_writing(result->get_metadata(), encoded_columns);
 
         while (const auto row = result->fetch_one()) {
           if (m_dumper->m_worker_interrupt) {
@@ -884,10 +1059,14 @@ class Dumper::Table_worker final {
     data_task.index = table.index;
     data_task.partitions = table.partitions;
     data_task.extra_filter = table.extra_filter;
+    data_task.long_pole = table.long_pole;
     data_task.chunk = chunk;
 
     if (!filename.empty()) {
-      data_task.controller = m_dumper->table_dump_controller(filename);
+      data_task.controller =
+          m_dumper->m_options.use_single_file() && chunk >= 0
+              ? m_dumper->table_dump_ordered_controller(chunk)
+              : m_dumper->table_dump_controller(filename);
     }
 
     return data_task;
@@ -1493,11 +1672,34 @@ class Dumper::Table_worker final {
     }
   }
 
+  // statistics may be stale, check if table does not hold more rows than a
+  // single chunk, reading at most one chunk worth of rows
+  bool fits_in_single_chunk(const Chunking_info &info) {
+    const auto result =
+        query("SELECT SQL_NO_CACHE 1 FROM " + info.table->quoted_name +
+              info.partition + where(*info.table, {}) + " LIMIT " +
+              std::to_string(info.rows_per_chunk) + ",1");
+    return !result->fetch_one();
+  }
+
   std::size_t create_ranged_tasks(const Table_task &table) {
     if (!m_dumper->m_options.split()) {
       return 0;
     }
 
+    if (m_dumper->m_options.use_single_file() && !table.index.info) {
+      // there's no index which could be used to order the chunks, table is
+      // written by a single thread
+      return 0;
+    }
+
+    if (table.partitions.size() > 1) {
+      // chunks are computed using the statistics and boundaries of a single
+      // partition, they would not cover data of all the exported partitions,
+      // table is written by a single thread
+      return 0;
+    }
+
     mysqlshdk::utils::Duration duration;
     duration.start();
 
@@ -1505,8 +1707,9 @@ class Dumper::Table_worker final {
 
     // default row size to use when there's no known row size
     constexpr const uint64_t k_default_row_size = 256;
+    // tables with at most 1/ratio of rows per chunk are not chunked
+    constexpr const uint64_t k_small_table_chunk_ratio = 4;
 
-    assert(table.partitions.size() < 2);
     const auto partition =
         table.partitions.empty() ? nullptr : table.partitions[0].info;
 
@@ -1514,8 +1717,9 @@ class Dumper::Table_worker final {
                                         : table.info->average_row_length;
     auto partition_clause =
         partition ? " PARTITION (" + partition->quoted_name + ")" : "";
+    const auto has_statistics = 0 != average_row_length;
 
-    if (0 == average_row_length) {
+    if (!has_statistics) {
       average_row_length = k_default_row_size;
 
       const auto result = query("SELECT 1 FROM " + table.quoted_name +
@@ -1576,7 +1780,22 @@ class Dumper::Table_worker final {
              m_log_id.c_str(), task_name.c_str(), info.row_count,
              average_row_length, info.rows_per_chunk);
 
-    const auto ranges_count = chunk_column(info);
+    std::size_t ranges_count;
+
+    if (has_statistics &&
+        info.row_count <= info.rows_per_chunk / k_small_table_chunk_ratio &&
+        fits_in_single_chunk(info)) {
+      // table is going to fit in a single chunk, skip the queries which fetch
+      // the chunking boundaries
+      log_info("%sTable %s is small, it's going to be written as one chunk",
+               m_log_id.c_str(), task_name.c_str());
+
+      create_and_push_table_data_chunk_task(table, info.boundary, "0", 0,
+                                            true);
+      ranges_count = 1;
+    } else {
+      ranges_count = chunk_column(info);
+    }
 
     duration.finish();
     log_debug("%sChunking of %s took %f seconds", m_log_id.c_str(),
@@ -1611,48 +1830,79 @@ class Dumper::Table_worker final {
     m_dumper->validate_dump_consistency(m_session);
   }
 
-  void dump_table_ddl(const Schema_info &schema,
+  void dump_tables_ddl(const Schema_info &schema,
+                       const std::vector<const Table_info *> &tables) const {
+    // all tables in a batch are dumped using the same schema dumper, so that
+    // session state is set up once per batch and not once per table
+    const auto dumper = m_dumper->schema_dumper(m_session);
+
+    for (const auto table : tables) {
+      dump_table_ddl(dumper.get(), schema, *table);
+
+      if (m_dumper->m_worker_interrupt) {
+        return;
+      }
+    }
+
+    dumper->restore_session_state();
+
+    m_dumper->validate_dump_consistency(m_session);
+  }
+
+  void dump_table_ddl(Schema_dumper *dumper, const Schema_info &schema,
                       const Table_info &table) const {
     log_info("%sWriting DDL for table %s", m_log_id.c_str(),
              table.quoted_name.c_str());
 
-    const auto dumper = m_dumper->schema_dumper(m_session);
-
-    m_dumper->write_ddl(
-        *m_dumper->dump_table(dumper.get(), schema.name, table.name),
-        common::get_table_filename(table.basename));
+    if (!m_dumper->deduplicate_ddl()) {
+      // otherwise DDL is written along with the table metadata
+      m_dumper->write_ddl(
+          *m_dumper->dump_table(dumper, schema.name, table.name),
+          common::get_table_filename(table.basename));
+    }
 
     if (m_dumper->m_options.dump_triggers() &&
         dumper->count_triggers_for_table(schema.name, table.name) > 0) {
       m_dumper->write_ddl(
-          *m_dumper->dump_triggers(dumper.get(), schema.name, table.name),
+          *m_dumper->dump_triggers(dumper, schema.name, table.name),
           common::get_table_data_filename(table.basename, "triggers.sql"));
     }
 
     ++m_dumper->m_ddl_written;
+  }
+
+  void dump_views_ddl(const Schema_info &schema,
+                      const std::vector<const View_info *> &views) const {
+    const auto dumper = m_dumper->schema_dumper(m_session);
+
+    for (const auto view : views) {
+      dump_view_ddl(dumper.get(), schema, *view);
+
+      if (m_dumper->m_worker_interrupt) {
+        return;
+      }
+    }
+
+    dumper->restore_session_state();
 
     m_dumper->validate_dump_consistency(m_session);
   }
 
-  void dump_view_ddl(const Schema_info &schema, const View_info &view) const {
+  void dump_view_ddl(Schema_dumper *dumper, const Schema_info &schema,
+                     const View_info &view) const {
     log_info("%sWriting DDL for view %s", m_log_id.c_str(),
              view.quoted_name.c_str());
 
-    const auto dumper = m_dumper->schema_dumper(m_session);
-
     // DDL file with the temporary table
     m_dumper->write_ddl(
-        *m_dumper->dump_temporary_view(dumper.get(), schema.name, view.name),
+        *m_dumper->dump_temporary_view(dumper, schema.name, view.name),
         common::get_table_data_filename(view.basename, "pre.sql"));
 
     // DDL file with the view structure
-    m_dumper->write_ddl(
-        *m_dumper->dump_view(dumper.get(), schema.name, view.name),
-        common::get_table_filename(view.basename));
+    m_dumper->write_ddl(*m_dumper->dump_view(dumper, schema.name, view.name),
+                        common::get_table_filename(view.basename));
 
     ++m_dumper->m_ddl_written;
-
-    m_dumper->validate_dump_consistency(m_session);
   }
 
   std::string get_query_comment(const Table_task &table,
@@ -1828,7 +2078,7 @@ Dumper::Dumper(const Dump_options &options)
     m_table_data_extension = "csv";
   } else {
     m_writer_creator = [&dialect = m_options.dialect()]() {
-      return std::make_unique<Text_dump_writer>(dialect);
+      return create_custom_dialect_dump_writer(dialect);
     };
     m_table_data_extension = "txt";
   }
@@ -1931,6 +2181,11 @@ void Dumper::do_run() {
   //       9.1.2.1. if dumpInstance(): error and abort
   //       9.1.2.2. else: warning and continue
 
+  if (m_options.is_incremental()) {
+    do_run_incremental();
+    return;
+  }
+
   shcore::on_leave_scope terminate_session([this]() { close_session(); });
 
   {
@@ -2064,6 +2319,320 @@ void Dumper::do_run() {
 #endif  // !NDEBUG
 }
 
+void Dumper::do_run_incremental() {
+  // incremental dump contains only the changes recorded in the binary log
+  // since the base dump was created:
+  // 1. read the binary log position of the base dump
+  // 2. fetch the current binary log position, this is where the dump ends
+  // 3. stream the binary log events between these two positions using the
+  //    replication protocol, splitting them into chunks at transaction
+  //    boundaries
+  shcore::on_leave_scope terminate_session([this]() { close_session(); });
+
+  m_worker_interrupt = false;
+  m_data_bytes = 0;
+  m_bytes_written = 0;
+
+  {
+    m_progress_thread.start();
+    shcore::on_leave_scope cleanup_progress([this]() { shutdown_progress(); });
+    m_current_stage = m_progress_thread.start_stage("Initializing");
+
+    open_session();
+
+    fetch_incremental_base();
+
+    m_cache = Instance_cache_builder(session(), m_options.filters(), {})
+                  .binlog_info()
+                  .build();
+
+    validate_incremental_base();
+
+    m_current_stage->finish();
+
+    initialize_dump();
+
+    dump_binlog_changes();
+
+    if (!m_worker_interrupt) {
+      finalize_dump();
+    }
+  }
+
+  if (!m_options.is_dry_run() && !m_worker_interrupt) {
+    const auto console = current_console();
+
+    console->print_status("Total duration: " +
+                          m_progress_thread.duration().to_string());
+    console->print_status("Transactions dumped: " +
+                          std::to_string(m_binlog_transactions));
+    console->print_status("Binary log chunks written: " +
+                          std::to_string(m_binlog_chunk_files.size()));
+    console->print_status(
+        std::string(compressed() ? "Uncompressed d" : "D") +
+        "ata size: " + mysqlshdk::utils::format_bytes(m_data_bytes));
+  }
+}
+
+void Dumper::fetch_incremental_base() {
+  const auto base = mysqlshdk::storage::make_directory(
+      m_options.incremental_from(), m_options.storage_config());
+  const auto base_path = base->full_path().masked();
+
+  if (!base->file("@.done.json")->exists()) {
+    throw std::invalid_argument(
+        "The dump at '" + base_path +
+        "' is not complete and cannot be used as a base of an incremental "
+        "dump.");
+  }
+
+  const auto file = base->file("@.json");
+  file->open(mysqlshdk::storage::Mode::READ);
+  const auto contents = mysqlshdk::storage::read_file(file.get());
+  file->close();
+
+  const auto metadata = shcore::Value::parse(contents).as_map();
+
+  if (!metadata->has_key("binlogFile") ||
+      !metadata->has_key("binlogPosition") ||
+      metadata->get_string("binlogFile").empty()) {
+    throw std::invalid_argument(
+        "The dump at '" + base_path +
+        "' does not contain the binary log position and cannot be used as a "
+        "base of an incremental dump.");
+  }
+
+  m_incremental_base.file = metadata->get_string("binlogFile");
+  m_incremental_base.position = metadata->get_uint("binlogPosition");
+  m_incremental_base_gtid_executed = metadata->get_string("gtidExecuted");
+
+  log_info("Base of the incremental dump: %s, binary log position: %s",
+           base_path.c_str(), m_incremental_base.to_string().c_str());
+}
+
+void Dumper::validate_incremental_base() const {
+  if (!m_binlog_enabled) {
+    throw std::runtime_error(
+        "Binary logging is disabled, cannot create an incremental dump.");
+  }
+
+  const auto instance = mysqlshdk::mysql::Instance(session());
+
+  if (!shcore::str_caseeq(
+          instance.get_sysvar_string("binlog_format").value_or(""), "ROW")) {
+    throw std::runtime_error(
+        "Incremental dump requires the binlog_format system variable to be "
+        "set to ROW.");
+  }
+
+  const auto binlogs = mysqlshdk::mysql::list_binlogs(instance);
+  const auto base = std::find(binlogs.begin(), binlogs.end(),
+                              m_incremental_base.file);
+
+  if (binlogs.end() == base) {
+    throw std::runtime_error(
+        "The binary log file '" + m_incremental_base.file +
+        "' used by the base dump is no longer available, it was either purged "
+        "or the base dump was not created from this instance.");
+  }
+
+  const auto current =
+      std::find(binlogs.begin(), binlogs.end(), m_cache.binlog.file);
+
+  if (current < base ||
+      (current == base &&
+       m_cache.binlog.position < m_incremental_base.position)) {
+    throw std::runtime_error(
+        "The binary log position of the base dump: '" +
+        m_incremental_base.to_string() +
+        "' is ahead of the current binary log position: '" +
+        m_cache.binlog.to_string() + "'.");
+  }
+
+  if (m_gtid_enabled && !m_incremental_base_gtid_executed.empty()) {
+    using mysqlshdk::mysql::Gtid_set;
+
+    const auto base_gtids =
+        Gtid_set::from_string(m_incremental_base_gtid_executed);
+    const auto current_gtids = Gtid_set::from_string(m_cache.gtid_executed);
+
+    if (!current_gtids.contains(base_gtids, instance)) {
+      throw std::runtime_error(
+          "The gtid_executed of the base dump is not a subset of the "
+          "gtid_executed of this instance, the base dump was not created from "
+          "this instance.");
+    }
+  }
+}
+
+void Dumper::dump_binlog_changes() {
+  const auto &begin = m_incremental_base;
+  const auto &end = m_cache.binlog;
+
+  if (begin == end) {
+    current_console()->print_info(
+        "There are no changes since the base dump was created.");
+    return;
+  }
+
+  if (m_options.is_dry_run()) {
+    current_console()->print_info("Changes between binary log positions '" +
+                                  begin.to_string() + "' and '" +
+                                  end.to_string() + "' would be dumped.");
+    return;
+  }
+
+  using mysqlshdk::mysql::Binlog_event_support;
+  using mysqlshdk::mysql::Binlog_event_type;
+
+  m_current_stage =
+      m_progress_thread.start_stage("Dumping changes from the binary log");
+  shcore::on_leave_scope finish_stage([this]() { m_current_stage->finish(); });
+
+  const auto instance = mysqlshdk::mysql::Instance(session());
+  const auto binlogs = mysqlshdk::mysql::list_binlogs(instance);
+  const auto co = get_classic_connection_options(m_options.session());
+  const auto extension =
+      ".bin" + mysqlshdk::storage::get_extension(m_options.compression());
+
+  std::unique_ptr<mysqlshdk::storage::IFile> output;
+  uint64_t chunk_bytes = 0;
+  std::string format_description;
+  bool in_transaction = false;
+
+  const auto write = [&](std::string_view event) {
+    output->write(event.data(), event.size());
+    chunk_bytes += event.size();
+  };
+
+  const auto close_chunk = [&]() {
+    if (output) {
+      output->close();
+      m_chunk_file_bytes[output->filename()] = chunk_bytes;
+      m_data_bytes += chunk_bytes;
+      output.reset();
+    }
+  };
+
+  const auto open_chunk = [&]() {
+    const auto name = "@.binlog." +
+                      std::to_string(m_binlog_chunk_files.size()) + extension;
+
+    output = mysqlshdk::storage::make_file(make_file(name, true),
+                                           m_options.compression());
+    output->open(mysqlshdk::storage::Mode::WRITE);
+    m_binlog_chunk_files.emplace_back(output->filename());
+    chunk_bytes = 0;
+
+    // each chunk can be applied on its own
+    write(format_description);
+  };
+
+  for (auto file = std::find(binlogs.begin(), binlogs.end(), begin.file);
+       file != binlogs.end() && !m_worker_interrupt; ++file) {
+    const auto last_file = *file == end.file;
+
+    mysqlshdk::mysql::Binlog_reader reader{
+        std::dynamic_pointer_cast<mysqlshdk::db::mysql::Session>(
+            establish_session(co, false))};
+    reader.open(*file, *file == begin.file ? begin.position : 4);
+
+    log_info("Dumping changes from the binary log file: %s", file->c_str());
+
+    while (!m_worker_interrupt) {
+      const auto event = reader.next();
+
+      if (event.empty()) {
+        break;
+      }
+
+      const auto header = mysqlshdk::mysql::parse_binlog_event_header(event);
+
+      if (last_file && header.log_pos > end.position) {
+        break;
+      }
+
+      switch (mysqlshdk::mysql::binlog_event_support(header.type)) {
+        case Binlog_event_support::IGNORED:
+          continue;
+
+        case Binlog_event_support::UNSUPPORTED:
+          throw std::runtime_error(shcore::str_format(
+              "The binary log file '%s' contains an event of type %d at "
+              "position %u, which cannot be included in an incremental dump. "
+              "Incremental dump requires binlog_format=ROW and "
+              "binlog_transaction_compression=OFF.",
+              file->c_str(), static_cast<int>(header.type),
+              header.log_pos - header.event_size));
+
+        case Binlog_event_support::APPLIED:
+          break;
+      }
+
+      if (Binlog_event_type::FORMAT_DESCRIPTION == header.type) {
+        format_description = event;
+
+        if (output) {
+          write(event);
+        }
+
+        continue;
+      }
+
+      if (!output) {
+        open_chunk();
+      }
+
+      write(event);
+
+      bool transaction_end = false;
+
+      if (Binlog_event_type::XID == header.type) {
+        transaction_end = true;
+      } else if (Binlog_event_type::QUERY == header.type) {
+        const auto query = mysqlshdk::mysql::parse_binlog_query_event(
+            event, reader.checksum_size());
+
+        if (mysqlshdk::mysql::is_binlog_dml_statement(query.query)) {
+          throw std::runtime_error(shcore::str_format(
+              "The binary log file '%s' contains a statement logged using the "
+              "statement-based format at position %u, which cannot be "
+              "included in an incremental dump. Incremental dump requires "
+              "binlog_format=ROW.",
+              file->c_str(), header.log_pos - header.event_size));
+        }
+
+        if (shcore::str_caseeq(query.query, "BEGIN")) {
+          in_transaction = true;
+        } else if (!in_transaction ||
+                   shcore::str_caseeq(query.query, "COMMIT", "ROLLBACK")) {
+          // DDL, COMMIT or ROLLBACK
+          transaction_end = true;
+        }
+      }
+
+      if (transaction_end) {
+        in_transaction = false;
+        ++m_binlog_transactions;
+
+        if (m_options.split() && chunk_bytes >= m_options.bytes_per_chunk()) {
+          close_chunk();
+        }
+      }
+
+      if (last_file && header.log_pos == end.position) {
+        break;
+      }
+    }
+
+    if (last_file) {
+      break;
+    }
+  }
+
+  close_chunk();
+}
+
 const std::shared_ptr<mysqlshdk::db::ISession> &Dumper::session() const {
   return m_session;
 }
@@ -2629,6 +3198,10 @@ void Dumper::create_schema_tasks() {
   if (has_partitions) {
     m_used_capabilities.emplace(Capability::PARTITION_AWARENESS);
   }
+
+  if (deduplicate_ddl()) {
+    m_used_capabilities.emplace(Capability::DEDUPLICATED_DDL);
+  }
 }
 
 void Dumper::validate_mds() const {
@@ -2837,6 +3410,8 @@ void Dumper::initialize_counters() {
   m_schema_metadata_written = 0;
   m_table_metadata_to_write = 0;
   m_table_metadata_written = 0;
+
+  m_metadata_snapshot.clear();
 }
 
 void Dumper::initialize_dump() {
@@ -2854,6 +3429,7 @@ void Dumper::finalize_dump() {
   }
 
   write_checksum_metadata();
+  write_metadata_snapshot();
   write_dump_finished_metadata();
   close_output_directory();
 }
@@ -3006,6 +3582,22 @@ void Dumper::dump_users_ddl() const {
 
 void Dumper::write_ddl(const Memory_dumper &in_memory,
                        const std::string &file) const {
+  check_ddl_issues(in_memory);
+
+  if (Dry_run::DONT_WRITE_ANY_FILES == m_options.dry_run_mode()) {
+    return;
+  }
+
+  const auto output = make_file(file);
+  output->open(Mode::WRITE);
+
+  const auto &content = in_memory.content();
+  output->write(content.c_str(), content.length());
+
+  output->close();
+}
+
+void Dumper::check_ddl_issues(const Memory_dumper &in_memory) const {
   if (!m_options.mds_compatibility()) {
     // if MDS is on, changes done by compatibility options were printed earlier
     const auto status = show_issues(in_memory.issues());
@@ -3016,18 +3608,44 @@ void Dumper::write_ddl(const Memory_dumper &in_memory,
       THROW_ERROR(SHERR_DUMP_COMPATIBILITY_OPTIONS_FAILED);
     }
   }
+}
 
-  if (Dry_run::DONT_WRITE_ANY_FILES == m_options.dry_run_mode()) {
-    return;
+bool Dumper::deduplicate_ddl() const {
+  // deduplicated DDL is referenced from the table metadata, which is not
+  // written in the dry run mode
+  return m_options.deduplicate_ddl() && m_options.dump_ddl() &&
+         !m_options.is_export_only() &&
+         Dry_run::DONT_WRITE_ANY_FILES != m_options.dry_run_mode();
+}
+
+std::string Dumper::write_deduplicated_table_ddl(
+    Schema_dumper *dumper, const std::string &schema,
+    const std::string &table) const {
+  // the header comment is skipped, as it contains the names of the schema and
+  // of the table
+  const auto memory = dump_ddl(dumper, [&schema, &table](Memory_dumper *m) {
+    m->dump(&Schema_dumper::dump_table_ddl, schema, table);
+  });
+
+  check_ddl_issues(*memory);
+
+  const auto &content = memory->content();
+  auto hash = ddl_hash(content);
+
+  {
+    std::lock_guard lock{m_deduplicated_ddl_mutex};
+
+    if (!m_deduplicated_ddl.emplace(hash).second) {
+      return hash;
+    }
   }
 
-  const auto output = make_file(file);
+  const auto output = make_file(common::get_ddl_filename(hash));
   output->open(Mode::WRITE);
-
-  const auto &content = in_memory.content();
   output->write(content.c_str(), content.length());
-
   output->close();
+
+  return hash;
 }
 
 std::unique_ptr<Dumper::Memory_dumper> Dumper::dump_ddl(
@@ -3141,18 +3759,22 @@ void Dumper::create_schema_ddl_tasks() {
          [&schema](Table_worker *worker) { worker->dump_schema_ddl(schema); }},
         shcore::Queue_priority::HIGH);
 
-    for (const auto &view : schema.views) {
-      m_worker_tasks.push({"writing DDL of " + view.quoted_name,
-                           [&schema, &view](Table_worker *worker) {
-                             worker->dump_view_ddl(schema, view);
+    for (auto &views : ddl_batches(schema.views, m_options.threads())) {
+      auto info = ddl_batch_info(views);
+      m_worker_tasks.push({std::move(info),
+                           [&schema, views = std::move(views)](
+                               Table_worker *worker) {
+                             worker->dump_views_ddl(schema, views);
                            }},
                           shcore::Queue_priority::HIGH);
     }
 
-    for (const auto &table : schema.tables) {
-      m_worker_tasks.push({"writing DDL of " + table.quoted_name,
-                           [&schema, &table](Table_worker *worker) {
-                             worker->dump_table_ddl(schema, table);
+    for (auto &tables : ddl_batches(schema.tables, m_options.threads())) {
+      auto info = ddl_batch_info(tables);
+      m_worker_tasks.push({std::move(info),
+                           [&schema, tables = std::move(tables)](
+                               Table_worker *worker) {
+                             worker->dump_tables_ddl(schema, tables);
                            }},
                           shcore::Queue_priority::HIGH);
     }
@@ -3189,7 +3811,7 @@ void Dumper::create_table_tasks() {
                                                     std::move(config));
   }
 
-  const auto console = current_console();
+  std::vector<Table_task> tasks;
 
   for (const auto &schema : m_schema_infos) {
     for (const auto &table : schema.tables) {
@@ -3210,22 +3832,144 @@ void Dumper::create_table_tasks() {
                                      task.index.info, task.extra_filter);
       }
 
-      push_table_task(std::move(task));
+      tasks.emplace_back(std::move(task));
     }
 
     // BUG#34663934 - allow exporting data from views
     if (m_options.is_export_only()) {
       for (const auto &view : schema.views) {
-        push_table_task(create_table_task(schema, view));
+        tasks.emplace_back(create_table_task(schema, view));
       }
     }
   }
 
   m_all_table_metadata_tasks_scheduled = true;
 
+  schedule_table_tasks(std::move(tasks));
+
   m_main_thread_finished_producing_chunking_tasks = true;
 }
 
+std::vector<Table_task_order> order_table_tasks(
+    const std::vector<uint64_t> &sizes, std::size_t threads) {
+  std::vector<Table_task_order> order;
+  order.reserve(sizes.size());
+
+  uint64_t total_size = 0;
+
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    order.push_back({i, sizes[i], false});
+    total_size += sizes[i];
+  }
+
+  // largest tables first, tables of the same size keep their original order
+  std::stable_sort(
+      order.begin(), order.end(),
+      [](const auto &l, const auto &r) { return l.size > r.size; });
+
+  // a table which holds at least as much data as a single thread is going to
+  // dump is scheduled ahead of everything else, including the DDL, otherwise
+  // it would finish long after all the other threads are done
+  const auto fair_share = total_size / std::max<std::size_t>(threads, 1);
+
+  for (auto &entry : order) {
+    entry.long_pole = threads > 1 && entry.size > 0 && entry.size >= fair_share;
+  }
+
+  return order;
+}
+
+shcore::Queue_priority chunking_task_priority(bool long_pole) {
+  return long_pole ? shcore::Queue_priority::HIGHEST
+                   : shcore::Queue_priority::MEDIUM;
+}
+
+shcore::Queue_priority data_task_priority(bool long_pole) {
+  return long_pole ? shcore::Queue_priority::HIGHEST
+                   : shcore::Queue_priority::LOW;
+}
+
+void Dumper::schedule_table_tasks(std::vector<Table_task> &&tasks) {
+  std::vector<uint64_t> sizes;
+  sizes.reserve(tasks.size());
+
+  uint64_t total_size = 0;
+
+  for (const auto &task : tasks) {
+    sizes.emplace_back(estimated_data_size(task.info));
+    total_size += sizes.back();
+  }
+
+  if (m_options.is_dry_run() && m_options.dump_data()) {
+    report_critical_path(tasks, total_size);
+  }
+
+  for (const auto &entry : order_table_tasks(sizes, m_options.threads())) {
+    auto &task = tasks[entry.index];
+    task.long_pole = entry.long_pole;
+
+    if (task.long_pole) {
+      log_info("Table %s is estimated to hold %s of data, scheduling it first",
+               task.quoted_name.c_str(),
+               mysqlshdk::utils::format_bytes(entry.size).c_str());
+    }
+
+    push_table_task(std::move(task));
+  }
+}
+
+void Dumper::report_critical_path(const std::vector<Table_task> &tasks,
+                                  uint64_t total_size) const {
+  using mysqlshdk::utils::format_bytes;
+
+  // data of a table which is not chunked is dumped by a single thread, this is
+  // the lower bound of the dump time, otherwise data is distributed between
+  // all the threads
+  uint64_t longest = 0;
+  std::string longest_name;
+
+  const auto check = [&](uint64_t size, const std::string &name) {
+    if (size > longest) {
+      longest = size;
+      longest_name = name;
+    }
+  };
+
+  for (const auto &task : tasks) {
+    if (m_options.split() && task.index.info &&
+        (!m_options.is_export_only() || task.partitions.size() < 2)) {
+      continue;
+    }
+
+    if (m_options.is_export_only() || task.partitions.empty()) {
+      check(estimated_data_size(task.info), task.quoted_name);
+    } else {
+      for (const auto &partition : task.partitions) {
+        check(estimated_data_size(partition.info),
+              task.quoted_name + " partition " + partition.info->quoted_name);
+      }
+    }
+  }
+
+  const auto per_thread = total_size / m_options.threads();
+  const auto console = current_console();
+
+  console->print_info("Estimated size of data to be dumped: " +
+                      format_bytes(total_size) + ", using " +
+                      std::to_string(m_options.threads()) + " thread" +
+                      (m_options.threads() > 1 ? "s" : "") + ".");
+
+  if (longest > per_thread) {
+    console->print_info("Estimated critical path: " + format_bytes(longest) +
+                        ", data of " + longest_name +
+                        " is going to be dumped by a single thread.");
+  } else {
+    console->print_info("Estimated critical path: " + format_bytes(per_thread) +
+                        ", data is going to be evenly distributed between "
+                        "threads.");
+  }
+}
+
 Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
                                              const Table_info &table) {
   Table_task task;
@@ -3297,6 +4041,11 @@ void Dumper::push_table_task(Table_task &&task) {
           "Could not select columns to be used as an index for table %s. Data "
           "will be dumped to multiple files by a single thread.",
           task.quoted_name.c_str());
+    } else if (m_options.is_export_only() && task.partitions.size() > 1) {
+      log_info(
+          "Data of multiple partitions of table %s is exported, it will be "
+          "written by a single thread.",
+          task.quoted_name.c_str());
     } else {
       log_info("The %s will be %s using %s", context.c_str(),
                dump ? "chunked" : "ordered", get_index().c_str());
@@ -3353,6 +4102,7 @@ void Dumper::push_table_data_task(Table_data_task &&task) {
   // then move-captured by lambda, so that this lambda can be stored,
   // otherwise compiler will complain about a call to implicitly-deleted
   // copy constructor
+  const auto priority = data_task_priority(task.long_pole);
   auto t = std::make_shared<Table_data_task>(std::move(task));
 
   m_worker_tasks.push({std::move(info),
@@ -3363,13 +4113,14 @@ void Dumper::push_table_data_task(Table_data_task &&task) {
 
                          --worker->m_dumper->m_num_threads_dumping;
                        }},
-                      shcore::Queue_priority::LOW);
+                      priority);
 }
 
 void Dumper::push_table_chunking_task(Table_task &&task) {
   ++m_chunking_tasks_total;
 
   std::string info = "chunking " + task.task_name;
+  const auto priority = chunking_task_priority(task.long_pole);
   m_worker_tasks.push({std::move(info),
                        [task = std::move(task)](Table_worker *worker) {
                          ++worker->m_dumper->m_num_threads_chunking;
@@ -3378,7 +4129,7 @@ void Dumper::push_table_chunking_task(Table_task &&task) {
 
                          --worker->m_dumper->m_num_threads_chunking;
                        }},
-                      shcore::Queue_priority::MEDIUM);
+                      priority);
 }
 
 Dumper::Checksum_task Dumper::create_checksum_task(
@@ -3440,8 +4191,14 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
     return std::make_unique<Single_file_writer_controller>(m_writer_creator(),
                                                            m_output_file.get());
   } else {
+    auto writer = m_writer_creator();
+
+    if (m_options.data_checksum()) {
+      writer->enable_checksum();
+    }
+
     return std::make_unique<Default_writer_controller>(
-        m_writer_creator(),
+        std::move(writer),
         [this](const std::string &name) {
           return mysqlshdk::storage::make_file(make_file(name, true),
                                                m_options.compression());
@@ -3465,11 +4222,65 @@ Dumper::table_dump_multi_file_controller(const std::string &basename) const {
       basename, m_table_data_extension, m_options.bytes_per_chunk());
 }
 
+std::unique_ptr<Dumper::Dump_writer_controller>
+Dumper::table_dump_ordered_controller(std::size_t chunk) {
+  return std::make_unique<Ordered_chunk_writer_controller>(
+      m_writer_creator(), m_output_file->filename(),
+      [this, chunk]() { wait_for_ordered_chunk(chunk); },
+      [this, chunk](std::unique_ptr<Memory_file> data) {
+        write_ordered_chunk(chunk, std::move(data));
+      });
+}
+
+void Dumper::wait_for_ordered_chunk(std::size_t chunk) {
+  // Chunks are scheduled in order, so all the preceding chunks are either
+  // written or are being dumped by the other threads, and the next chunk to be
+  // written never waits. Chunk can be dumped if it's within a window of
+  // (threads) chunks following that chunk, this bounds the memory used by the
+  // buffered chunks to roughly threads * bytesPerChunk.
+  const auto window = std::max<std::size_t>(m_options.threads(), 1);
+  std::unique_lock<std::mutex> lock(m_ordered_chunks_mutex);
+
+  while (!m_worker_interrupt && chunk >= m_next_ordered_chunk + window) {
+    // wake up periodically to check if dump was interrupted
+    m_ordered_chunks_cv.wait_for(lock, std::chrono::milliseconds(100));
+  }
+}
+
+void Dumper::write_ordered_chunk(std::size_t chunk,
+                                 std::unique_ptr<Memory_file> data) {
+  std::unique_lock<std::mutex> lock(m_ordered_chunks_mutex);
+  shcore::on_leave_scope notify_waiting([this, &lock]() {
+    lock.unlock();
+    m_ordered_chunks_cv.notify_all();
+  });
+
+  m_ordered_chunks.emplace(chunk, std::move(data));
+
+  // write all the consecutive chunks which are ready
+  for (auto it = m_ordered_chunks.begin();
+       it != m_ordered_chunks.end() && it->first == m_next_ordered_chunk;
+       it = m_ordered_chunks.erase(it), ++m_next_ordered_chunk) {
+    if (!m_output_file->is_open()) {
+      m_output_file->open(Mode::WRITE);
+    }
+
+    const auto &content = it->second->content();
+
+    if (!content.empty() &&
+        m_output_file->write(content.data(), content.size()) < 0) {
+      THROW_ERROR(SHERR_DUMP_DW_WRITE_FAILED, "data chunk",
+                  m_output_file->full_path().masked().c_str());
+    }
+  }
+}
+
 void Dumper::finish_writing(const std::string &schema, const std::string &table,
                             const Dump_writer_controller *controller) {
   std::lock_guard<std::mutex> lock(m_table_data_stats_mutex);
 
   controller->update_uncompressed_file_size(&m_chunk_file_bytes);
+  controller->update_checksums(&m_chunk_file_checksums);
   m_table_data_stats[schema][table] += controller->total_stats();
 }
 
@@ -3557,6 +4368,19 @@ void Dumper::write_dump_started_metadata() const {
   }
 
   doc.AddMember(StringRef("gtidExecuted"), refs(m_cache.gtid_executed), a);
+
+  if (m_options.is_incremental()) {
+    Value base{Type::kObjectType};
+
+    base.AddMember(StringRef("binlogFile"), refs(m_incremental_base.file), a);
+    base.AddMember(StringRef("binlogPosition"), m_incremental_base.position,
+                   a);
+    base.AddMember(StringRef("gtidExecuted"),
+                   refs(m_incremental_base_gtid_executed), a);
+
+    doc.AddMember(StringRef("incrementalFrom"), std::move(base), a);
+  }
+
   doc.AddMember(StringRef("gtidExecutedInconsistent"),
                 is_gtid_executed_inconsistent(), a);
   doc.AddMember(StringRef("consistent"), m_options.consistent_dump(), a);
@@ -3603,6 +4427,7 @@ void Dumper::write_dump_started_metadata() const {
   }
 
   doc.AddMember(StringRef("checksum"), m_options.checksum(), a);
+  doc.AddMember(StringRef("dataChecksum"), m_options.data_checksum(), a);
 
   doc.AddMember(StringRef("begin"),
                 refs(m_progress_thread.duration().started_at()), a);
@@ -3666,6 +4491,32 @@ void Dumper::write_dump_finished_metadata() const {
     doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
   }
 
+  if (m_options.data_checksum()) {
+    Value files{Type::kObjectType};
+
+    for (const auto &file : m_chunk_file_checksums) {
+      files.AddMember(refs(file.first),
+                      {shcore::str_format("%016" PRIX64, file.second).c_str(),
+                       a},
+                      a);
+    }
+
+    doc.AddMember(StringRef("chunkFileChecksumAlgorithm"),
+                  StringRef(common::k_data_checksum_algorithm), a);
+    doc.AddMember(StringRef("chunkFileChecksums"), std::move(files), a);
+  }
+
+  if (m_options.is_incremental()) {
+    Value files{Type::kArrayType};
+
+    for (const auto &file : m_binlog_chunk_files) {
+      files.PushBack(refs(file), a);
+    }
+
+    doc.AddMember(StringRef("binlogChunkFiles"), std::move(files), a);
+    doc.AddMember(StringRef("binlogTransactions"), m_binlog_transactions, a);
+  }
+
   write_json(make_file("@.done.json"), &doc);
 }
 
@@ -3677,6 +4528,40 @@ void Dumper::write_checksum_metadata() const {
   m_checksum->serialize(make_file("@.checksums.json"));
 }
 
+void Dumper::write_metadata_snapshot() const {
+  if (m_options.is_export_only() || m_metadata_snapshot.empty()) {
+    return;
+  }
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+  writer.StartObject();
+  writer.Key("files");
+  writer.StartObject();
+
+  for (const auto &file : m_metadata_snapshot) {
+    writer.Key(file.first.c_str(),
+               static_cast<rapidjson::SizeType>(file.first.length()));
+    writer.String(file.second.c_str(),
+                  static_cast<rapidjson::SizeType>(file.second.length()));
+  }
+
+  writer.EndObject();
+  writer.EndObject();
+
+  write_string(make_file(common::k_metadata_snapshot_file),
+               std::string{buffer.GetString(), buffer.GetSize()});
+
+  m_metadata_snapshot.clear();
+}
+
+void Dumper::add_to_metadata_snapshot(const std::string &name,
+                                      std::string metadata) const {
+  std::lock_guard<std::mutex> lock(m_metadata_snapshot_mutex);
+  m_metadata_snapshot.emplace_back(name, std::move(metadata));
+}
+
 void Dumper::write_schema_metadata(const Schema_info &schema) const {
   if (m_options.is_export_only()) {
     return;
@@ -3771,8 +4656,10 @@ void Dumper::write_schema_metadata(const Schema_info &schema) const {
     doc.AddMember(StringRef("basenames"), std::move(basenames), a);
   }
 
-  write_json(make_file(common::get_schema_filename(schema.basename, "json")),
-             &doc);
+  const auto name = common::get_schema_filename(schema.basename, "json");
+
+  write_json(make_file(name), &doc);
+  add_to_metadata_snapshot(name, to_compact_string(&doc));
 }
 
 void Dumper::write_table_metadata(
@@ -3869,6 +4756,13 @@ void Dumper::write_table_metadata(
                 m_options.dump_data() && should_dump_data(table), a);
   doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
 
+  if (deduplicate_ddl()) {
+    // hash identifies the file with the DDL of this table
+    const auto hash =
+        write_deduplicated_table_ddl(dumper.get(), table.schema, table.name);
+    doc.AddMember(StringRef("ddl"), {hash.c_str(), a}, a);
+  }
+
   doc.AddMember(StringRef("extension"), refs(m_table_data_extension), a);
   doc.AddMember(StringRef("chunking"), m_options.split(), a);
   doc.AddMember(
@@ -3918,8 +4812,10 @@ void Dumper::write_table_metadata(
     }
   }
 
-  write_json(make_file(common::get_table_data_filename(table.basename, "json")),
-             &doc);
+  const auto name = common::get_table_data_filename(table.basename, "json");
+
+  write_json(make_file(name), &doc);
+  add_to_metadata_snapshot(name, to_compact_string(&doc));
 }
 
 void Dumper::summarize() const {
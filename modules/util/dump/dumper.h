@@ -28,6 +28,7 @@
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -60,6 +61,43 @@ namespace dump {
 
 class Schema_dumper;
 
+/**
+ * Position of a table task in the order in which table tasks are scheduled.
+ */
+struct Table_task_order {
+  // index of the task in the original list
+  std::size_t index;
+  // estimated size of data of the task
+  uint64_t size;
+  // estimated to take more than a fair share of the dump time
+  bool long_pole;
+};
+
+/**
+ * Orders table tasks largest first, tasks of the same size keep their original
+ * order. If more than one thread is used, a task which holds at least as much
+ * data as a single thread is going to dump is marked as a long pole.
+ *
+ * @param sizes estimated sizes of data of the table tasks
+ * @param threads number of threads used to dump the data
+ *
+ * @return order in which table tasks are scheduled
+ */
+std::vector<Table_task_order> order_table_tasks(
+    const std::vector<uint64_t> &sizes, std::size_t threads);
+
+/**
+ * Priority of a chunking task, long poles are started ahead of everything
+ * else, including the DDL.
+ */
+shcore::Queue_priority chunking_task_priority(bool long_pole);
+
+/**
+ * Priority of a data task, long poles are started ahead of everything else,
+ * including the DDL.
+ */
+shcore::Queue_priority data_task_priority(bool long_pole);
+
 class Dumper {
  public:
   Dumper() = delete;
@@ -123,6 +161,7 @@ class Dumper {
   class Single_file_writer_controller;
   class Default_writer_controller;
   class Multi_file_writer_controller;
+  class Ordered_chunk_writer_controller;
 
   struct Object_info {
     std::string name;
@@ -159,6 +198,9 @@ class Dumper {
     std::string schema;
     std::string extra_filter;
     Index_info index;
+    // estimated to take more than a fair share of the dump time, scheduled
+    // ahead of all other tasks
+    bool long_pole = false;
   };
 
   struct Table_data_task : Table_task {
@@ -228,6 +270,14 @@ class Dumper {
 
   void lock_instance();
 
+  void do_run_incremental();
+
+  void fetch_incremental_base();
+
+  void validate_incremental_base() const;
+
+  void dump_binlog_changes();
+
   void initialize_instance_cache_minimal();
 
   void initialize_instance_cache();
@@ -270,6 +320,14 @@ class Dumper {
 
   void write_ddl(const Memory_dumper &in_memory, const std::string &file) const;
 
+  void check_ddl_issues(const Memory_dumper &in_memory) const;
+
+  bool deduplicate_ddl() const;
+
+  std::string write_deduplicated_table_ddl(Schema_dumper *dumper,
+                                           const std::string &schema,
+                                           const std::string &table) const;
+
   std::unique_ptr<Memory_dumper> dump_ddl(
       Schema_dumper *dumper,
       const std::function<void(Memory_dumper *)> &func) const;
@@ -307,6 +365,16 @@ class Dumper {
   Table_task create_table_task(const Schema_info &schema,
                                const View_info &view);
 
+  /**
+   * Pushes table tasks largest first, so that the biggest tables do not
+   * become the long pole of the dump. In dry run mode, reports the estimated
+   * critical path instead.
+   */
+  void schedule_table_tasks(std::vector<Table_task> &&tasks);
+
+  void report_critical_path(const std::vector<Table_task> &tasks,
+                            uint64_t total_size) const;
+
   void push_table_task(Table_task &&task);
 
   void push_table_chunking_task(Table_task &&task);
@@ -327,6 +395,15 @@ class Dumper {
   std::unique_ptr<Dump_writer_controller> table_dump_multi_file_controller(
       const std::string &basename) const;
 
+  std::unique_ptr<Dump_writer_controller> table_dump_ordered_controller(
+      std::size_t chunk);
+
+  void wait_for_ordered_chunk(std::size_t chunk);
+
+  void write_ordered_chunk(
+      std::size_t chunk,
+      std::unique_ptr<mysqlshdk::storage::backend::Memory_file> data);
+
   void finish_writing(const std::string &schema, const std::string &table,
                       const Dump_writer_controller *controller);
 
@@ -338,6 +415,11 @@ class Dumper {
 
   void write_checksum_metadata() const;
 
+  void write_metadata_snapshot() const;
+
+  void add_to_metadata_snapshot(const std::string &name,
+                                std::string metadata) const;
+
   void write_schema_metadata(const Schema_info &schema) const;
 
   void write_table_metadata(
@@ -464,6 +546,15 @@ class Dumper {
   std::atomic<uint64_t> m_table_metadata_written;
   bool m_all_table_metadata_tasks_scheduled = false;
 
+  // hashes of the deduplicated DDL files which were written so far
+  mutable std::mutex m_deduplicated_ddl_mutex;
+  mutable std::unordered_set<std::string> m_deduplicated_ddl;
+
+  mutable std::mutex m_metadata_snapshot_mutex;
+  // file name -> compact contents of schema and table metadata files
+  mutable std::vector<std::pair<std::string, std::string>>
+      m_metadata_snapshot;
+
   mutable std::recursive_mutex m_throughput_mutex;
   std::unique_ptr<mysqlshdk::textui::Throughput> m_data_throughput;
   std::unique_ptr<mysqlshdk::textui::Throughput> m_bytes_throughput;
@@ -476,6 +567,23 @@ class Dumper {
 
   // path -> uncompressed bytes
   std::unordered_map<std::string, uint64_t> m_chunk_file_bytes;
+  // checksums of uncompressed data files, computed while they are written
+  std::unordered_map<std::string, uint64_t> m_chunk_file_checksums;
+
+  // chunks of a table exported in parallel, waiting to be written to the
+  // output file in order
+  std::mutex m_ordered_chunks_mutex;
+  std::condition_variable m_ordered_chunks_cv;
+  std::map<std::size_t,
+           std::unique_ptr<mysqlshdk::storage::backend::Memory_file>>
+      m_ordered_chunks;
+  std::size_t m_next_ordered_chunk = 0;
+
+  // incremental dump
+  Instance_cache::Binlog m_incremental_base;
+  std::string m_incremental_base_gtid_executed;
+  std::vector<std::string> m_binlog_chunk_files;
+  uint64_t m_binlog_transactions = 0;
 
   // threads
   std::vector<std::thread> m_workers;
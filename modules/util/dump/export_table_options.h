@@ -61,11 +61,11 @@ class Export_table_options : public Dump_options {
 
   bool use_single_file() const override { return true; }
 
-  bool split() const override { return false; }
+  bool split() const override { return m_threads > 1; }
 
-  uint64_t bytes_per_chunk() const override { return 0; }
+  uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
-  std::size_t threads() const override { return 1; }
+  std::size_t threads() const override { return m_threads; }
 
   bool dump_ddl() const override { return false; }
 
@@ -91,6 +91,10 @@ class Export_table_options : public Dump_options {
 
   bool checksum() const override { return false; }
 
+  bool data_checksum() const override { return false; }
+
+  bool deduplicate_ddl() const override { return false; }
+
  private:
   void on_set_session(
       const std::shared_ptr<mysqlshdk::db::ISession> &session) override;
@@ -101,12 +105,19 @@ class Export_table_options : public Dump_options {
 
   void on_set_schema();
 
+  void set_bytes_per_chunk(const std::string &value);
+
   std::string m_schema;
   std::string m_table;
 
   std::string m_where;
   std::unordered_set<std::string> m_partitions;
 
+  // table is chunked and exported in parallel only if there's more than one
+  // thread
+  uint64_t m_threads = 1;
+  uint64_t m_bytes_per_chunk;
+
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
   mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
   mysqlshdk::azure::Blob_storage_options m_blob_storage_options;
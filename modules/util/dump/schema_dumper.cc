@@ -445,7 +445,7 @@ void Schema_dumper::write_comment(IFile *sql_file, const std::string &db_name,
 int Schema_dumper::execute_no_throw(const std::string &s,
                                     mysqlshdk::db::Error *out_error) {
   try {
-    m_mysql->execute(s);
+    session()->execute(s);
   } catch (const mysqlshdk::db::Error &e) {
     if (out_error) *out_error = e;
 
@@ -459,7 +459,7 @@ int Schema_dumper::execute_no_throw(const std::string &s,
 int Schema_dumper::execute_maybe_throw(const std::string &s,
                                        mysqlshdk::db::Error *out_error) {
   try {
-    m_mysql->execute(s);
+    session()->execute(s);
   } catch (const mysqlshdk::db::Error &e) {
     if (out_error) *out_error = e;
 
@@ -477,7 +477,7 @@ int Schema_dumper::query_no_throw(
     const std::string &s, std::shared_ptr<mysqlshdk::db::IResult> *out_result,
     mysqlshdk::db::Error *out_error) {
   try {
-    *out_result = m_mysql->query(s);
+    *out_result = session()->query(s);
     return 0;
   } catch (const mysqlshdk::db::Error &e) {
     if (out_error) *out_error = e;
@@ -491,7 +491,7 @@ int Schema_dumper::query_no_throw(
 std::shared_ptr<mysqlshdk::db::IResult> Schema_dumper::query_log_and_throw(
     const std::string &s) {
   try {
-    return m_mysql->query(s);
+    return session()->query(s);
   } catch (const mysqlshdk::db::Error &e) {
     current_console()->print_error("Could not execute '" + s +
                                    "': " + e.format());
@@ -502,7 +502,7 @@ std::shared_ptr<mysqlshdk::db::IResult> Schema_dumper::query_log_and_throw(
 std::shared_ptr<mysqlshdk::db::IResult> Schema_dumper::query_log_error(
     const std::string &sql, const std::string &schema,
     const std::string &table) const {
-  return m_mysql->queryf(sql, schema, table);
+  return session()->queryf(sql, schema, table);
 }
 
 int Schema_dumper::query_with_binary_charset(
@@ -559,15 +559,56 @@ void Schema_dumper::fetch_db_collation(const std::string &db,
   @returns  whether there was an error or not
 */
 void Schema_dumper::switch_character_set_results(const char *cs_name) {
+  // the change is deferred until the next statement is executed, consecutive
+  // switches back and forth between statements cost no round trips
+  m_character_set_results = cs_name;
+}
+
+void Schema_dumper::apply_character_set_results() const {
+  if (m_character_set_results.empty() ||
+      m_character_set_results == m_session_character_set_results) {
+    return;
+  }
+
   try {
-    m_mysql->executef("SET SESSION character_set_results = ?", cs_name);
+    m_mysql->executef("SET SESSION character_set_results = ?",
+                      m_character_set_results);
   } catch (const mysqlshdk::db::Error &e) {
-    THROW_ERROR(SHERR_DUMP_SD_CHARACTER_SET_RESULTS_ERROR, cs_name);
+    THROW_ERROR(SHERR_DUMP_SD_CHARACTER_SET_RESULTS_ERROR,
+                m_character_set_results.c_str());
   }
+
+  m_session_character_set_results = m_character_set_results;
+}
+
+const std::shared_ptr<mysqlshdk::db::ISession> &Schema_dumper::session()
+    const {
+  apply_character_set_results();
+  return m_mysql;
 }
 
+void Schema_dumper::restore_session_state() { apply_character_set_results(); }
+
 void Schema_dumper::use(const std::string &db) const {
-  m_mysql->executef("USE !", db);
+  if (m_current_schema == db) {
+    return;
+  }
+
+  session()->executef("USE !", db);
+  m_current_schema = db;
+}
+
+int Schema_dumper::set_quote_show_create() {
+  if (m_quote_show_create) {
+    return 0;
+  }
+
+  if (execute_no_throw("SET SQL_QUOTE_SHOW_CREATE=1")) {
+    return 1;
+  }
+
+  m_quote_show_create = true;
+  return 0;
 }
 
 void Schema_dumper::unescape(IFile *file, std::string_view s) {
@@ -1218,7 +1259,7 @@ std::vector<Schema_dumper::Issue> Schema_dumper::get_table_structure(
 
   result_table = shcore::quote_identifier(table);
 
-  if (!execute_no_throw("SET SQL_QUOTE_SHOW_CREATE=1")) {
+  if (!set_quote_show_create()) {
     /* using SHOW CREATE statement */
     if (!skip_ddl) {
       /* Make an sql-file, if path was given iow. option -T was given */
@@ -2180,8 +2221,8 @@ char Schema_dumper::check_if_ignore_table(const std::string &db,
     }
   } else {
     try {
-      res = m_mysql->query("show table status like " +
-                           quote_for_like(table_name));
+      res = session()->query("show table status like " +
+                             quote_for_like(table_name));
     } catch (const mysqlshdk::db::Error &e) {
       if (e.code() != ER_PARSE_ERROR) { /* If old MySQL version */
         log_debug(
@@ -2474,6 +2515,14 @@ Schema_dumper::Schema_dumper(
                 "\n";
 }
 
+Schema_dumper::~Schema_dumper() {
+  try {
+    restore_session_state();
+  } catch (const std::exception &e) {
+    log_warning("Failed to restore the state of the session: %s", e.what());
+  }
+}
+
 void Schema_dumper::dump_all_tablespaces_ddl(IFile *file) {
   dump_all_tablespaces(file);
 }
@@ -2505,7 +2554,7 @@ std::vector<Schema_dumper::Issue> Schema_dumper::dump_schema_ddl(
           snprintf(qbuf, sizeof(qbuf), "SHOW CREATE DATABASE IF NOT EXISTS %s",
                    qdatabase.c_str());
 
-      auto result = m_mysql->querys(qbuf, qlen);
+      auto result = session()->querys(qbuf, qlen);
 
       if (opt_drop_database)
         fprintf(file, "\n/*!40000 DROP DATABASE IF EXISTS %s*/;\n",
@@ -3196,7 +3245,7 @@ std::vector<shcore::Account> Schema_dumper::get_roles(
 
   try {
     // check if server supports roles
-    m_mysql->query("SELECT @@GLOBAL.activate_all_roles_on_login");
+    session()->query("SELECT @@GLOBAL.activate_all_roles_on_login");
   } catch (const mysqlshdk::db::Error &e) {
     if (ER_UNKNOWN_SYSTEM_VARIABLE == e.code()) {
       // roles are not supported
@@ -3405,7 +3454,7 @@ std::vector<shcore::Account> Schema_dumper::fetch_users(
   }
 
   auto users_res = log_error ? query_log_and_throw(select + where_filter)
-                             : m_mysql->query(select + where_filter);
+                             : session()->query(select + where_filter);
 
   std::set<shcore::Account> users;
 
@@ -3422,7 +3471,7 @@ std::vector<shcore::Account> Schema_dumper::fetch_users(
 
 std::string Schema_dumper::gtid_executed(bool quiet) {
   try {
-    const auto result = m_mysql->query("SELECT @@GLOBAL.GTID_EXECUTED;");
+    const auto result = session()->query("SELECT @@GLOBAL.GTID_EXECUTED;");
 
     if (const auto row = result->fetch_one()) {
       return row->get_string(0);
@@ -3443,7 +3492,7 @@ Instance_cache::Binlog Schema_dumper::binlog(bool quiet) {
   Instance_cache::Binlog binlog;
 
   try {
-    const auto result = m_mysql->query(shcore::str_format(
+    const auto result = session()->query(shcore::str_format(
         "SHOW %s STATUS", mysqlshdk::mysql::get_binary_logs_keyword(
                               m_mysql->get_server_version(), true)
                               .c_str()));
@@ -3466,7 +3515,7 @@ Instance_cache::Binlog Schema_dumper::binlog(bool quiet) {
 }
 
 Instance_cache::Server_version Schema_dumper::server_version() const {
-  const auto result = m_mysql->query("SELECT @@GLOBAL.VERSION;");
+  const auto result = session()->query("SELECT @@GLOBAL.VERSION;");
   Instance_cache::Server_version ret_val;
 
   if (const auto row = result->fetch_one()) {
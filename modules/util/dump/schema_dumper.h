@@ -94,6 +94,14 @@ class Schema_dumper {
                          const std::vector<std::string>
                              &mysqlaas_supported_charsets = {"utf8mb4"});
 
+  Schema_dumper(const Schema_dumper &) = delete;
+  Schema_dumper(Schema_dumper &&) = delete;
+
+  Schema_dumper &operator=(const Schema_dumper &) = delete;
+  Schema_dumper &operator=(Schema_dumper &&) = delete;
+
+  ~Schema_dumper();
+
   static std::vector<User_statements> preprocess_users_script(
       const std::string &script,
       const std::function<bool(const std::string &)> &include_user_cb,
@@ -156,6 +164,13 @@ class Schema_dumper {
 
   bool partial_revokes() const;
 
+  /**
+   * Applies any pending changes to the session variables, restoring them to
+   * the values expected by other users of the session. Called automatically
+   * when the dumper is destroyed.
+   */
+  void restore_session_state();
+
  public:
   // Config options
   bool opt_force = false;
@@ -240,6 +255,13 @@ class Schema_dumper {
 
   bool m_non_existing_definer_reported = false;
 
+  // state of the session, used to avoid redundant round trips when the same
+  // dumper is used to dump multiple objects
+  mutable std::string m_current_schema;
+  std::string m_character_set_results;
+  mutable std::string m_session_character_set_results;
+  bool m_quote_show_create = false;
+
  private:
   int execute_no_throw(const std::string &s,
                        mysqlshdk::db::Error *out_error = nullptr);
@@ -266,8 +288,14 @@ class Schema_dumper {
 
   void switch_character_set_results(const char *cs_name);
 
+  void apply_character_set_results() const;
+
+  const std::shared_ptr<mysqlshdk::db::ISession> &session() const;
+
   void use(const std::string &db) const;
 
+  int set_quote_show_create();
+
   void unescape(IFile *file, std::string_view s);
 
   std::string quote_for_like(const std::string &name_);
@@ -25,6 +25,8 @@
 
 #include <utility>
 
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+
 namespace mysqlsh {
 namespace dump {
 
@@ -90,8 +92,8 @@ Text_dump_writer::Text_dump_writer(const import_table::Dialect &dialect)
 
 void Text_dump_writer::store_preamble(
     const std::vector<mysqlshdk::db::Column> &metadata,
-    const std::vector<Encoding_type> &pre_encoded_columns) {
-  read_metadata(metadata, pre_encoded_columns);
+    const std::vector<Encoding_type> &encoded_columns) {
+  read_metadata(metadata, encoded_columns);
 
   // no preamble
 }
@@ -112,7 +114,7 @@ void Text_dump_writer::store_postamble() {
 
 void Text_dump_writer::read_metadata(
     const std::vector<mysqlshdk::db::Column> &metadata,
-    const std::vector<Encoding_type> &pre_encoded_columns) {
+    const std::vector<Encoding_type> &encoded_columns) {
   m_num_fields = static_cast<uint32_t>(metadata.size());
 
   m_is_string_type.clear();
@@ -124,6 +126,9 @@ void Text_dump_writer::read_metadata(
   m_needs_escape.clear();
   m_needs_escape.resize(m_num_fields);
 
+  m_encoding.clear();
+  m_encoding.resize(m_num_fields, Encoding_type::NONE);
+
   std::size_t fixed_length =
       m_dialect.lines_starting_by.length() + m_line_terminator.length();
 
@@ -145,10 +150,12 @@ void Text_dump_writer::read_metadata(
     if (m_is_number_type[i]) {
       m_needs_escape[i] = m_numbers_need_escape;
     } else {
-      if (pre_encoded_columns.size() == metadata.size()) {
-        if (pre_encoded_columns[i] == Encoding_type::BASE64)
+      if (encoded_columns.size() == metadata.size()) {
+        m_encoding[i] = encoded_columns[i];
+
+        if (encoded_columns[i] == Encoding_type::BASE64)
           m_needs_escape[i] = m_base64_need_escape;
-        else if (pre_encoded_columns[i] == Encoding_type::HEX)
+        else if (encoded_columns[i] == Encoding_type::HEX)
           m_needs_escape[i] = m_hex_need_escape;
       }
     }
@@ -197,12 +204,28 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
   } else {
     quote_field(idx);
 
-    if (!m_escape || m_needs_escape[idx] == Escape_type::NONE) {
+    const auto encode = Encoding_type::NONE != m_encoding[idx];
+    const auto escape = m_escape && m_needs_escape[idx] != Escape_type::NONE;
+
+    if (encode && escape) {
+      // encoded data needs to be escaped, use a temporary buffer
+      if (Encoding_type::BASE64 == m_encoding[idx]) {
+        m_encoded_field.resize(shcore::base64_encoded_length(length));
+        shcore::encode_base64({data, length}, m_encoded_field.data());
+      } else {
+        m_encoded_field.resize(2 * length);
+        shcore::encode_hex({data, length}, m_encoded_field.data());
+      }
+
+      data = m_encoded_field.data();
+      length = m_encoded_field.length();
+    }
+
+    if (encode && !escape) {
+      encode_field(idx, data, length);
+    } else if (!escape) {
       buffer()->will_write(length);
       buffer()->append(data, length);
-    } else if (m_escape && m_needs_escape[idx] == Escape_type::BASE64 &&
-               (length < 76 || data[76] == '\n')) {
-      buffer()->write_base64_data(data, length);
     } else {
       buffer()->will_write(2 * length);
       const auto end = data + length;
@@ -282,6 +305,15 @@ void Text_dump_writer::store_null() {
   buffer()->append(m_null.c_str(), length);
 }
 
+void Text_dump_writer::encode_field(uint32_t idx, const char *data,
+                                    std::size_t length) {
+  if (Encoding_type::BASE64 == m_encoding[idx]) {
+    buffer()->append_base64(data, length);
+  } else {
+    buffer()->append_hex(data, length);
+  }
+}
+
 void Text_dump_writer::finish_row() {
   buffer()->append_fixed(m_line_terminator);
 }
@@ -34,6 +34,16 @@
 namespace mysqlsh {
 namespace dump {
 
+/**
+ * Generic writer which handles any dialect, checking its settings at runtime.
+ *
+ * The dumper uses Dialect_dump_writer for the predefined dialects and
+ * Custom_dialect_dump_writer for all the other ones. This class is not used
+ * in production, it is kept on purpose as the reference implementation: unit
+ * tests verify that the output of the specialized writers is identical to its
+ * output, and it is the baseline of the dump writer benchmark. Changes to the
+ * output format need to be applied here first.
+ */
 class Text_dump_writer : public Dump_writer {
  public:
   Text_dump_writer() = default;
@@ -50,14 +60,14 @@ class Text_dump_writer : public Dump_writer {
  private:
   void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns) override;
+      const std::vector<Encoding_type> &encoded_columns) override;
 
   void store_row(const mysqlshdk::db::IRow *row) override;
 
   void store_postamble() override;
 
   void read_metadata(const std::vector<mysqlshdk::db::Column> &metadata,
-                     const std::vector<Encoding_type> &pre_encoded_columns);
+                     const std::vector<Encoding_type> &encoded_columns);
 
   void start_row();
 
@@ -67,6 +77,8 @@ class Text_dump_writer : public Dump_writer {
 
   void store_null();
 
+  void encode_field(uint32_t idx, const char *data, std::size_t length);
+
   void finish_row();
 
   import_table::Dialect m_dialect;
@@ -85,7 +97,7 @@ class Text_dump_writer : public Dump_writer {
 
   Escape_type m_numbers_need_escape = Escape_type::NONE;
   Escape_type m_hex_need_escape = Escape_type::NONE;
-  Escape_type m_base64_need_escape = Escape_type::BASE64;
+  Escape_type m_base64_need_escape = Escape_type::NONE;
 
   uint32_t m_num_fields;
 
@@ -95,6 +107,11 @@ class Text_dump_writer : public Dump_writer {
   std::vector<int> m_is_number_type;
 
   std::vector<Escape_type> m_needs_escape;
+
+  std::vector<Encoding_type> m_encoding;
+
+  // holds an encoded value which needs to be escaped
+  std::string m_encoded_field;
 };
 
 }  // namespace dump
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/character_set.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAVE_CHARACTER_SET_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+#include <stdexcept>
+
+namespace mysqlsh {
+namespace import_table {
+
+#ifdef HAVE_CHARACTER_SET_SSE2
+namespace {
+
+inline std::size_t first_bit(int mask) noexcept {
+#ifdef _WIN32
+  unsigned long x = 0;
+  (void)_BitScanForward(&x, static_cast<unsigned long>(mask));
+  return x;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+}  // namespace
+#endif  // HAVE_CHARACTER_SET_SSE2
+
+Character_set::Character_set(const std::string &chars) {
+  for (const auto c : chars) {
+    if (contains(c)) {
+      continue;
+    }
+
+    if (k_max_size == m_size) {
+      throw std::invalid_argument("Character_set: too many characters: '" +
+                                  chars + "'");
+    }
+
+    m_table[static_cast<unsigned char>(c)] = true;
+    m_chars[m_size++] = c;
+  }
+
+  for (auto i = m_size; i < k_max_size; ++i) {
+    m_chars[i] = m_chars[0];
+  }
+}
+
+std::size_t Character_set::find_first_of(const char *data,
+                                         std::size_t length) const noexcept {
+  if (0 == m_size) {
+    return length;
+  }
+
+  std::size_t offset = 0;
+
+#ifdef HAVE_CHARACTER_SET_SSE2
+  constexpr std::size_t k_block_size = sizeof(__m128i);
+
+  if (length >= k_block_size) {
+    const auto c0 = _mm_set1_epi8(m_chars[0]);
+    const auto c1 = _mm_set1_epi8(m_chars[1]);
+    const auto c2 = _mm_set1_epi8(m_chars[2]);
+    const auto c3 = _mm_set1_epi8(m_chars[3]);
+
+    for (; offset + k_block_size <= length; offset += k_block_size) {
+      const auto block =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+      const auto matches =
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, c0),
+                                    _mm_cmpeq_epi8(block, c1)),
+                       _mm_or_si128(_mm_cmpeq_epi8(block, c2),
+                                    _mm_cmpeq_epi8(block, c3)));
+      const auto mask = _mm_movemask_epi8(matches);
+
+      if (mask) {
+        return offset + first_bit(mask);
+      }
+    }
+  }
+#endif  // HAVE_CHARACTER_SET_SSE2
+
+  return offset + find_first_of_scalar(data + offset, length - offset);
+}
+
+std::size_t Character_set::find_first_of_scalar(
+    const char *data, std::size_t length) const noexcept {
+  std::size_t offset = 0;
+
+  while (offset < length && !contains(data[offset])) {
+    ++offset;
+  }
+
+  return offset;
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_CHARACTER_SET_H_
+#define MODULES_UTIL_IMPORT_TABLE_CHARACTER_SET_H_
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * A small set of characters which can be quickly located in a block of data.
+ * When SSE2 is available, data is classified 16 bytes at a time.
+ */
+class Character_set final {
+ public:
+  static constexpr std::size_t k_max_size = 4;
+
+  Character_set() = delete;
+
+  /**
+   * Creates the set.
+   *
+   * @param chars Characters in the set, at most k_max_size distinct ones.
+   *
+   * @throws std::invalid_argument if there are too many characters
+   */
+  explicit Character_set(const std::string &chars);
+
+  Character_set(const Character_set &) = default;
+  Character_set(Character_set &&) = default;
+
+  Character_set &operator=(const Character_set &) = default;
+  Character_set &operator=(Character_set &&) = default;
+
+  ~Character_set() = default;
+
+  inline bool contains(char c) const noexcept {
+    return m_table[static_cast<unsigned char>(c)];
+  }
+
+  /**
+   * Finds the first character of the given data which belongs to this set.
+   *
+   * @param data Data to be searched.
+   * @param length Length of data.
+   *
+   * @returns offset of the character, or length if not found
+   */
+  std::size_t find_first_of(const char *data,
+                            std::size_t length) const noexcept;
+
+  /**
+   * Same as find_first_of(), but checks one byte at a time.
+   */
+  std::size_t find_first_of_scalar(const char *data,
+                                   std::size_t length) const noexcept;
+
+ private:
+  std::array<bool, 256> m_table{};
+  // unused slots hold copies of the first character
+  std::array<char, k_max_size> m_chars{};
+  std::size_t m_size = 0;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_CHARACTER_SET_H_
@@ -164,6 +164,33 @@ void Import_table::chunk_file() {
 void Import_table::build_queue() {
   m_total_file_size = 0;
 
+  // compressed files are normally loaded by a single worker each, if there are
+  // not enough of them to keep all workers busy, they are decompressed and
+  // scanned for rows here, and their chunks are loaded by all the workers
+  struct Compressed_file {
+    File_import_info task;
+    std::string path;
+    std::size_t size;
+  };
+
+  std::vector<Compressed_file> compressed_files;
+
+  const auto add_task = [&](File_import_info task, std::string path,
+                            std::size_t size) {
+    task.range_read = false;
+    task.is_guard = false;
+
+    m_total_file_size += size;
+
+    if (task.file->is_compressed()) {
+      m_has_compressed_files = true;
+      compressed_files.emplace_back(
+          Compressed_file{std::move(task), std::move(path), size});
+    } else {
+      push_task(std::move(task));
+    }
+  };
+
   for (const auto &glob_item : m_opt.filelist_from_user()) {
     if (glob_item.find('*') != std::string::npos ||
         glob_item.find('?') != std::string::npos) {
@@ -183,18 +210,14 @@ void Import_table::build_queue() {
       for (const auto &file_info : list_files) {
         File_import_info task;
         task.file = m_opt.create_file_handle(dir->file(file_info.name()));
-        task.range_read = false;
-        task.is_guard = false;
 
-        m_total_file_size += file_info.size();
-        m_has_compressed_files |= task.file->is_compressed();
-        m_range_queue.push(std::move(task));
+        add_task(std::move(task),
+                 dir->join_path(dir->full_path().real(), file_info.name()),
+                 file_info.size());
       }
     } else {
       File_import_info task;
       task.file = m_opt.create_file_handle(glob_item);
-      task.range_read = false;
-      task.is_guard = false;
 
       if (!task.file->exists()) {
         std::string errmsg{"File " + task.file->full_path().masked() +
@@ -204,15 +227,47 @@ void Import_table::build_queue() {
         continue;
       }
 
-      m_total_file_size += task.file->file_size();
-      m_has_compressed_files |= task.file->is_compressed();
-      m_range_queue.push(std::move(task));
+      const auto size = task.file->file_size();
+      add_task(std::move(task), glob_item, size);
+    }
+  }
+
+  const auto threads = static_cast<std::size_t>(m_opt.threads_size());
+
+  if (m_opt.dialect_supports_chunking() && !compressed_files.empty() &&
+      compressed_files.size() < threads) {
+    // uncompressed size is not known until all files are scanned
+    m_prog_total_file_bytes = 0;
+
+    std::size_t total_size = m_total_file_size;
+
+    for (const auto &file : compressed_files) {
+      if (interrupted()) {
+        break;
+      }
+
+      total_size -= file.size;
+      total_size += scan_file(file.path, file.size);
+      ++m_scanned_files;
+    }
+
+    m_prog_total_file_bytes = total_size;
+  } else {
+    for (auto &file : compressed_files) {
+      push_task(std::move(file.task));
     }
   }
 
   m_range_queue.shutdown(m_opt.threads_size());
 }
 
+void Import_table::push_task(File_import_info task) {
+  // counter is increased first, so that it's never lower than the number of
+  // processed tasks
+  ++m_scheduled_tasks;
+  m_range_queue.push(std::move(task));
+}
+
 void Import_table::import() {
   progress_setup();
   shcore::on_leave_scope cleanup_progress([this]() { progress_shutdown(); });
@@ -221,11 +276,29 @@ void Import_table::import() {
   if (m_opt.is_multifile()) {
     build_queue();
   } else {
-    // NOTE: m_total_file_size needs to be set below
     m_has_compressed_files = m_opt.is_compressed(m_opt.single_file());
 
     if (m_opt.dialect_supports_chunking()) {
-      scan_file();
+      m_total_file_size = m_opt.file_size();
+
+      // If file is compressed, the total size needs to correspond to the
+      // uncompressed size, because otherwise progress will go over 100%
+      // (Load_data_worker works with an in-memory file and has no information
+      // regarding the size of compressed reads). We set it here to zero and
+      // update it once its known. When total is zero, progress is displayed as
+      // follows:
+      //   ?% (58.11 MB / ?), 28.15 MB/s
+      if (m_has_compressed_files) {
+        m_prog_total_file_bytes = 0;
+      }
+
+      const auto total_size = scan_file(m_opt.single_file(), m_total_file_size);
+
+      if (m_has_compressed_files) {
+        m_prog_total_file_bytes = total_size;
+      }
+
+      m_range_queue.shutdown(m_opt.threads_size());
     } else {
       build_queue();
     }
@@ -244,9 +317,15 @@ std::string Import_table::import_summary() const {
   std::string msg;
 
   if (m_opt.is_multifile()) {
-    plural = m_stats.total_files_processed != 1;
+    // each chunk of a scanned file was counted as a separate file
+    const std::size_t files = m_stats.total_files_processed -
+                              std::min<std::size_t>(
+                                  m_stats.total_files_processed,
+                                  m_scheduled_chunks) +
+                              m_scanned_files;
+    plural = files != 1;
 
-    msg += std::to_string(m_stats.total_files_processed) + " file";
+    msg += std::to_string(files) + " file";
 
     if (plural) {
       msg += 's';
@@ -279,7 +358,8 @@ std::string Import_table::rows_affected_info() {
          ": " + m_stats.to_string();
 }
 
-void Import_table::scan_file() {
+std::size_t Import_table::scan_file(const std::string &path,
+                                   std::size_t file_size) {
   using mysqlshdk::storage::Mode;
   using mysqlshdk::storage::in_memory::Allocated_file;
   using mysqlshdk::storage::in_memory::Allocator;
@@ -288,23 +368,31 @@ void Import_table::scan_file() {
   using mysqlshdk::storage::in_memory::Threaded_file_config;
   using mysqlshdk::storage::in_memory::Virtual_file_adapter;
 
-  // if file is big enough, we fetch it in 1MB chunks
-  static constexpr std::size_t k_one_mb = 1024 * 1024;
-  const std::size_t block_size =
-      m_opt.file_size() >= k_one_mb * m_opt.threads_size() &&
-              m_opt.bytes_per_chunk() >= k_one_mb
-          ? k_one_mb
-          : 8192;
-  // each thread fetches block_size bytes, a page holds enough memory for all
-  // threads
-  m_allocator = std::make_unique<Allocator>(m_opt.threads_size() * block_size,
-                                            block_size);
+  const auto bytes_per_chunk = m_opt.bytes_per_chunk();
+
+  // allocator is shared by all scanned files, workers may still be loading
+  // chunks of the previous file
+  if (!m_allocator) {
+    // if file is big enough, we fetch it in 1MB chunks
+    static constexpr std::size_t k_one_mb = 1024 * 1024;
+    const std::size_t block_size =
+        file_size >= k_one_mb * m_opt.threads_size() &&
+                bytes_per_chunk >= k_one_mb
+            ? k_one_mb
+            : 8192;
+    // each thread fetches block_size bytes, a page holds enough memory for
+    // all threads
+    m_allocator = std::make_unique<Allocator>(
+        m_opt.threads_size() * block_size, block_size);
+  }
+
+  const auto block_size = m_allocator->block_size();
 
   Threaded_file_config config;
-  config.file_path = m_opt.single_file();
+  config.file_path = path;
   config.config = m_opt.storage_config();
   config.threads = m_opt.threads_size();
-  config.max_memory = m_opt.bytes_per_chunk();
+  config.max_memory = bytes_per_chunk;
   config.allocator = m_allocator.get();
 
   auto source = threaded_file(std::move(config));
@@ -316,14 +404,12 @@ void Import_table::scan_file() {
   });
 
   Scanner scanner{m_opt.dialect(), m_opt.skip_rows_count()};
-  const auto make_chunk = [this]() {
-    return std::make_unique<Allocated_file>(m_opt.single_file(),
-                                            m_allocator.get(), true);
+  const auto make_chunk = [this, &path]() {
+    return std::make_unique<Allocated_file>(path, m_allocator.get(), true);
   };
   std::unique_ptr<Allocated_file> chunk;
   File_import_info info;
   std::size_t extracted_blocks = 0;
-  std::size_t scheduled_chunks = 0;
   const auto schedule_chunk = [&]() {
     while (true) {
       if (interrupted()) {
@@ -331,7 +417,7 @@ void Import_table::scan_file() {
       }
 
       // wait for at least one thread to be available
-      if (scheduled_chunks - m_stats.total_files_processed >=
+      if (m_scheduled_tasks - m_stats.total_files_processed >=
           static_cast<std::size_t>(m_opt.threads_size())) {
         shcore::sleep_ms(100);
       } else {
@@ -350,21 +436,10 @@ void Import_table::scan_file() {
                    std::to_string(file_offset + info.range.first) + ", " +
                    std::to_string(file_offset + info.range.second) + ")";
 
-    m_range_queue.push(std::move(info));
-    ++scheduled_chunks;
+    push_task(std::move(info));
+    ++m_scheduled_chunks;
   };
 
-  // If file is compressed, the total size needs to correspond to the
-  // uncompressed size, because otherwise progress will go over 100%
-  // (Load_data_worker works with an in-memory file and has no information
-  // regarding the size of compressed reads). We set it here to zero and update
-  // it once its known. When total is zero, progress is displayed as follows:
-  //   ?% (58.11 MB / ?), 28.15 MB/s
-  if (m_has_compressed_files) {
-    m_prog_total_file_bytes = 0;
-  }
-
-  m_total_file_size = m_opt.file_size();
   std::size_t total_size = 0;
 
   // skip rows, then schedule blocks
@@ -384,8 +459,8 @@ void Import_table::scan_file() {
 
     if (const auto offset = scanner.scan(block->memory, block->size);
         offset >= 0) {
-      if (!chunk || chunk->size() - info.range.first + offset >=
-                        m_opt.bytes_per_chunk()) {
+      if (!chunk ||
+          chunk->size() - info.range.first + offset >= bytes_per_chunk) {
         if (chunk) {
           if (offset > 0) {
             // row does not start at the beginning, block needs to be duplicated
@@ -424,11 +499,7 @@ void Import_table::scan_file() {
     }
   }
 
-  if (m_has_compressed_files) {
-    m_prog_total_file_bytes = total_size;
-  }
-
-  m_range_queue.shutdown(m_opt.threads_size());
+  return total_size;
 }
 
 }  // namespace import_table
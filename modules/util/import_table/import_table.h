@@ -107,7 +107,19 @@ class Import_table final {
   void build_queue();
   void progress_setup();
   void progress_shutdown();
-  void scan_file();
+  void push_task(File_import_info task);
+
+  /**
+   * Reads the file using background threads (decompressing it if needed),
+   * splits it into chunks at row boundaries and schedules these chunks to be
+   * loaded by the workers.
+   *
+   * @param path Path to the file.
+   * @param file_size Size of the file.
+   *
+   * @returns total size of the (uncompressed) data
+   */
+  std::size_t scan_file(const std::string &path, std::size_t file_size);
 
   inline bool interrupted() const {
     return (m_interrupt && *m_interrupt) || any_exception();
@@ -118,6 +130,12 @@ class Import_table final {
   std::optional<size_t> m_prog_total_file_bytes;
   size_t m_total_file_size = 0;
   bool m_has_compressed_files = false;
+  // number of tasks put in the queue
+  std::size_t m_scheduled_tasks = 0;
+  // number of chunks put in the queue by scan_file()
+  std::size_t m_scheduled_chunks = 0;
+  // number of files which were loaded in chunks, when loading multiple files
+  std::size_t m_scanned_files = 0;
 
   std::unique_ptr<mysqlshdk::storage::in_memory::Allocator> m_allocator;
 
@@ -400,11 +400,15 @@ Connection_options Import_table_options::connection_options() const {
 uint64_t Import_table_option_pack::bytes_per_chunk() const {
   if (m_bytes_per_chunk.has_value()) {
     return *m_bytes_per_chunk;
-  } else {
-    // at this point m_bytes_per_chunk should have a value
-    assert(false);
-    return mysqlshdk::utils::expand_to_bytes(k_default_chunk_size);
   }
+
+  // m_bytes_per_chunk is not set when loading multiple files, compressed files
+  // may still be loaded in chunks, each chunk is loaded in a single transaction
+  if (const auto max_trx_size = max_transaction_size()) {
+    return max_trx_size;
+  }
+
+  return mysqlshdk::utils::expand_to_bytes(k_default_chunk_size);
 }
 
 void Import_table_option_pack::set_bytes_per_chunk(const std::string &value) {
@@ -202,7 +202,7 @@ int Transaction_buffer::consume(char *buffer, unsigned int length) {
 int Transaction_buffer::read(char *buffer, unsigned int length) {
   if (m_options.max_trx_size == 0) {
     // regular read if truncation is not enabled
-    return m_file->read(buffer, length);
+    return read_file(buffer, length);
   }
 
   if (m_options.fast_sub_chunking) {
@@ -215,7 +215,7 @@ int Transaction_buffer::read(char *buffer, unsigned int length) {
     if (!m_eof) {
       auto end = m_data.size();
       m_data.resize(end + count);
-      bytes = m_file->read(&m_data[end], count);
+      bytes = read_file(&m_data[end], count);
       if (bytes <= 0) {
         m_data.resize(end);
         if (bytes == 0) m_eof = true;
@@ -460,7 +460,7 @@ int Transaction_buffer::fast_sub_chunking(char *buffer, unsigned int length) {
   }
 
   auto bytes =
-      m_file->read(buffer, std::min<uint64_t>(length, trx_bytes_left()));
+      read_file(buffer, std::min<uint64_t>(length, trx_bytes_left()));
 
   if (0 == bytes) {
     m_eof = true;
@@ -497,7 +497,7 @@ int Transaction_buffer::fast_sub_chunking(char *buffer, unsigned int length) {
       const auto row_length = handle->pending_write_size();
 
       m_data.resize(row_length);
-      bytes = m_file->read(m_data.data(), row_length);
+      bytes = read_file(m_data.data(), row_length);
 
       // this read should succeed
       assert(static_cast<std::size_t>(bytes) == row_length);
@@ -514,6 +514,16 @@ int Transaction_buffer::fast_sub_chunking(char *buffer, unsigned int length) {
   return bytes;
 }
 
+ssize_t Transaction_buffer::read_file(char *buffer, std::size_t length) {
+  const auto bytes = m_file->read(buffer, length);
+
+  if (bytes > 0 && m_options.checksum) {
+    m_options.checksum->update(buffer, bytes);
+  }
+
+  return bytes;
+}
+
 // ------
 
 int local_infile_init(void **buffer, const char * /* filename */,
@@ -42,6 +42,7 @@
 #include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/xxhash.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -52,6 +53,8 @@ struct Transaction_options {
   std::function<void()> transaction_started;
   std::function<void(uint64_t)> transaction_finished;
   bool fast_sub_chunking = false;
+  // if set, updated with all the data read from the file
+  mysqlshdk::utils::Xxhash64 *checksum = nullptr;
 };
 
 class Transaction_buffer {
@@ -84,6 +87,8 @@ class Transaction_buffer {
  private:
   int fast_sub_chunking(char *buffer, unsigned int length);
 
+  ssize_t read_file(char *buffer, std::size_t length);
+
   int consume(char *buffer, unsigned int length);
 
   int64_t trx_bytes_left() const { return m_options.max_trx_size - m_trx_size; }
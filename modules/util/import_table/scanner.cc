@@ -25,8 +25,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <initializer_list>
 #include <limits>
 #include <stdexcept>
+#include <string>
 
 namespace mysqlsh {
 namespace import_table {
@@ -40,6 +42,18 @@ int first_char(const std::string &s) { return s.length() ? s[0] : k_not_used; }
 
 inline bool used(int c) noexcept { return k_not_used != c; }
 
+std::string used_chars(std::initializer_list<int> chars) {
+  std::string result;
+
+  for (const auto c : chars) {
+    if (used(c)) {
+      result.push_back(static_cast<char>(c));
+    }
+  }
+
+  return result;
+}
+
 }  // namespace
 
 Scanner::Sequence::Sequence(const std::string &s) {
@@ -64,7 +78,12 @@ Scanner::Scanner(const Dialect &dialect, uint64_t skip_rows)
       m_lines_starting_by(dialect.lines_starting_by),
       m_lines_terminated_by(dialect.lines_terminated_by),
       m_enclosed_char(first_char(dialect.fields_enclosed_by)),
-      m_escaped_char(first_char(dialect.fields_escaped_by)) {
+      m_escaped_char(first_char(dialect.fields_escaped_by)),
+      m_field_special_chars(used_chars(
+          {m_escaped_char, m_enclosed_char, m_fields_terminated_by.first,
+           m_lines_terminated_by.first})),
+      m_row_special_chars(
+          used_chars({m_escaped_char, m_lines_terminated_by.first})) {
   if (dialect.lines_terminated_by.empty() ||
       dialect.lines_terminated_by == dialect.fields_terminated_by) {
     throw std::invalid_argument("Scanner: unsupported LINES TERMINATED BY: '" +
@@ -201,10 +220,23 @@ bool Scanner::contains(const Sequence &s) noexcept {
   return false;
 }
 
+bool Scanner::skip_to_any_of(const Character_set &chars) noexcept {
+  if (m_stack_position == m_stack_bottom) {
+    const auto offset = chars.find_first_of(m_data, m_length);
+
+    m_data += offset;
+    m_length -= offset;
+
+    return m_length > 0;
+  }
+
+  return true;
+}
+
 bool Scanner::skip_row() noexcept {
   int chr;
 
-  while (m_length) {
+  while (m_length && skip_to_any_of(m_row_special_chars)) {
     chr = get();
 
     // check for escaped LINES TERMINATED BY sequences
@@ -269,7 +301,7 @@ Scanner::Field_status Scanner::scan_field() noexcept {
     }                                 \
   } while (false)
 
-  while (m_length) {
+  while (m_length && skip_to_any_of(m_field_special_chars)) {
     chr = get();
 
     if (chr == m_escaped_char) {
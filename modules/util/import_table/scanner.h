@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <string>
 
+#include "modules/util/import_table/character_set.h"
 #include "modules/util/import_table/dialect.h"
 
 namespace mysqlsh {
@@ -135,6 +136,16 @@ class Scanner {
    */
   bool skip_line_start() noexcept;
 
+  /**
+   * Skips characters which do not belong to the given set, as long as there
+   * are no characters which were pushed back.
+   *
+   * @param chars Set of characters which need to be processed
+   *
+   * @returns true if there is more data to be processed
+   */
+  bool skip_to_any_of(const Character_set &chars) noexcept;
+
   /**
    * Scans a single field.
    *
@@ -151,6 +162,11 @@ class Scanner {
   int m_enclosed_char;
   int m_escaped_char;
 
+  // characters which may end a field or start an escape sequence
+  Character_set m_field_special_chars;
+  // characters which may end a row or start an escape sequence
+  Character_set m_row_special_chars;
+
   std::string m_stack;
   char *m_stack_bottom;
   char *m_stack_position;
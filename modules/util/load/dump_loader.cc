@@ -28,12 +28,16 @@
 #include <algorithm>
 #include <iterator>
 #include <list>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "modules/mod_utils.h"
+#include "modules/util/common/dump/constants.h"
+#include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/capability.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/import_table/load_data.h"
@@ -42,6 +46,7 @@
 #include "mysqlshdk/include/scripting/shexcept.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/mysql/binlog_reader.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/utils.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
@@ -54,6 +59,7 @@
 #include "mysqlshdk/libs/utils/utils_net.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/version.h"
+#include "mysqlshdk/libs/utils/xxhash.h"
 
 namespace mysqlsh {
 
@@ -671,6 +677,13 @@ void Dump_loader::Worker::Load_chunk_task::load(
     }
   }
 
+  // checksum can be verified only if the whole file is loaded
+  const auto filename = m_file->filename();
+  const auto expected_checksum = m_bytes_to_skip
+                                     ? std::string{}
+                                     : loader->m_dump->chunk_checksum(filename);
+  mysqlshdk::utils::Xxhash64 checksum;
+
   std::atomic<size_t> num_file_bytes_loaded{0};
   import_table::Load_data_worker op(
       import_options, id(), &loader->m_num_bytes_loaded, &num_file_bytes_loaded,
@@ -818,6 +831,10 @@ void Dump_loader::Worker::Load_chunk_task::load(
 
     options.skip_bytes = m_bytes_to_skip;
 
+    if (!expected_checksum.empty()) {
+      options.checksum = &checksum;
+    }
+
     op.execute(session, mysqlshdk::storage::make_file(std::move(m_file), compr),
                options);
   }
@@ -825,6 +842,20 @@ void Dump_loader::Worker::Load_chunk_task::load(
   if (loader->m_thread_exceptions[id()])
     std::rethrow_exception(loader->m_thread_exceptions[id()]);
 
+  if (!expected_checksum.empty()) {
+    const auto actual_checksum = checksum.hex_digest();
+
+    if (!shcore::str_caseeq(expected_checksum, actual_checksum)) {
+      throw std::runtime_error("Checksum mismatch of data file '" + filename +
+                               "', expected: " + expected_checksum +
+                               ", but got: " + actual_checksum +
+                               ", the file is corrupted");
+    }
+
+    log_debug("%sChecksum of data file '%s' is valid", log_id(),
+              filename.c_str());
+  }
+
   bytes_loaded = m_bytes_to_skip + stats.total_data_bytes;
   rows_loaded = stats.total_records;
   loader->m_num_raw_bytes_loaded += raw_bytes_loaded;
@@ -951,6 +982,23 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
       }
     }
 
+    if (memory()) {
+      // use the number of threads and the sort buffer size this task was
+      // scheduled with, index build which does not fit in the sort buffer
+      // writes the sorted runs to innodb_tmpdir
+      const auto query = shcore::str_format(
+          "SET SESSION innodb_ddl_threads = %" PRIu64
+          ", SESSION innodb_ddl_buffer_size = %" PRIu64,
+          weight(), memory());
+
+      try {
+        session->execute(query);
+      } catch (const std::exception &e) {
+        log_warning("%sFailed to set the index build resources: %s", log_id(),
+                    e.what());
+      }
+    }
+
     try {
       auto current = batches.begin();
       const auto end = batches.end();
@@ -1303,6 +1351,10 @@ void Dump_loader::on_dump_end() {
     on_schema_end(schema);
   }
 
+  if (m_dump->is_incremental()) {
+    apply_binlog_changes();
+  }
+
   const auto console = current_console();
   console->print_status("Executing common postamble SQL");
 
@@ -1777,6 +1829,7 @@ size_t Dump_loader::handle_worker_events(
       case Worker_event::READY:
         if (const auto task = event.worker->current_task()) {
           m_current_weight -= task->weight();
+          m_current_memory -= task->memory();
           task->done();
         }
         break;
@@ -1805,13 +1858,20 @@ size_t Dump_loader::handle_worker_events(
         assert(!m_pending_tasks.empty());
 
         const auto pending_weight = m_pending_tasks.top()->weight();
+        const auto pending_memory = m_pending_tasks.top()->memory();
 
         if (m_current_weight + pending_weight > thread_count) {
           // the task is too heavy, wait till more threads are idle
           idle_workers.push_back(event.worker);
+        } else if (m_current_memory + pending_memory >
+                   m_options.index_build_memory()) {
+          // the task does not fit in the memory budget, wait till other index
+          // builds finish
+          idle_workers.push_back(event.worker);
         } else {
           event.worker->schedule(m_pending_tasks.pop_top());
           m_current_weight += pending_weight;
+          m_current_memory += pending_memory;
         }
       }
     }
@@ -2684,7 +2744,12 @@ void Dump_loader::execute_table_ddl_tasks() {
   const auto pool = thread_pool_ptr.get();
   shcore::Synchronized_queue<std::unique_ptr<Worker::Task>> worker_tasks;
 
-  const auto handle_ddl_files = [this, pool, &worker_tasks, &ddl_to_execute](
+  // deduplicated DDL is shared by multiple tables, it's fetched only once
+  std::mutex shared_scripts_mutex;
+  std::unordered_map<std::string, std::string> shared_scripts;
+
+  const auto handle_ddl_files = [this, pool, &worker_tasks, &ddl_to_execute,
+                                 &shared_scripts_mutex, &shared_scripts](
                                     const std::string &s,
                                     std::list<Dump_reader::Name_and_file> *list,
                                     bool placeholder,
@@ -2719,12 +2784,32 @@ void Dump_loader::execute_table_ddl_tasks() {
         ++ddl_to_execute;
 
         pool->add_task(
-            [file = std::move(item.second), s, table = item.first]() {
+            [file = std::move(item.second), s, table = item.first,
+             &shared_scripts_mutex, &shared_scripts]() {
               log_debug("Fetching table DDL for %s.%s", s.c_str(),
                         table.c_str());
+
+              const auto name = file->filename();
+              const auto shared = dump::common::is_ddl_filename(name);
+
+              if (shared) {
+                std::lock_guard lock{shared_scripts_mutex};
+
+                if (const auto it = shared_scripts.find(name);
+                    shared_scripts.end() != it) {
+                  return it->second;
+                }
+              }
+
               file->open(mysqlshdk::storage::Mode::READ);
               auto script = mysqlshdk::storage::read_file(file.get());
               file->close();
+
+              if (shared) {
+                std::lock_guard lock{shared_scripts_mutex};
+                shared_scripts.emplace(name, script);
+              }
+
               return script;
             },
             [s, table = item.first, placeholder, &worker_tasks, status,
@@ -3036,6 +3121,9 @@ void Dump_loader::execute_tasks() {
 
   check_tables_without_primary_key();
 
+  disable_redo_log();
+  shcore::on_leave_scope cleanup_redo_log([this]() { enable_redo_log(); });
+
   size_t num_idle_workers = 0;
 
   do {
@@ -3099,6 +3187,7 @@ void Dump_loader::execute_tasks() {
   } while (!m_worker_interrupt);
 
   if (!m_worker_interrupt) {
+    enable_redo_log();
     on_dump_end();
     m_load_log->cleanup();
   }
@@ -3106,10 +3195,84 @@ void Dump_loader::execute_tasks() {
   log_debug("Import done");
 }
 
+void Dump_loader::disable_redo_log() {
+  if (!m_options.disable_redo_log() || m_options.dry_run()) {
+    return;
+  }
+
+  const auto console = current_console();
+  const auto fall_back = [&console](const std::string &reason) {
+    console->print_note("The redo log is not going to be disabled, " + reason +
+                        ", data is going to be loaded normally.");
+  };
+
+  if (m_options.target_server_version() < Version(8, 0, 21)) {
+    fall_back("target server does not support it");
+    return;
+  }
+
+  if (m_resuming) {
+    fall_back("the load is being resumed");
+    return;
+  }
+
+  if (query("SELECT VARIABLE_VALUE = 'OFF' FROM "
+            "performance_schema.global_status "
+            "WHERE variable_name = 'Innodb_redo_log_enabled'")
+          ->fetch_one_or_throw()
+          ->get_int(0, 0)) {
+    log_info("The redo log is already disabled");
+    return;
+  }
+
+  // if server crashes while redo log is disabled, the instance is lost, this
+  // is acceptable only if it does not hold any data besides the dump
+  if (query("SELECT COUNT(*) FROM information_schema.schemata WHERE "
+            "schema_name NOT IN ('information_schema', 'mysql', "
+            "'performance_schema', 'sys')")
+          ->fetch_one_or_throw()
+          ->get_uint(0)) {
+    fall_back("the target instance is not empty");
+    return;
+  }
+
+  try {
+    execute("ALTER INSTANCE DISABLE INNODB REDO_LOG");
+  } catch (const shcore::Error &e) {
+    fall_back("failed to disable it: " + e.format());
+    return;
+  }
+
+  m_redo_log_disabled = true;
+
+  console->print_warning(
+      "The redo log is disabled while the dump is loaded, MySQL is not crash "
+      "safe until it is enabled again. If the server stops unexpectedly, the "
+      "instance needs to be recreated.");
+}
+
+void Dump_loader::enable_redo_log() {
+  if (!m_redo_log_disabled) {
+    return;
+  }
+
+  try {
+    execute("ALTER INSTANCE ENABLE INNODB REDO_LOG");
+    m_redo_log_disabled = false;
+    log_info("The redo log is enabled");
+  } catch (const std::exception &e) {
+    current_console()->print_error(
+        std::string{"Failed to enable the redo log, please enable it "
+                    "manually: "} +
+        e.what());
+  }
+}
+
 void Dump_loader::wait_for_metadata() {
   const auto start_time = std::chrono::steady_clock::now();
   const auto console = current_console();
   bool waited = false;
+  shcore::on_leave_scope reset_idle_scans([this]() { m_idle_dump_scans = 0; });
 
   // we need to have the whole metadata before we proceed with the load
 
@@ -3134,6 +3297,8 @@ void Dump_loader::wait_for_metadata() {
       waited = true;
     }
 
+    // workers are not running yet
+    ++m_idle_dump_scans;
     wait_for_dump(start_time);
   }
 }
@@ -3142,6 +3307,7 @@ bool Dump_loader::scan_for_more_data(bool wait) {
   const auto start_time = std::chrono::steady_clock::now();
   const auto console = current_console();
   bool waited = false;
+  shcore::on_leave_scope reset_idle_scans([this]() { m_idle_dump_scans = 0; });
 
   // if there are still idle workers, check if there's more that was dumped
   while (m_dump->status() != Dump_reader::Status::COMPLETE &&
@@ -3165,6 +3331,8 @@ bool Dump_loader::scan_for_more_data(bool wait) {
         waited = true;
       }
 
+      // this is called once all the workers are done with their tasks
+      ++m_idle_dump_scans;
       wait_for_dump(start_time);
     }
   }
@@ -3194,14 +3362,14 @@ void Dump_loader::wait_for_dump(
     return;
   }
 
-  if (m_options.dump_wait_timeout_ms() < 1000) {
-    shcore::sleep_ms(m_options.dump_wait_timeout_ms());
+  const auto interval = std::min(m_options.dump_rescan_interval_ms(),
+                                 m_options.dump_wait_timeout_ms());
+
+  if (interval < 1000) {
+    shcore::sleep_ms(interval);
   } else {
-    // wait for at most 5s at a time and try again
-    for (uint64_t j = 0;
-         j < std::min<uint64_t>(5000, m_options.dump_wait_timeout_ms()) &&
-         !m_worker_interrupt;
-         j += 1000) {
+    // wait for at most the rescan interval at a time and try again
+    for (uint64_t j = 0; j < interval && !m_worker_interrupt; j += 1000) {
       shcore::sleep_ms(1000);
     }
   }
@@ -3765,8 +3933,46 @@ Dump_loader::Task_ptr Dump_loader::recreate_indexes(
 
   DBUG_EXECUTE_IF("dump_loader_force_index_weight", { weight = 4; });
 
-  return std::make_unique<Worker::Index_recreation_task>(schema, table, indexes,
-                                                         weight);
+  return std::make_unique<Worker::Index_recreation_task>(
+      schema, table, indexes, weight, index_build_buffer_size(
+                                          schema, table, *indexes, weight));
+}
+
+uint64_t Dump_loader::index_build_buffer_size(
+    const std::string &schema, const std::string &table,
+    const compatibility::Deferred_statements::Index_info &indexes,
+    uint64_t weight) const {
+  const auto default_size = m_options.ddl_buffer_size();
+
+  if (!default_size) {
+    // server does not allow to set the buffer size
+    return 0;
+  }
+
+  const auto budget = m_options.index_build_memory();
+  weight = std::min(weight, m_options.threads_count());
+
+  // each index is sorted separately, we assume that an index entry (key and
+  // primary key columns) takes half of the row
+  const uint64_t sort_size =
+      m_dump->table_data_size(schema, table) * indexes.size() / 2;
+  // a task can use the share of the budget proportional to its threads, but
+  // never less than the default size, unless the whole budget is smaller
+  const auto share = std::max(budget / m_options.threads_count() * weight,
+                              default_size);
+  const auto size =
+      std::min(std::clamp(sort_size, default_size, share), budget);
+
+  log_debug(
+      "Estimated index sort data of `%s`.`%s`: %s, using %" PRIu64
+      " threads and %s of sort buffer%s",
+      schema.c_str(), table.c_str(),
+      mysqlshdk::utils::format_bytes(sort_size).c_str(), weight,
+      mysqlshdk::utils::format_bytes(size).c_str(),
+      sort_size > size ? ", remaining data is going to be written to tmpdir"
+                       : "");
+
+  return size;
 }
 
 Dump_loader::Task_ptr Dump_loader::analyze_table(
@@ -3881,6 +4087,132 @@ void Dump_loader::load_users() {
   m_loaded_accounts = all_accounts.size() - ignored_accounts.size();
 }
 
+void Dump_loader::apply_binlog_changes() {
+  const auto &files = m_dump->binlog_chunk_files();
+  const auto console = current_console();
+
+  if (files.empty()) {
+    console->print_status("The incremental dump does not contain any changes");
+    return;
+  }
+
+  console->print_status(shcore::str_format(
+      "Applying changes from %zu binary log chunk%s", files.size(),
+      files.size() == 1 ? "" : "s"));
+
+  if (m_options.dry_run()) {
+    return;
+  }
+
+  using mysqlshdk::mysql::Binlog_statement_target;
+
+  // changes to the system schemas and to the objects which were excluded by
+  // the filtering options are skipped
+  const auto include = [this](const Binlog_statement_target &target) {
+    if (std::find(dump::common::k_excluded_schemas.begin(),
+                  dump::common::k_excluded_schemas.end(),
+                  target.schema) != dump::common::k_excluded_schemas.end()) {
+      return false;
+    }
+
+    switch (target.type) {
+      case Binlog_statement_target::Type::NONE:
+        // account management statements
+        return m_options.load_users();
+
+      case Binlog_statement_target::Type::SCHEMA:
+        return m_dump->include_schema(target.schema);
+
+      case Binlog_statement_target::Type::TABLE:
+        return m_dump->include_schema(target.schema) &&
+               m_dump->include_table(target.schema, target.name);
+
+      case Binlog_statement_target::Type::ROUTINE:
+        return m_dump->include_schema(target.schema) &&
+               m_dump->include_routine(target.schema, target.name);
+
+      case Binlog_statement_target::Type::EVENT:
+        return m_dump->include_schema(target.schema) &&
+               m_dump->include_event(target.schema, target.name);
+    }
+
+    return true;
+  };
+
+  mysqlshdk::mysql::Binlog_statement_builder builder{
+      [this](const std::string &sql) { execute(sql); }, include};
+
+  for (std::size_t i = 0; i < files.size() && !m_worker_interrupt; ++i) {
+    const auto status = m_load_log->binlog_chunk_status(i);
+
+    if (Load_progress_log::DONE == status) {
+      log_info("Binary log chunk %s was already applied", files[i].c_str());
+      continue;
+    }
+
+    // transactions which end at or before this offset were already applied
+    const auto applied = m_load_log->binlog_chunk_position(i);
+
+    if (Load_progress_log::INTERRUPTED == status) {
+      console->print_warning(
+          "Applying binary log chunk " + files[i] +
+          " was interrupted, " +
+          (applied ? "the transactions which were already applied are going "
+                     "to be skipped."
+                   : "it is going to be applied from the beginning."));
+    }
+
+    m_load_log->start_binlog_chunk(i);
+
+    const auto file = m_dump->create_binlog_chunk_file(files[i]);
+    file->open(mysqlshdk::storage::Mode::READ);
+    shcore::on_leave_scope close_file([&file]() { file->close(); });
+
+    mysqlshdk::mysql::Binlog_file_reader reader{file.get()};
+    uint64_t transactions = 0;
+
+    try {
+      // stop only at the transaction boundaries
+      while (!m_worker_interrupt || builder.in_transaction()) {
+        const auto event = reader.next();
+
+        if (event.empty()) {
+          break;
+        }
+
+        // format description event is always needed to apply the changes
+        if (reader.position() <= applied &&
+            mysqlshdk::mysql::Binlog_event_type::FORMAT_DESCRIPTION !=
+                mysqlshdk::mysql::parse_binlog_event_header(event).type) {
+          continue;
+        }
+
+        const auto committed = builder.transactions();
+
+        builder.push(event);
+
+        if (committed != builder.transactions()) {
+          m_load_log->end_binlog_transaction(i, reader.position());
+          ++transactions;
+        }
+      }
+    } catch (const std::exception &e) {
+      console->print_error("Error while applying binary log chunk " +
+                           files[i] + ": " + e.what());
+      throw;
+    }
+
+    log_info("Applied %" PRIu64 " transaction(s) from binary log chunk %s",
+             transactions, files[i].c_str());
+
+    if (m_worker_interrupt) {
+      break;
+    }
+
+    m_load_log->end_binlog_chunk(i);
+  }
+}
+
 void Dump_loader::show_metadata(bool force) const {
   if (force || m_options.show_metadata()) {
     m_dump->show_metadata();
@@ -79,6 +79,13 @@ class Dump_loader {
 
   dump::Progress_thread *progress() { return &m_progress_thread; }
 
+  /**
+   * Number of consecutive scans of an incomplete dump which did not find
+   * anything to load, while none of the workers had any work. Zero if loader
+   * is not waiting for the dump.
+   */
+  uint64_t idle_dump_scans() const { return m_idle_dump_scans; }
+
  private:
   class Worker {
    public:
@@ -101,7 +108,12 @@ class Dump_loader {
       const std::string &key() const { return m_key; }
       uint64_t weight() const { return m_weight; }
       void set_weight(uint64_t weight) { m_weight = weight; }
-      void done() { m_weight = 0; }
+      uint64_t memory() const { return m_memory; }
+      void set_memory(uint64_t memory) { m_memory = memory; }
+      void done() {
+        m_weight = 0;
+        m_memory = 0;
+      }
 
      protected:
       static void handle_current_exception(Worker *worker, Dump_loader *loader,
@@ -120,6 +132,9 @@ class Dump_loader {
       void set_id(size_t id);
 
       uint64_t m_weight = 1;
+      // memory used by the server to execute this task, accounted only if it
+      // is limited by the loader
+      uint64_t m_memory = 0;
     };
 
     class Schema_ddl_task : public Task {
@@ -256,9 +271,10 @@ class Dump_loader {
       Index_recreation_task(
           std::string_view schema, std::string_view table,
           compatibility::Deferred_statements::Index_info *indexes,
-          uint64_t weight)
+          uint64_t weight, uint64_t buffer_size)
           : Task(schema, table), m_indexes(indexes) {
         set_weight(weight);
+        set_memory(buffer_size);
       }
 
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
@@ -466,6 +482,18 @@ class Dump_loader {
   void check_server_version();
   void check_tables_without_primary_key();
 
+  /**
+   * Disables the redo log for the duration of the load, if it was requested
+   * and the target instance is empty. Falls back to the regular load if the
+   * redo log cannot be disabled.
+   */
+  void disable_redo_log();
+
+  /**
+   * Enables the redo log, if it was disabled by the loader.
+   */
+  void enable_redo_log();
+
   void handle_schema_option();
 
   std::function<bool(const std::string &, const std::string &)>
@@ -531,6 +559,18 @@ class Dump_loader {
                            const shcore::Dictionary_t &options, bool resuming,
                            uint64_t bytes_to_skip) const;
 
+  /**
+   * Estimates size of the sort buffer needed to build the given indexes,
+   * within the share of the index build memory budget available to the given
+   * number of threads.
+   *
+   * @returns 0 if sort buffer size cannot be set
+   */
+  uint64_t index_build_buffer_size(
+      const std::string &schema, const std::string &table,
+      const compatibility::Deferred_statements::Index_info &indexes,
+      uint64_t weight) const;
+
   Task_ptr recreate_indexes(
       const std::string &schema, const std::string &table,
       compatibility::Deferred_statements::Index_info *indexes) const;
@@ -543,6 +583,8 @@ class Dump_loader {
 
   void load_users();
 
+  void apply_binlog_changes();
+
  private:
 #ifdef FRIEND_TEST
   FRIEND_TEST(Load_dump, sql_transforms_strip_sql_mode);
@@ -600,6 +642,8 @@ class Dump_loader {
   std::unique_ptr<Dump_reader> m_dump;
   std::unique_ptr<Load_progress_log> m_load_log;
   bool m_resuming = false;
+  // whether redo log was disabled by the loader
+  bool m_redo_log_disabled = false;
 
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
 
@@ -607,6 +651,7 @@ class Dump_loader {
   std::list<Worker> m_workers;
   Queue m_pending_tasks;
   uint64_t m_current_weight = 0;
+  uint64_t m_current_memory = 0;
 
   std::mutex m_tables_being_loaded_mutex;
   std::unordered_multimap<std::string, size_t> m_tables_being_loaded;
@@ -614,6 +659,7 @@ class Dump_loader {
   std::atomic<size_t> m_num_threads_recreating_indexes;
   std::atomic<size_t> m_num_threads_checksumming{0};
   std::atomic<size_t> m_num_index_retries{0};
+  std::atomic<uint64_t> m_idle_dump_scans{0};
 
   Sql_transform m_default_sql_transforms;
 
@@ -28,10 +28,12 @@
 #include <numeric>
 #include <utility>
 
+#include "modules/util/common/dump/constants.h"
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/load/load_errors.h"
 #include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
@@ -144,6 +146,8 @@ Dump_reader::Status Dump_reader::open() {
 
   if (md->has_key("tzUtc")) m_contents.tz_utc = md->get_bool("tzUtc");
 
+  m_contents.incremental = md->has_key("incrementalFrom");
+
   if (md->has_key("mdsCompatibility"))
     m_contents.mds_compatibility = md->get_bool("mdsCompatibility");
 
@@ -195,6 +199,20 @@ Dump_reader::Status Dump_reader::open() {
   return m_dump_status;
 }
 
+std::unique_ptr<mysqlshdk::storage::IFile>
+Dump_reader::create_binlog_chunk_file(const std::string &name) const {
+  mysqlshdk::storage::Compression compression;
+
+  try {
+    compression = mysqlshdk::storage::from_extension(
+        std::get<1>(shcore::path::split_extension(name)));
+  } catch (...) {
+    compression = mysqlshdk::storage::Compression::NONE;
+  }
+
+  return mysqlshdk::storage::make_file(m_dir->file(name), compression);
+}
+
 std::string Dump_reader::begin_script() const {
   return m_contents.sql ? *m_contents.sql : "";
 }
@@ -732,8 +750,18 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
 
   log_debug("Finished listing files, starting rescan");
 
+  if (!m_metadata_snapshot_loaded && !m_contents.ready() &&
+      files.find({dump::common::k_metadata_snapshot_file}) != files.end()) {
+    load_metadata_snapshot();
+  }
+
   m_contents.rescan(m_dir.get(), files, this, progress_thread);
 
+  if (m_contents.ready()) {
+    // all metadata was parsed, snapshot is no longer needed
+    m_metadata_snapshot.clear();
+  }
+
   log_debug("Rescan done");
 
   if (m_dump_status != Status::COMPLETE &&
@@ -863,7 +891,8 @@ void Dump_reader::validate_options() {
 }
 
 std::string Dump_reader::Table_info::script_name() const {
-  return dump::common::get_table_filename(basename);
+  return ddl_hash.empty() ? dump::common::get_table_filename(basename)
+                          : dump::common::get_ddl_filename(ddl_hash);
 }
 
 std::string Dump_reader::Table_info::triggers_script_name() const {
@@ -896,6 +925,7 @@ void Dump_reader::Table_info::update_metadata(const std::string &data,
   di.owner = this;
 
   has_sql = md->get_bool("includesDdl", true);
+  ddl_hash = md->get_string("ddl", "");
   di.has_data = md->get_bool("includesData", true);
 
   options = md->get_map("options");
@@ -1303,8 +1333,8 @@ void Dump_reader::Schema_info::rescan(mysqlshdk::storage::IDirectory *dir,
           ++files_to_fetch;
 
           pool->add_task(
-              [dir, mdpath = t.second->metadata_name()]() {
-                return fetch_file(dir, mdpath);
+              [reader, dir, mdpath = t.second->metadata_name()]() {
+                return reader->fetch_metadata_file(dir, mdpath);
               },
               [table = t.second.get(), &files, reader](std::string &&data) {
                 table->update_metadata(data, reader);
@@ -1448,8 +1478,8 @@ void Dump_reader::Dump_info::rescan_metadata(
         ++task_producers;
 
         pool->add_task(
-            [dir, mdpath = s.second->metadata_name()]() {
-              return fetch_file(dir, mdpath);
+            [reader, dir, mdpath = s.second->metadata_name()]() {
+              return reader->fetch_metadata_file(dir, mdpath);
             },
             [&maybe_shutdown, schema = s.second.get(), dir, &files, reader,
              pool](std::string &&data) {
@@ -1533,6 +1563,27 @@ void Dump_reader::Dump_info::parse_done_metadata(
         chunk_sizes[file.first] = file.second.as_uint();
       }
     }
+
+    if (metadata->has_key("chunkFileChecksums")) {
+      const auto algorithm =
+          metadata->get_string("chunkFileChecksumAlgorithm");
+
+      if (dump::common::k_data_checksum_algorithm == algorithm) {
+        for (const auto &file : *metadata->get_map("chunkFileChecksums")) {
+          chunk_checksums[file.first] = file.second.as_string();
+        }
+      } else {
+        log_warning(
+            "Checksums of data files were computed using an unsupported "
+            "algorithm '%s', they are not going to be verified",
+            algorithm.c_str());
+      }
+    }
+
+    if (metadata->has_key("binlogChunkFiles")) {
+      binlog_chunk_files =
+          to_vector_of_strings(metadata->get_array("binlogChunkFiles"));
+    }
   } else {
     log_warning("Dump metadata file @.done.json is invalid");
   }
@@ -1585,6 +1636,41 @@ bool Dump_reader::should_create_pks() const {
   return m_options.should_create_pks(m_contents.create_invisible_pks);
 }
 
+void Dump_reader::load_metadata_snapshot() {
+  m_metadata_snapshot_loaded = true;
+
+  try {
+    const auto md =
+        fetch_metadata(m_dir.get(), dump::common::k_metadata_snapshot_file);
+
+    if (const auto files = md->get_map("files")) {
+      m_metadata_snapshot.reserve(files->size());
+
+      for (const auto &file : *files) {
+        m_metadata_snapshot.emplace(file.first, file.second.get_string());
+      }
+    }
+
+    log_info("Loaded metadata snapshot with %zu files",
+             m_metadata_snapshot.size());
+  } catch (const std::exception &e) {
+    // not fatal, metadata files are going to be fetched one by one
+    log_warning("Failed to load the metadata snapshot: %s", e.what());
+    m_metadata_snapshot.clear();
+  }
+}
+
+std::string Dump_reader::fetch_metadata_file(
+    mysqlshdk::storage::IDirectory *dir, const std::string &name) const {
+  // snapshot is not modified while metadata is being fetched
+  if (const auto it = m_metadata_snapshot.find(name);
+      m_metadata_snapshot.end() != it) {
+    return it->second;
+  }
+
+  return fetch_file(dir, name);
+}
+
 std::unique_ptr<shcore::Thread_pool> Dump_reader::create_thread_pool() const {
   auto threads = m_options.threads_count();
 
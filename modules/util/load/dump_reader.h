@@ -95,6 +95,19 @@ class Dump_reader {
 
   bool tz_utc() const { return m_contents.tz_utc; }
 
+  /**
+   * Checks whether this is an incremental dump, holding the changes recorded
+   * in the binary log since its base dump was created.
+   */
+  bool is_incremental() const { return m_contents.incremental; }
+
+  const std::vector<std::string> &binlog_chunk_files() const {
+    return m_contents.binlog_chunk_files;
+  }
+
+  std::unique_ptr<mysqlshdk::storage::IFile> create_binlog_chunk_file(
+      const std::string &name) const;
+
   /**
    * Checks whether this is a dump created by an old version of dumpTables(),
    * which has no schema SQL.
@@ -207,6 +220,17 @@ class Dump_reader {
     }
   }
 
+  /**
+   * Provides checksum of the uncompressed contents of the given data file,
+   * computed when it was dumped.
+   *
+   * @returns checksum or an empty string if it's not available
+   */
+  std::string chunk_checksum(const std::string &name) const {
+    const auto it = m_contents.chunk_checksums.find(name);
+    return it == m_contents.chunk_checksums.end() ? std::string{} : it->second;
+  }
+
   void rescan(dump::Progress_thread *progress_thread = nullptr);
 
   uint64_t add_deferred_statements(const std::string &schema,
@@ -386,6 +410,9 @@ class Dump_reader {
 
     std::vector<std::string> primary_index;
 
+    // hash of the deduplicated DDL, empty if table has its own DDL file
+    std::string ddl_hash;
+
     bool has_sql = true;
     volatile bool md_done = false;
     bool sql_seen = false;
@@ -484,12 +511,15 @@ class Dump_reader {
     bool partial_revokes = false;
     bool create_invisible_pks = false;
     bool table_only = false;
+    bool incremental = false;
+    std::vector<std::string> binlog_chunk_files;
     mysqlshdk::utils::Version server_version;
     mysqlshdk::utils::Version dump_version;
     std::optional<mysqlshdk::utils::Version> target_version;
     std::string origin;
     uint64_t bytes_per_chunk = 0;
     std::unordered_map<std::string, uint64_t> chunk_sizes;
+    std::unordered_map<std::string, std::string> chunk_checksums;
 
     volatile bool md_done = false;
 
@@ -555,6 +585,11 @@ class Dump_reader {
   View_info *find_view(std::string_view schema, std::string_view view,
                        const char *context);
 
+  void load_metadata_snapshot();
+
+  std::string fetch_metadata_file(mysqlshdk::storage::IDirectory *dir,
+                                  const std::string &name) const;
+
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
 
   const Load_dump_options &m_options;
@@ -577,6 +612,11 @@ class Dump_reader {
   std::atomic<uint64_t> m_metadata_available{0};
   std::atomic<uint64_t> m_metadata_parsed{0};
 
+  // file name -> contents of schema and table metadata files, read from a
+  // single snapshot file written by the dumper
+  std::unordered_map<std::string, std::string> m_metadata_snapshot;
+  bool m_metadata_snapshot_loaded = false;
+
   // new schema name -> old schema name
   std::optional<std::pair<std::string, std::string>> m_schema_override;
 
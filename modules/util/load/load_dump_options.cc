@@ -54,6 +54,9 @@ using Version = mysqlshdk::utils::Version;
 
 constexpr auto k_minimum_max_bytes_per_transaction = 4096;
 
+// minimum value of the innodb_ddl_buffer_size system variable
+constexpr auto k_minimum_index_build_memory = 65536;
+
 }  // namespace
 
 Load_dump_options::Load_dump_options() : Load_dump_options("") {}
@@ -88,6 +91,7 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
                    &dump::common::Filtering_options::triggers)
           .optional("characterSet", &Load_dump_options::m_character_set)
           .optional("skipBinlog", &Load_dump_options::m_skip_binlog)
+          .optional("disableRedoLog", &Load_dump_options::m_disable_redo_log)
           .optional("ignoreExistingObjects",
                     &Load_dump_options::m_ignore_existing_objects)
           .optional("ignoreVersion", &Load_dump_options::m_ignore_version)
@@ -101,6 +105,8 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
                      {"all", Defer_index_mode::ALL},
                      {"fulltext", Defer_index_mode::FULLTEXT}})
           .optional("loadIndexes", &Load_dump_options::m_load_indexes)
+          .optional("indexBuildMemory",
+                    &Load_dump_options::set_index_build_memory)
           .optional("schema", &Load_dump_options::m_target_schema)
           .include(&Load_dump_options::m_filtering_options,
                    &dump::common::Filtering_options::users)
@@ -152,6 +158,22 @@ void Load_dump_options::set_max_bytes_per_transaction(
   }
 }
 
+void Load_dump_options::set_index_build_memory(const std::string &value) {
+  if (value.empty()) {
+    throw std::invalid_argument(
+        "The option 'indexBuildMemory' cannot be set to an empty string.");
+  }
+
+  m_index_build_memory = mysqlshdk::utils::expand_to_bytes(value);
+
+  if (*m_index_build_memory < k_minimum_index_build_memory) {
+    throw std::invalid_argument(
+        "The value of 'indexBuildMemory' option must be greater than or equal "
+        "to " +
+        std::to_string(k_minimum_index_build_memory) + " bytes.");
+  }
+}
+
 void Load_dump_options::set_progress_file(const std::string &value) {
   m_progress_file = value;
 
@@ -265,13 +287,14 @@ void Load_dump_options::set_session(
     // innodb_parallel_read_threads threads are used during the first stage,
     // innodb_ddl_threads threads are used during second and third stages, in
     // most cases first stage is executed before the rest, so we're using
-    // maximum of these two values
-    m_threads_per_add_index =
-        query(
-            "SELECT GREATEST(@@innodb_parallel_read_threads, "
-            "@@innodb_ddl_threads)")
-            ->fetch_one_or_throw()
-            ->get_uint(0);
+    // maximum of these two values; innodb_ddl_buffer_size is the default
+    // amount of memory used by a single ALTER TABLE ... ADD INDEX
+    const auto result = query(
+        "SELECT GREATEST(@@innodb_parallel_read_threads, "
+        "@@innodb_ddl_threads), @@innodb_ddl_buffer_size");
+    const auto row = result->fetch_one_or_throw();
+    m_threads_per_add_index = row->get_uint(0);
+    m_ddl_buffer_size = row->get_uint(1);
   }
 
   if (m_target_server_version >= Version(8, 0, 16)) {
@@ -161,12 +161,35 @@ class Load_dump_options {
 
   uint64_t threads_per_add_index() const { return m_threads_per_add_index; }
 
+  /**
+   * Default size of the sort buffer used by a single ALTER TABLE ... ADD INDEX,
+   * 0 if server does not support setting it.
+   */
+  uint64_t ddl_buffer_size() const { return m_ddl_buffer_size; }
+
+  /**
+   * Memory which can be used by all concurrent index builds.
+   */
+  uint64_t index_build_memory() const {
+    return m_index_build_memory.value_or(m_ddl_buffer_size * m_threads_count);
+  }
+
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
   void set_dump_wait_timeout_ms(uint64_t timeout_ms) {
     m_wait_dump_timeout_ms = timeout_ms;
   }
 
+  /**
+   * Maximum time to wait before checking again if more of the dump is
+   * available.
+   */
+  uint64_t dump_rescan_interval_ms() const { return m_dump_rescan_interval_ms; }
+
+  void set_dump_rescan_interval_ms(uint64_t interval_ms) {
+    m_dump_rescan_interval_ms = interval_ms;
+  }
+
   const std::string &character_set() const { return m_character_set; }
 
   bool load_data() const { return m_load_data; }
@@ -187,6 +210,8 @@ class Load_dump_options {
 
   bool skip_binlog() const { return m_skip_binlog; }
 
+  bool disable_redo_log() const { return m_disable_redo_log; }
+
   bool force() const { return m_force; }
 
   const dump::common::Filtering_options &filters() const {
@@ -260,6 +285,8 @@ class Load_dump_options {
 
   void set_max_bytes_per_transaction(const std::string &value);
 
+  void set_index_build_memory(const std::string &value);
+
   void set_handle_grant_errors(const std::string &action);
 
   inline std::shared_ptr<mysqlshdk::db::IResult> query(
@@ -302,6 +329,7 @@ class Load_dump_options {
   bool m_dry_run = false;
   bool m_force = false;
   bool m_skip_binlog = false;
+  bool m_disable_redo_log = false;
   bool m_ignore_existing_objects = false;
   bool m_ignore_version = false;
   Defer_index_mode m_defer_table_indexes = Defer_index_mode::FULLTEXT;
@@ -326,12 +354,19 @@ class Load_dump_options {
   // how many threads are used by the server per one ALTER TABLE ... ADD INDEX
   uint64_t m_threads_per_add_index = 1;
 
+  // innodb_ddl_buffer_size of the target server
+  uint64_t m_ddl_buffer_size = 0;
+
+  std::optional<uint64_t> m_index_build_memory;
+
   bool m_checksum = false;
 
   // whether partial revokes are enabled
   bool m_partial_revokes = false;
 
   bool m_use_fast_sub_chunking = false;
+
+  uint64_t m_dump_rescan_interval_ms = 5000;
 };
 
 }  // namespace mysqlsh
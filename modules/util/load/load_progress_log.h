@@ -233,6 +233,22 @@ class Load_progress_log final {
     return it->second.status;
   }
 
+  Status binlog_chunk_status(ssize_t chunk) const {
+    auto it = m_last_state.find("BINLOG-CHUNK:" + std::to_string(chunk));
+    if (it == m_last_state.end()) return Status::PENDING;
+    return it->second.status;
+  }
+
+  /**
+   * Offset of the end of the last transaction applied from the given binary
+   * log chunk, 0 if none was applied.
+   */
+  uint64_t binlog_chunk_position(ssize_t chunk) const {
+    auto it = m_last_state.find("BINLOG-TRANSACTION:" + std::to_string(chunk));
+    if (it == m_last_state.end()) return 0;
+    return it->second.details->get_uint("position");
+  }
+
   std::string server_uuid() const {
     auto it = m_last_state.find("SERVER-UUID");
     if (it == m_last_state.end()) return {};
@@ -338,6 +354,24 @@ class Load_progress_log final {
     if (gtid_update_status() != Status::DONE) log(true, "GTID-UPDATE");
   }
 
+  void start_binlog_chunk(ssize_t chunk) {
+    if (binlog_chunk_status(chunk) != Status::DONE)
+      log(false, "BINLOG-CHUNK", "", "", "", chunk);
+  }
+
+  void end_binlog_chunk(ssize_t chunk) {
+    if (binlog_chunk_status(chunk) != Status::DONE)
+      log(true, "BINLOG-CHUNK", "", "", "", chunk);
+  }
+
+  void end_binlog_transaction(ssize_t chunk, uint64_t position) {
+    if (binlog_chunk_status(chunk) != Status::DONE)
+      log(true, "BINLOG-TRANSACTION", "", "", "", chunk,
+          [position](Dumper *json) {
+            json->append_uint64("position", position);
+          });
+  }
+
   void start_table_indexes(const std::string &schema,
                            const std::string &table) {
     if (table_index_status(schema, table) != Status::DONE)
@@ -93,6 +93,7 @@ Util::Util(shcore::IShell_core *owner)
   expose("copyTables", &Util::copy_tables, "schema", "tables", "connectionData",
          "?options")
       ->cli();
+  expose("replayWorkload", &Util::replay_workload, "path", "?options")->cli();
 }
 
 REGISTER_HELP_FUNCTION(checkForServerUpgrade, util);
@@ -820,6 +821,11 @@ set <b>fieldsOptionallyEnclosed</b> to true.
 If you specify one separator that is the same as or a prefix of another, LOAD
 DATA INFILE cannot interpret the input properly.
 
+When importing multiple files and there are fewer compressed files than threads,
+these files are decompressed in background threads, split into chunks and loaded
+by all threads. Size of a chunk is set by the <b>maxBytesPerTransaction</b>
+option, or is 50M if this option is not set.
+
 Connection options set in the global session, such as compression, ssl-mode, etc.
 are used in parallel connections.
 
@@ -1044,6 +1050,11 @@ assigned more threads.
 LOAD DATA LOCAL INFILE is used to load table data and thus, the 'local_infile'
 MySQL global setting must be enabled.
 
+If the dump was created with the 'dataChecksum' option enabled, checksums of the
+data files are verified while they are loaded. If a mismatch is detected, the
+load is aborted. Chunks which are resumed from the middle of a file are not
+verified.
+
 <b>Resuming</b>
 
 The load command will store progress information into a file for each step of
@@ -1094,6 +1105,14 @@ compatibility option, false otherwise. Requires server 8.0.24 or newer.
 If "all", creation of "all" indexes except PRIMARY is deferred until after
 table data is loaded, which in many cases can reduce load times. If "fulltext",
 only full-text indexes will be deferred.
+@li <b>disableRedoLog</b>: bool (default: false) - Disables the InnoDB redo
+log while the dump is loaded, which significantly speeds up loading of the
+data and recreation of the indexes. The redo log is disabled only if the target
+instance does not contain any user schemas and the load is not being resumed,
+otherwise data is loaded normally. The redo log is enabled again once the load
+finishes. Requires MySQL 8.0.21 or newer and the INNODB_REDO_LOG_ENABLE
+privilege. WARNING: if the server stops unexpectedly while the redo log is
+disabled, the instance needs to be recreated.
 @li <b>dryRun</b>: bool (default: false) - Scans the dump and prints everything
 that would be performed, without actually doing so.
 @li <b>excludeEvents</b>: array of strings (default not set) - Skip loading
@@ -1151,6 +1170,14 @@ default, all triggers are included.
 specified users from the dump. Each user is in the format of
 'user_name'[@'host']. If the host is not specified, all the accounts with the
 given user name are included. By default, all users are included.
+@li <b>indexBuildMemory</b>: string (default: the value of
+innodb_ddl_buffer_size multiplied by the number of threads) - Specifies the
+amount of memory which can be used by all the concurrent statements which
+recreate the deferred indexes. Each statement is given a sort buffer
+proportional to the size of its table, and as many of them are executed in
+parallel as fit in this amount. Supports unit suffixes: k (kilobytes), M
+(Megabytes), G (Gigabytes). Minimum value: 65536. Used only if the target
+server is 8.0.27 or newer.
 @li <b>loadData</b>: bool (default: true) - Loads table data from the dump.
 @li <b>loadDdl</b>: bool (default: true) - Executes DDL/SQL scripts in the
 dump.
@@ -1531,6 +1558,12 @@ backup lock cannot not be acquired.
 @li <b>dataOnly</b>: bool (default: false) - Only dump data from the database.
 @li <b>checksum</b>: bool (default: false) - Compute and include checksum of the
 dumped data.
+@li <b>dataChecksum</b>: bool (default: false) - Compute checksums of the data
+files while they are written and include them in the dump. Unlike the
+<b>checksum</b> option, this does not execute any additional queries.
+@li <b>deduplicateDdl</b>: bool (default: false) - Store the DDL of tables with
+identical definitions only once, table metadata refers to the shared DDL file.
+Dumps created with this option can be loaded by MySQL Shell 8.3.0 or newer.
 @li <b>dryRun</b>: bool (default: false) - Print information about what would be
 dumped, but do not dump anything. If <b>ocimds</b> is enabled, also checks for
 compatibility issues with MySQL HeatWave Service.
@@ -1815,6 +1848,11 @@ to be overwritten. The output file is created with the following access rights
 used to filter the data being exported.
 @li <b>partitions</b>: list of strings (default: not set) - A list of valid
 partition names used to limit the data export to just the specified partitions.
+@li <b>threads</b>: int (default: 1) - Use N threads to export the data from the
+server.
+@li <b>bytesPerChunk</b>: string (minimum: "128k", default: "64M") - Sets
+average estimated number of bytes to be read by each thread in a single step,
+used only if <b>threads</b> is greater than 1.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
@@ -1845,6 +1883,18 @@ The <b>maxRate</b> option supports unit suffixes:
 
 i.e. maxRate="2k" - limit throughput to 2000 bytes per second.
 
+If the <b>threads</b> option is greater than 1 and the table has an index which
+can be used to order its rows, the table is split into chunks using this index
+and the chunks are read from the server in parallel. Each chunk is buffered in
+memory until all the chunks which precede it are written, so the output file
+has the same contents as if it was exported using a single thread. Memory usage
+is roughly proportional to <b>threads</b> multiplied by <b>bytesPerChunk</b>.
+If such index does not exist, or if data of more than one partition is
+exported, the table is exported using a single thread.
+
+Each thread uses its own session, the data is not read from a consistent
+snapshot of the table.
+
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTION_DETAILS}
 
 ${TOPIC_UTIL_DUMP_AWS_COMMON_OPTION_DETAILS}
@@ -2136,6 +2186,9 @@ is not specified, all the accounts with the given user name are excluded.
 specified users. Each user is in the format of 'user_name'[@'host']. If the host
 is not specified, all the accounts with the given user name are included. By
 default, all users are included.
+@li <b>incrementalFrom</b>: string (default: not set) - Location of a complete
+dump of this instance. If set, an incremental dump is created, which holds only
+the changes recorded in the binary log since that dump was created.
 
 ${TOPIC_UTIL_DUMP_DDL_COMMON_OPTIONS}
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
@@ -2149,6 +2202,30 @@ ${TOPIC_UTIL_AZURE_COMMON_OPTIONS}
 
 ${TOPIC_UTIL_DUMP_SCHEMAS_COMMON_DETAILS}
 
+<b>Incremental dumps</b>
+
+The <b>incrementalFrom</b> option uses the binary log position stored in the
+base dump, and streams all the binary log events written since then, up to the
+current position, into chunk files. The base can be either a full dump or
+another incremental dump, allowing to create a chain of dumps. The schema and
+user filtering options and the <b>users</b> option do not apply to the
+incremental dumps.
+
+The incremental dump can be created only if binary logging is enabled, the
+binlog_format system variable is set to ROW, transaction compression is
+disabled and the binary log files were not purged since the base dump was
+created.
+
+The incremental dump is loaded with the util.loadDump() function into an
+instance which already holds the contents of its base dump. The changes are
+applied sequentially, using the BINLOG statements, which requires the
+BINLOG_ADMIN or REPLICATION_APPLIER privilege. The schema and table filtering
+options and the <b>loadUsers</b> option of the util.loadDump() function apply
+to the changes, changes to the system schemas are skipped. Statements logged
+using the statement-based format cannot be applied. The progress is recorded
+after each transaction, when the load is resumed, the transactions which were
+already applied are skipped.
+
 Dumps cannot be created for the following schemas:
 @li information_schema,
 @li mysql,
@@ -2303,6 +2380,12 @@ server.
 @li <b>maxRate</b>: string (default: "0") - Limit data read throughput to
 maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
+@li <b>maxMemory</b>: string (default: "0") - Limit the memory used to store
+the metadata and DDL of the copy, supports unit suffixes: k (kilobytes), M
+(Megabytes), G (Gigabytes). If this limit is reached, the source waits until the
+target reads the stored files. If the target needs files which cannot be stored
+within this limit, the copy is aborted. Table data is not stored in memory and
+is not subject to this limit. Use maxMemory="0" to set no limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable copy progress information.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
@@ -2315,6 +2398,14 @@ tables that have histogram information stored in the copy will be analyzed.
 If "all", creation of "all" indexes except PRIMARY is deferred until after
 table data is copied, which in many cases can reduce load times. If "fulltext",
 only full-text indexes will be deferred.
+@li <b>disableRedoLog</b>: bool (default: false) - Disables the InnoDB redo
+log while the copy is loaded, which significantly speeds up loading of the
+data and recreation of the indexes. The redo log is disabled only if the target
+instance does not contain any user schemas and the load is not being resumed,
+otherwise data is loaded normally. The redo log is enabled again once the load
+finishes. Requires MySQL 8.0.21 or newer and the INNODB_REDO_LOG_ENABLE
+privilege. WARNING: if the server stops unexpectedly while the redo log is
+disabled, the instance needs to be recreated.
 @li <b>handleGrantErrors</b>: "abort", "drop_account", "ignore" (default: abort)
 - Specifies action to be performed in case of errors related to the GRANT/REVOKE
 statements, "abort": throws an error and aborts the copy, "drop_account":
@@ -2325,6 +2416,14 @@ it contains objects that already exist in the target database.
 @li <b>ignoreVersion</b>: bool (default false) - Load the copy even if the major
 version number of the server where it was created is different from where it
 will be loaded.
+@li <b>indexBuildMemory</b>: string (default: the value of
+innodb_ddl_buffer_size multiplied by the number of threads) - Specifies the
+amount of memory which can be used by all the concurrent statements which
+recreate the deferred indexes. Each statement is given a sort buffer
+proportional to the size of its table, and as many of them are executed in
+parallel as fit in this amount. Supports unit suffixes: k (kilobytes), M
+(Megabytes), G (Gigabytes). Minimum value: 65536. Used only if the target
+server is 8.0.27 or newer.
 @li <b>loadIndexes</b>: bool (default: true) - use together with
 <b>deferTableIndexes</b> to control whether secondary indexes should be
 recreated at the end of the copy.
@@ -2522,4 +2621,61 @@ void Util::copy_tables(
   copy::copy<mysqlsh::dump::Dump_tables>(connection_options, &copy_options);
 }
 
+REGISTER_HELP_FUNCTION(replayWorkload, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_REPLAYWORKLOAD, R"*(
+Replays the workload captured using the --capture-workload command line option
+and reports the statistics of the executed statements. Requires an open global
+Shell session to the target instance, if there is none, an exception is raised.
+
+@param path Path to the file with the captured workload.
+@param options Optional dictionary with the replay options.
+
+Each of the captured sessions is replayed using a separate session to the
+target instance, statements within a session are executed in the order in which
+they were captured. The captured sessions are distributed among the threads.
+
+Once the replay is finished, statements which differ only in values of literals
+are grouped together, and for each such group, the number of executions, the
+total and average execution time, the 50th, 95th and 99th percentiles of the
+latency, the maximum latency and the number of errors are reported. The
+percentiles are estimated using histograms with power-of-two buckets.
+
+Only SQL statements are captured, CRUD operations executed using X Protocol
+sessions are not replayed.
+
+<b>The following options are supported:</b>
+@li <b>threads</b>: int (default: 4) - Maximum number of concurrently replayed
+sessions.
+@li <b>speedUp</b>: float (default: 1) - Factor by which the intervals between
+the statements are shortened. If set to 0, statements are executed as fast as
+possible, without any delays.
+@li <b>top</b>: int (default: 20) - Number of statement groups with the highest
+total execution time to be reported.
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_REPLAYWORKLOAD_BRIEF)
+ *
+ * $(UTIL_REPLAYWORKLOAD)
+ */
+#if DOXYGEN_JS
+Undefined Util::replayWorkload(String path, Dictionary options);
+#elif DOXYGEN_PY
+None Util::replay_workload(str path, dict options);
+#endif
+void Util::replay_workload(
+    const std::string &path,
+    const shcore::Option_pack_ref<Replay_workload_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  mysqlsh::replay_workload(path, session->get_connection_options(), *options);
+}
+
 }  // namespace mysqlsh
@@ -39,6 +39,7 @@
 #include "modules/util/dump/export_table_options.h"
 #include "modules/util/import_table/import_table_options.h"
 #include "modules/util/load/load_dump_options.h"
+#include "modules/util/replay_workload.h"
 #include "modules/util/upgrade_check.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
@@ -184,6 +185,15 @@ class SHCORE_PUBLIC Util : public Extensible_object {
       const mysqlshdk::db::Connection_options &connection_options,
       const shcore::Option_pack_ref<copy::Copy_tables_options> &options = {});
 
+#if DOXYGEN_JS
+  Undefined replayWorkload(String path, Dictionary options);
+#elif DOXYGEN_PY
+  None replay_workload(str path, dict options);
+#endif
+  void replay_workload(
+      const std::string &path,
+      const shcore::Option_pack_ref<Replay_workload_options> &options = {});
+
  private:
   shcore::IShell_core &_shell_core;
 };
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/replay_workload.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <utility>
+
+#include "modules/mod_utils.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+using mysqlshdk::db::replay::Workload_replay_result;
+
+// digests longer than this are truncated in the report
+constexpr std::size_t k_max_digest_length = 80;
+
+std::string format_latency(uint64_t us) {
+  return shcore::str_format("%.3f", us / 1000.0);
+}
+
+void print_report(const Workload_replay_result &result, std::size_t top) {
+  const auto console = current_console();
+
+  console->print_info(shcore::str_format(
+      "%" PRIu64 " statements from %" PRIu64
+      " sessions replayed in %s, %" PRIu64 " errors.",
+      result.executed, result.sessions,
+      mysqlshdk::utils::format_microseconds(result.duration / 1000000.0)
+          .c_str(),
+      result.errors));
+
+  if (result.statements.empty()) {
+    return;
+  }
+
+  console->print_info();
+  console->print_info(shcore::str_format(
+      "Top %zu statements by total execution time (latencies in ms):",
+      std::min(top, result.statements.size())));
+  console->print_info(shcore::str_format(
+      "%8s %10s %9s %9s %9s %9s %9s %6s  %s", "count", "total", "avg", "p50",
+      "p95", "p99", "max", "errors", "digest"));
+
+  std::size_t printed = 0;
+
+  for (const auto &s : result.statements) {
+    if (printed++ >= top) {
+      break;
+    }
+
+    auto digest = s.digest;
+
+    if (digest.length() > k_max_digest_length) {
+      digest = digest.substr(0, k_max_digest_length - 3) + "...";
+    }
+
+    console->print_info(shcore::str_format(
+        "%8" PRIu64 " %10s %9s %9s %9s %9s %9s %6" PRIu64 "  %s",
+        s.latency.count(), format_latency(s.latency.total()).c_str(),
+        format_latency(s.latency.average()).c_str(),
+        format_latency(s.latency.percentile(50)).c_str(),
+        format_latency(s.latency.percentile(95)).c_str(),
+        format_latency(s.latency.percentile(99)).c_str(),
+        format_latency(s.latency.max()).c_str(), s.errors, digest.c_str()));
+  }
+}
+
+}  // namespace
+
+const shcore::Option_pack_def<Replay_workload_options>
+    &Replay_workload_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Replay_workload_options>()
+          .optional("threads", &Replay_workload_options::threads)
+          .optional("speedUp", &Replay_workload_options::speed_up)
+          .optional("top", &Replay_workload_options::top)
+          .on_done(&Replay_workload_options::on_unpacked_options);
+
+  return opts;
+}
+
+void Replay_workload_options::on_unpacked_options() {
+  if (0 == threads) {
+    throw shcore::Exception::argument_error(
+        "The value of the 'threads' option must be greater than 0.");
+  }
+
+  if (speed_up < 0) {
+    throw shcore::Exception::argument_error(
+        "The value of the 'speedUp' option must be greater than or equal to "
+        "0.");
+  }
+}
+
+Workload_replay_result replay_workload(
+    const std::string &path,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const Replay_workload_options &options) {
+  using mysqlshdk::db::replay::Workload_replayer;
+
+  auto events = mysqlshdk::db::replay::read_workload(path);
+
+  const auto console = current_console();
+  console->print_info(shcore::str_format(
+      "Replaying %zu events from '%s' using %" PRIu64
+      " threads, speed-up factor: %s",
+      events.size(), path.c_str(), options.threads,
+      options.speed_up > 0 ? shcore::str_format("%g", options.speed_up).c_str()
+                           : "none"));
+
+  mysqlshdk::db::replay::Workload_replay_options replay_options;
+  replay_options.connect = [&connection_options]() {
+    return establish_session(connection_options, false);
+  };
+  replay_options.threads = options.threads;
+  replay_options.speed_up = options.speed_up;
+
+  Workload_replayer replayer{std::move(events), std::move(replay_options)};
+
+  shcore::Interrupt_handler intr_handler([&replayer]() -> bool {
+    current_console()->print_note("Interrupted by user, stopping the replay.");
+    replayer.interrupt();
+    return false;
+  });
+
+  auto result = replayer.run();
+
+  print_report(result, options.top);
+
+  return result;
+}
+
+}  // namespace mysqlsh
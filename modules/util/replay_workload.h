@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_REPLAY_WORKLOAD_H_
+#define MODULES_UTIL_REPLAY_WORKLOAD_H_
+
+#include <cstdint>
+#include <string>
+
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/replay/workload.h"
+
+namespace mysqlsh {
+
+struct Replay_workload_options {
+  static const shcore::Option_pack_def<Replay_workload_options> &options();
+
+  uint64_t threads = 4;
+  double speed_up = 1.0;
+  uint64_t top = 20;
+
+ private:
+  void on_unpacked_options();
+};
+
+/**
+ * Replays the workload stored in the given file against the instance
+ * specified by the connection options, prints the report.
+ */
+mysqlshdk::db::replay::Workload_replay_result replay_workload(
+    const std::string &path,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const Replay_workload_options &options);
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_REPLAY_WORKLOAD_H_
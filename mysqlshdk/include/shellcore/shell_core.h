@@ -184,6 +184,12 @@ class SHCORE_PUBLIC Shell_core : public shcore::IShell_core {
   std::vector<std::string> get_global_objects(Mode mode) override;
   std::vector<std::string> get_all_globals();
 
+  /**
+   * Removes the global, so that it can be registered again. Languages keep
+   * the old value until the global is registered again.
+   */
+  void remove_global(const std::string &name);
+
   std::shared_ptr<mysqlsh::ShellBaseSession> set_dev_session(
       const std::shared_ptr<mysqlsh::ShellBaseSession> &session) override;
   std::shared_ptr<mysqlsh::ShellBaseSession> get_dev_session() override;
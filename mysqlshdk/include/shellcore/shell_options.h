@@ -97,7 +97,7 @@ class Shell_options final : public shcore::Options {
     std::string identity_file;
     std::string config_file;
     int timeout = 10;
-    unsigned int buffer_size = 10240;
+    unsigned int buffer_size = 65536;
     std::string uri;
     std::string pwd;
     mysqlshdk::ssh::Ssh_connection_options uri_data;
@@ -168,6 +168,13 @@ class Shell_options final : public shcore::Options {
     std::vector<std::string> import_opts;
     std::string pager;
     Quiet_start quiet_start = Quiet_start::NOT_SET;
+    // file where the workload is captured
+    std::string capture_workload;
+    // UNIX socket where the daemon listens for requests
+    std::string daemon;
+    // UNIX socket of the daemon which handles the requests of this client
+    std::string use_daemon;
+    bool startup_profile = false;
     bool show_column_type_info = false;
     bool default_compress = false;
     std::string dbug_options;
@@ -301,6 +308,7 @@ class Shell_options final : public shcore::Options {
   void check_result_format();
   void check_file_execute_conflicts();
   void check_ssh_conflicts();
+  void check_daemon_conflicts();
 
   /**
    * --import option require default schema to be provided in connection
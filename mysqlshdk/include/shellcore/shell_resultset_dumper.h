@@ -127,6 +127,8 @@ class Resultset_dumper_base {
   size_t dump_table();
   size_t dump_vertical();
   size_t dump_documents(bool is_doc_result);
+  size_t dump_raw_documents(const mysqlshdk::db::IRow *row, bool is_doc_result,
+                            bool as_array);
   virtual bool show_column_type_info() const { return m_show_column_type_info; }
   std::string format_json(const std::string &item_label, bool is_doc_result,
                           bool pretty, int *count);
@@ -95,9 +95,8 @@ S3_bucket::S3_bucket(const S3_bucket_config_ptr &config)
       m_object_path_prefix(m_bucket_path +
                            (config->path_style_access() ? "/" : "")) {}
 
-rest::Signed_request S3_bucket::list_objects_request(
-    const std::string &prefix, size_t limit, bool recursive,
-    const Object_details::Fields_mask &, const std::string &start_from) {
+rest::Query S3_bucket::list_objects_query(const std::string &prefix,
+                                          size_t limit, bool recursive) const {
   // ListObjectsV2
   rest::Query query = {{"list-type", "2"}};
 
@@ -116,6 +115,14 @@ rest::Signed_request S3_bucket::list_objects_request(
 
   // AWS S3 does not allow to select fields, it always returns all of them
 
+  return query;
+}
+
+rest::Signed_request S3_bucket::list_objects_request(
+    const std::string &prefix, size_t limit, bool recursive,
+    const Object_details::Fields_mask &, const std::string &start_from) {
+  auto query = list_objects_query(prefix, limit, recursive);
+
   if (!start_from.empty()) {
     query.emplace("continuation-token", encode_query(start_from));
   }
@@ -123,6 +130,18 @@ rest::Signed_request S3_bucket::list_objects_request(
   return create_bucket_request(query);
 }
 
+rest::Signed_request S3_bucket::list_objects_after_request(
+    const std::string &prefix, bool recursive,
+    const Object_details::Fields_mask &, const std::string &start_after) {
+  auto query = list_objects_query(prefix, 0, recursive);
+
+  if (!start_after.empty()) {
+    query.emplace("start-after", encode_query(start_after));
+  }
+
+  return create_bucket_request(query);
+}
+
 std::vector<Object_details> S3_bucket::parse_list_objects(
     const rest::Base_response_buffer &buffer, std::string *next_start_from,
     std::unordered_set<std::string> *out_prefixes) {
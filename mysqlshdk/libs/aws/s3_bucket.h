@@ -72,12 +72,22 @@ class S3_bucket : public storage::backend::object_storage::Container {
 
   void delete_objects(const std::vector<std::string> &list);
 
+  bool has_list_objects_range() const override { return true; }
+
  private:
+  rest::Query list_objects_query(const std::string &prefix, size_t limit,
+                                 bool recursive) const;
+
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
       const Object_details::Fields_mask &fields,
       const std::string &start_from) override;
 
+  rest::Signed_request list_objects_after_request(
+      const std::string &prefix, bool recursive,
+      const Object_details::Fields_mask &fields,
+      const std::string &start_after) override;
+
   std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
       std::unordered_set<std::string> *out_prefixes) override;
@@ -0,0 +1,857 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/replay/workload.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <exception>
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/db/replay/mysqlx.h"
+#include "mysqlshdk/libs/db/replay/setup.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace replay {
+
+namespace {
+
+constexpr int k_workload_version = 1;
+
+std::mutex g_capture_mutex;
+std::shared_ptr<Workload_writer> g_capture_writer;
+
+std::shared_ptr<Workload_writer> capture_writer() {
+  std::lock_guard<std::mutex> lock(g_capture_mutex);
+  return g_capture_writer;
+}
+
+inline bool is_word_char(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || '_' == c || '$' == c;
+}
+
+inline bool ends_with(const std::string &s, std::string_view suffix) {
+  return s.length() >= suffix.length() &&
+         0 == s.compare(s.length() - suffix.length(), suffix.length(), suffix);
+}
+
+class Digest_builder final {
+ public:
+  void space() { m_space = true; }
+
+  void literal() {
+    // collapse lists of literals: (?, ?, ?) -> (?)
+    if (ends_with(m_digest, "?,")) {
+      m_digest.pop_back();
+      m_space = false;
+      return;
+    }
+
+    append("?");
+  }
+
+  void punctuation(char c) {
+    if (')' == c && ends_with(m_digest, "(?), (?")) {
+      // collapse lists of rows: (?), (?) -> (?)
+      m_digest.erase(m_digest.length() - 5);
+    }
+
+    if (',' == c || ')' == c || ';' == c || '.' == c) {
+      m_space = false;
+    }
+
+    append(std::string_view{&c, 1});
+
+    if (',' == c) {
+      m_space = true;
+    }
+  }
+
+  void append(std::string_view token) {
+    if (m_space && !m_digest.empty() && '(' != m_digest.back() &&
+        '.' != m_digest.back() && '@' != m_digest.back()) {
+      m_digest += ' ';
+    }
+
+    m_space = false;
+    m_digest.append(token);
+  }
+
+  std::string digest() { return std::move(m_digest); }
+
+ private:
+  std::string m_digest;
+  bool m_space = false;
+};
+
+std::string to_json(const Workload_event &event) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+  writer.StartObject();
+
+  writer.Key("session");
+  writer.Uint64(event.session);
+  writer.Key("start");
+  writer.Uint64(event.start);
+
+  if (Workload_event::Type::CONNECT == event.type) {
+    writer.Key("connect");
+    writer.String(event.sql.c_str(),
+                  static_cast<rapidjson::SizeType>(event.sql.length()));
+  } else {
+    writer.Key("duration");
+    writer.Uint64(event.duration);
+    writer.Key("sql");
+    writer.String(event.sql.c_str(),
+                  static_cast<rapidjson::SizeType>(event.sql.length()));
+
+    if (event.error) {
+      writer.Key("error");
+      writer.Uint(event.error);
+    }
+
+    if (event.filtered) {
+      writer.Key("filtered");
+      writer.Bool(true);
+    }
+  }
+
+  writer.EndObject();
+
+  return std::string{buffer.GetString(), buffer.GetSize()};
+}
+
+Workload_event from_json(const std::string &line, std::size_t line_no) {
+  rapidjson::Document doc;
+  doc.Parse(line.c_str(), line.length());
+
+  const auto error = [line_no](const std::string &msg) {
+    return std::runtime_error("Malformed workload file, line " +
+                              std::to_string(line_no) + ": " + msg);
+  };
+
+  if (doc.HasParseError()) {
+    throw error(rapidjson::GetParseError_En(doc.GetParseError()));
+  }
+
+  if (!doc.IsObject() || !doc.HasMember("session") ||
+      !doc["session"].IsUint64() || !doc.HasMember("start") ||
+      !doc["start"].IsUint64()) {
+    throw error("expected an object with 'session' and 'start' members");
+  }
+
+  Workload_event event;
+  event.session = doc["session"].GetUint64();
+  event.start = doc["start"].GetUint64();
+
+  if (doc.HasMember("connect") && doc["connect"].IsString()) {
+    event.type = Workload_event::Type::CONNECT;
+    event.sql = doc["connect"].GetString();
+  } else if (doc.HasMember("sql") && doc["sql"].IsString()) {
+    event.type = Workload_event::Type::QUERY;
+    event.sql = doc["sql"].GetString();
+
+    if (doc.HasMember("duration") && doc["duration"].IsUint64()) {
+      event.duration = doc["duration"].GetUint64();
+    }
+
+    if (doc.HasMember("error") && doc["error"].IsUint()) {
+      event.error = doc["error"].GetUint();
+    }
+
+    if (doc.HasMember("filtered") && doc["filtered"].IsBool()) {
+      event.filtered = doc["filtered"].GetBool();
+    }
+  } else {
+    throw error("expected either 'connect' or 'sql' member");
+  }
+
+  return event;
+}
+
+/**
+ * Writes events of a single captured session.
+ */
+class Session_capture final {
+ public:
+  void connect(const Connection_options &options) {
+    if (const auto writer = capture_writer()) {
+      Workload_event event;
+
+      event.type = Workload_event::Type::CONNECT;
+      event.session = writer->new_session();
+      event.start = writer->now();
+
+      if (options.has_schema()) {
+        event.sql = options.get_schema();
+      }
+
+      m_session = event.session;
+      writer->write(event);
+    }
+  }
+
+  template <typename F>
+  auto capture(std::string_view sql, F &&f) {
+    const auto writer = m_session ? capture_writer() : nullptr;
+
+    if (!writer) {
+      return f();
+    }
+
+    Workload_event event;
+    event.session = m_session;
+    event.start = writer->now();
+    // statements which may contain passwords are not written
+    event.filtered = writer->is_filtered(sql);
+
+    if (!event.filtered) {
+      event.sql = sql;
+    }
+
+    try {
+      auto result = f();
+
+      event.duration = writer->now() - event.start;
+      writer->write(event);
+
+      return result;
+    } catch (const db::Error &e) {
+      event.duration = writer->now() - event.start;
+      event.error = static_cast<uint32_t>(e.code());
+      writer->write(event);
+
+      throw;
+    }
+  }
+
+ private:
+  uint64_t m_session = 0;
+};
+
+class Capture_mysql : public mysql::Session {
+ public:
+  using super = mysql::Session;
+
+  Capture_mysql() = default;
+
+  std::shared_ptr<IResult> querys(
+      const char *sql, size_t length, bool buffered,
+      const std::vector<Query_attribute> &query_attributes = {}) override {
+    return m_capture.capture({sql, length}, [&]() {
+      return super::querys(sql, length, buffered, query_attributes);
+    });
+  }
+
+  std::shared_ptr<IResult> query_udf(std::string_view sql,
+                                     bool buffered) override {
+    return m_capture.capture(
+        sql, [&]() { return super::query_udf(sql, buffered); });
+  }
+
+  void executes(const char *sql, size_t length) override {
+    m_capture.capture({sql, length}, [&]() {
+      super::executes(sql, length);
+      return true;
+    });
+  }
+
+ protected:
+  void do_connect(const Connection_options &data) override {
+    super::do_connect(data);
+    m_capture.connect(data);
+  }
+
+ private:
+  Session_capture m_capture;
+};
+
+class Capture_mysqlx : public mysqlx::Session {
+ public:
+  using super = mysqlx::Session;
+
+  Capture_mysqlx() = default;
+
+  std::shared_ptr<IResult> querys(
+      const char *sql, size_t length, bool buffered,
+      const std::vector<Query_attribute> &query_attributes = {}) override {
+    return m_capture.capture({sql, length}, [&]() {
+      return super::querys(sql, length, buffered, query_attributes);
+    });
+  }
+
+  std::shared_ptr<IResult> query_udf(std::string_view sql,
+                                     bool buffered) override {
+    return m_capture.capture(
+        sql, [&]() { return super::query_udf(sql, buffered); });
+  }
+
+  void executes(const char *sql, size_t length) override {
+    m_capture.capture({sql, length}, [&]() {
+      super::executes(sql, length);
+      return true;
+    });
+  }
+
+  std::shared_ptr<IResult> execute_stmt(
+      const std::string &ns, const std::string &stmt,
+      const ::xcl::Argument_array &args) override {
+    if ("sql" != ns) {
+      // admin commands are not captured
+      return super::execute_stmt(ns, stmt, args);
+    }
+
+    return m_capture.capture(
+        args.empty() ? stmt : replay::query(stmt, args),
+        [&]() { return super::execute_stmt(ns, stmt, args); });
+  }
+
+ protected:
+  void do_connect(const Connection_options &data) override {
+    super::do_connect(data);
+    m_capture.connect(data);
+  }
+
+ private:
+  Session_capture m_capture;
+};
+
+}  // namespace
+
+std::string statement_digest(std::string_view sql) {
+  Digest_builder digest;
+  const auto length = sql.length();
+  std::size_t i = 0;
+
+  while (i < length) {
+    const auto c = sql[i];
+
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      digest.space();
+      ++i;
+    } else if ('#' == c ||
+               ('-' == c && i + 2 < length && '-' == sql[i + 1] &&
+                std::isspace(static_cast<unsigned char>(sql[i + 2])))) {
+      // single line comment
+      i = sql.find('\n', i);
+
+      if (std::string_view::npos == i) {
+        i = length;
+      }
+
+      digest.space();
+    } else if ('/' == c && i + 1 < length && '*' == sql[i + 1]) {
+      // multi-line comment
+      i = sql.find("*/", i + 2);
+      i = std::string_view::npos == i ? length : i + 2;
+
+      digest.space();
+    } else if ('\'' == c || '"' == c) {
+      // string literal
+      ++i;
+
+      while (i < length) {
+        if ('\\' == sql[i]) {
+          i += 2;
+        } else if (c == sql[i]) {
+          if (i + 1 < length && c == sql[i + 1]) {
+            // doubled quote
+            i += 2;
+          } else {
+            ++i;
+            break;
+          }
+        } else {
+          ++i;
+        }
+      }
+
+      digest.literal();
+    } else if ('`' == c) {
+      // quoted identifier, copied verbatim
+      auto end = i + 1;
+
+      while (end < length) {
+        if ('`' == sql[end]) {
+          if (end + 1 < length && '`' == sql[end + 1]) {
+            end += 2;
+          } else {
+            ++end;
+            break;
+          }
+        } else {
+          ++end;
+        }
+      }
+
+      digest.append(sql.substr(i, end - i));
+      i = end;
+    } else if (std::isdigit(static_cast<unsigned char>(c)) ||
+               ('.' == c && i + 1 < length &&
+                std::isdigit(static_cast<unsigned char>(sql[i + 1])))) {
+      // numeric literal, including hexadecimal and exponents
+      ++i;
+
+      while (i < length &&
+             (is_word_char(sql[i]) || '.' == sql[i] ||
+              (('+' == sql[i] || '-' == sql[i]) &&
+               ('e' == sql[i - 1] || 'E' == sql[i - 1])))) {
+        ++i;
+      }
+
+      digest.literal();
+    } else if (is_word_char(c)) {
+      auto end = i + 1;
+
+      while (end < length && is_word_char(sql[end])) {
+        ++end;
+      }
+
+      digest.append(shcore::str_upper(sql.substr(i, end - i)));
+      i = end;
+    } else {
+      digest.punctuation(c);
+      ++i;
+    }
+  }
+
+  return digest.digest();
+}
+
+void Latency_histogram::add(uint64_t latency) {
+  std::size_t bucket = 0;
+
+  while (latency >> bucket && bucket + 1 < k_buckets) {
+    ++bucket;
+  }
+
+  ++m_buckets[bucket];
+
+  if (!m_count || latency < m_min) {
+    m_min = latency;
+  }
+
+  m_max = std::max(m_max, latency);
+  m_total += latency;
+  ++m_count;
+}
+
+void Latency_histogram::merge(const Latency_histogram &other) {
+  if (!other.m_count) {
+    return;
+  }
+
+  for (std::size_t i = 0; i < k_buckets; ++i) {
+    m_buckets[i] += other.m_buckets[i];
+  }
+
+  m_min = m_count ? std::min(m_min, other.m_min) : other.m_min;
+  m_max = std::max(m_max, other.m_max);
+  m_total += other.m_total;
+  m_count += other.m_count;
+}
+
+uint64_t Latency_histogram::percentile(double p) const {
+  if (!m_count) {
+    return 0;
+  }
+
+  const auto target = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(p / 100.0 * m_count)));
+  uint64_t seen = 0;
+
+  for (std::size_t i = 0; i < k_buckets; ++i) {
+    seen += m_buckets[i];
+
+    if (seen >= target) {
+      const uint64_t upper = i ? (uint64_t{1} << i) - 1 : 0;
+      return std::clamp(upper, m_min, m_max);
+    }
+  }
+
+  return m_max;
+}
+
+Workload_writer::Workload_writer(const std::string &path,
+                                 std::vector<std::string> ignore_patterns)
+    : m_path(path),
+      m_ignore_patterns(std::move(ignore_patterns)),
+      m_start(std::chrono::steady_clock::now()) {
+  // captured statements may contain sensitive data, file is created with
+  // user-only permissions, permissions of an existing file are restricted
+  // before anything is written
+  if (const auto file = shcore::create_private_file(path)) {
+    fclose(file);
+  }
+
+  if (0 != shcore::set_user_only_permissions(path)) {
+    throw std::runtime_error("Could not set permissions of workload file '" +
+                             path + "': " + shcore::errno_to_string(errno));
+  }
+
+  m_stream.open(path, std::ios::out | std::ios::trunc);
+
+  if (!m_stream.good()) {
+    throw std::runtime_error("Could not open workload file '" + path +
+                             "' for writing: " +
+                             shcore::errno_to_string(errno));
+  }
+
+  m_stream << "{\"version\":" << k_workload_version << "}\n";
+}
+
+uint64_t Workload_writer::now() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - m_start)
+      .count();
+}
+
+void Workload_writer::write(const Workload_event &event) {
+  const auto json = to_json(event);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stream << json << '\n';
+}
+
+bool Workload_writer::is_filtered(std::string_view sql) const {
+  for (const auto &pattern : m_ignore_patterns) {
+    if (shcore::match_glob(pattern, sql)) return true;
+  }
+
+  return false;
+}
+
+std::vector<Workload_event> read_workload(const std::string &path) {
+  std::ifstream stream(path);
+
+  if (!stream.good()) {
+    throw std::runtime_error("Could not open workload file '" + path +
+                             "': " + shcore::errno_to_string(errno));
+  }
+
+  std::string line;
+  std::size_t line_no = 1;
+
+  if (!std::getline(stream, line)) {
+    throw std::runtime_error("Workload file '" + path + "' is empty");
+  }
+
+  {
+    rapidjson::Document doc;
+    doc.Parse(line.c_str(), line.length());
+
+    if (doc.HasParseError() || !doc.IsObject() || !doc.HasMember("version") ||
+        !doc["version"].IsInt()) {
+      throw std::runtime_error("File '" + path +
+                               "' is not a workload capture file");
+    }
+
+    if (doc["version"].GetInt() > k_workload_version) {
+      throw std::runtime_error("Workload file '" + path +
+                               "' has an unsupported version " +
+                               std::to_string(doc["version"].GetInt()));
+    }
+  }
+
+  std::vector<Workload_event> events;
+
+  while (std::getline(stream, line)) {
+    ++line_no;
+
+    if (!line.empty()) {
+      events.emplace_back(from_json(line, line_no));
+    }
+  }
+
+  // writes from multiple threads may not be ordered
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Workload_event &l, const Workload_event &r) {
+                     return l.start < r.start;
+                   });
+
+  return events;
+}
+
+void start_workload_capture(const std::string &path) {
+  std::lock_guard<std::mutex> lock(g_capture_mutex);
+
+  if (g_capture_writer) {
+    throw std::logic_error("Workload capture is already active");
+  }
+
+  if (Mode::Direct != g_replay_mode) {
+    throw std::logic_error(
+        "Workload capture cannot be used while sessions are recorded or "
+        "replayed");
+  }
+
+  std::vector<std::string> ignore_patterns;
+
+  if (const auto options = mysqlsh::current_shell_options(true)) {
+    ignore_patterns =
+        shcore::split_string(options->get().log_sql_ignore_unsafe, ":");
+  }
+
+  g_capture_writer =
+      std::make_shared<Workload_writer>(path, std::move(ignore_patterns));
+
+  mysql::Session::set_factory_function(
+      []() { return std::shared_ptr<mysql::Session>(new Capture_mysql()); });
+  mysqlx::Session::set_factory_function(
+      []() { return std::shared_ptr<mysqlx::Session>(new Capture_mysqlx()); });
+
+  log_info("Capturing workload to '%s'", path.c_str());
+}
+
+void stop_workload_capture() {
+  std::lock_guard<std::mutex> lock(g_capture_mutex);
+
+  if (!g_capture_writer) {
+    return;
+  }
+
+  mysql::Session::set_factory_function({});
+  mysqlx::Session::set_factory_function({});
+
+  log_info("Workload captured to '%s'", g_capture_writer->path().c_str());
+
+  g_capture_writer.reset();
+}
+
+bool is_workload_capture_active() {
+  std::lock_guard<std::mutex> lock(g_capture_mutex);
+  return !!g_capture_writer;
+}
+
+struct Workload_replayer::Worker_result {
+  std::unordered_map<std::string, Statement_stats> statements;
+  uint64_t executed = 0;
+  uint64_t errors = 0;
+  std::exception_ptr exception;
+};
+
+Workload_replayer::Workload_replayer(std::vector<Workload_event> events,
+                                     Workload_replay_options options)
+    : m_events(std::move(events)), m_options(std::move(options)) {
+  if (!m_options.connect) {
+    throw std::invalid_argument("Session factory is required");
+  }
+
+  if (!m_options.threads) {
+    throw std::invalid_argument("At least one thread is required");
+  }
+
+  if (m_options.speed_up < 0) {
+    throw std::invalid_argument("Speed-up factor cannot be negative");
+  }
+}
+
+Workload_replay_result Workload_replayer::run() {
+  // captured sessions are assigned to the workers in the order they were
+  // created, each worker replays events of its sessions in order of their
+  // start time
+  std::map<uint64_t, std::size_t> session_to_worker;
+
+  for (const auto &event : m_events) {
+    if (!session_to_worker.count(event.session)) {
+      const auto worker = session_to_worker.size() % m_options.threads;
+      session_to_worker.emplace(event.session, worker);
+    }
+  }
+
+  const auto threads = std::min(m_options.threads, session_to_worker.size());
+  std::vector<std::vector<const Workload_event *>> events(threads);
+
+  for (const auto &event : m_events) {
+    events[session_to_worker[event.session]].emplace_back(&event);
+  }
+
+  std::vector<Worker_result> results(threads);
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back(mysqlsh::spawn_scoped_thread(
+        [this, i, start, &events, &results]() {
+          try {
+            replay(events[i], start, &results[i]);
+          } catch (...) {
+            results[i].exception = std::current_exception();
+            interrupt();
+          }
+        }));
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  for (const auto &result : results) {
+    if (result.exception) {
+      std::rethrow_exception(result.exception);
+    }
+  }
+
+  if (m_interrupted) {
+    throw std::runtime_error("Workload replay was interrupted");
+  }
+
+  Workload_replay_result summary;
+  std::unordered_map<std::string, Statement_stats> statements;
+
+  summary.sessions = session_to_worker.size();
+  summary.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+  for (auto &result : results) {
+    summary.executed += result.executed;
+    summary.errors += result.errors;
+
+    for (auto &s : result.statements) {
+      auto &stats = statements[s.first];
+
+      stats.latency.merge(s.second.latency);
+      stats.errors += s.second.errors;
+    }
+  }
+
+  summary.statements.reserve(statements.size());
+
+  for (auto &s : statements) {
+    s.second.digest = s.first;
+    summary.statements.emplace_back(std::move(s.second));
+  }
+
+  std::sort(summary.statements.begin(), summary.statements.end(),
+            [](const Statement_stats &l, const Statement_stats &r) {
+              return l.latency.total() > r.latency.total();
+            });
+
+  return summary;
+}
+
+void Workload_replayer::replay(
+    const std::vector<const Workload_event *> &events,
+    std::chrono::steady_clock::time_point start, Worker_result *result) {
+  std::unordered_map<uint64_t, std::shared_ptr<ISession>> sessions;
+  std::unordered_map<uint64_t, std::size_t> remaining;
+
+  for (const auto event : events) {
+    ++remaining[event->session];
+  }
+
+  shcore::on_leave_scope close_sessions([&sessions]() {
+    for (const auto &session : sessions) {
+      session.second->close();
+    }
+  });
+
+  const auto get_session = [this, &sessions](uint64_t id) {
+    auto &session = sessions[id];
+
+    if (!session) {
+      session = m_options.connect();
+    }
+
+    return session;
+  };
+
+  for (const auto event : events) {
+    if (m_options.speed_up > 0) {
+      const auto scheduled =
+          start + std::chrono::microseconds(static_cast<uint64_t>(
+                      event->start / m_options.speed_up));
+
+      // sleep in short intervals, so that interruption is not delayed
+      while (!m_interrupted && std::chrono::steady_clock::now() < scheduled) {
+        std::this_thread::sleep_until(
+            std::min(scheduled, std::chrono::steady_clock::now() +
+                                    std::chrono::milliseconds(100)));
+      }
+    }
+
+    if (m_interrupted) {
+      return;
+    }
+
+    const auto session = get_session(event->session);
+
+    if (Workload_event::Type::CONNECT == event->type) {
+      if (!event->sql.empty()) {
+        session->execute("USE " + shcore::quote_identifier(event->sql));
+      }
+    } else if (!event->filtered) {
+      auto &stats = result->statements[statement_digest(event->sql)];
+      const auto begin = std::chrono::steady_clock::now();
+
+      try {
+        session->execute(event->sql);
+      } catch (const db::Error &e) {
+        log_debug("Replayed statement failed: %s", e.format().c_str());
+
+        ++stats.errors;
+        ++result->errors;
+      }
+
+      stats.latency.add(std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - begin)
+                            .count());
+      ++result->executed;
+    }
+
+    if (0 == --remaining[event->session]) {
+      // no more statements in this session
+      session->close();
+      sessions.erase(event->session);
+    }
+  }
+}
+
+}  // namespace replay
+}  // namespace db
+}  // namespace mysqlshdk
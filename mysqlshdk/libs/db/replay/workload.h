@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_REPLAY_WORKLOAD_H_
+#define MYSQLSHDK_LIBS_DB_REPLAY_WORKLOAD_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace replay {
+
+/**
+ * Normalizes the given SQL statement: literals are replaced with '?', lists of
+ * literals are collapsed, comments are removed, whitespace is collapsed and
+ * unquoted words are converted to upper case. Statements which differ only in
+ * values of literals have the same digest.
+ */
+std::string statement_digest(std::string_view sql);
+
+/**
+ * Histogram of latencies (in microseconds), using buckets which are powers of
+ * two.
+ */
+class Latency_histogram final {
+ public:
+  void add(uint64_t latency);
+
+  void merge(const Latency_histogram &other);
+
+  uint64_t count() const { return m_count; }
+
+  uint64_t total() const { return m_total; }
+
+  uint64_t min() const { return m_count ? m_min : 0; }
+
+  uint64_t max() const { return m_max; }
+
+  uint64_t average() const { return m_count ? m_total / m_count : 0; }
+
+  /**
+   * Provides an upper bound of the given percentile.
+   *
+   * @param p Percentile, in range [0, 100].
+   */
+  uint64_t percentile(double p) const;
+
+ private:
+  static constexpr std::size_t k_buckets = 64;
+
+  // bucket N holds latencies in range [2^(N-1), 2^N), bucket 0 holds zeros
+  std::array<uint64_t, k_buckets> m_buckets{};
+  uint64_t m_count = 0;
+  uint64_t m_total = 0;
+  uint64_t m_min = 0;
+  uint64_t m_max = 0;
+};
+
+struct Workload_event {
+  enum class Type { CONNECT, QUERY };
+
+  Type type = Type::QUERY;
+  // ID of the captured session
+  uint64_t session = 0;
+  // start of the event, in microseconds since start of the capture
+  uint64_t start = 0;
+  // duration of the event, in microseconds
+  uint64_t duration = 0;
+  // QUERY: statement, CONNECT: default schema
+  std::string sql;
+  // error reported by the server when event was captured
+  uint32_t error = 0;
+  // QUERY: statement matched one of the ignore patterns, its text was not
+  // written and it is not replayed
+  bool filtered = false;
+};
+
+/**
+ * Writes captured events to a file, one JSON document per line. File is only
+ * accessible by the current user. Thread-safe.
+ */
+class Workload_writer final {
+ public:
+  /**
+   * @param path File to be written.
+   * @param ignore_patterns Glob patterns, text of the statements which match
+   *        any of them is not written (i.e. "*IDENTIFIED*").
+   */
+  explicit Workload_writer(const std::string &path,
+                           std::vector<std::string> ignore_patterns = {});
+
+  Workload_writer(const Workload_writer &) = delete;
+  Workload_writer(Workload_writer &&) = delete;
+
+  Workload_writer &operator=(const Workload_writer &) = delete;
+  Workload_writer &operator=(Workload_writer &&) = delete;
+
+  ~Workload_writer() = default;
+
+  /**
+   * Time elapsed since the capture has started, in microseconds.
+   */
+  uint64_t now() const;
+
+  /**
+   * Provides ID of a new captured session.
+   */
+  uint64_t new_session() { return ++m_sessions; }
+
+  void write(const Workload_event &event);
+
+  /**
+   * Checks if text of the given statement should not be written.
+   */
+  bool is_filtered(std::string_view sql) const;
+
+  const std::string &path() const { return m_path; }
+
+ private:
+  std::string m_path;
+  std::vector<std::string> m_ignore_patterns;
+  std::chrono::steady_clock::time_point m_start;
+  std::atomic<uint64_t> m_sessions{0};
+  std::mutex m_mutex;
+  std::ofstream m_stream;
+};
+
+/**
+ * Reads events written by the Workload_writer.
+ *
+ * @returns Events, sorted by their start time.
+ *
+ * @throws std::runtime_error if file cannot be read or is malformed.
+ */
+std::vector<Workload_event> read_workload(const std::string &path);
+
+/**
+ * Starts capturing SQL statements executed by all classic and X protocol
+ * sessions created from now on. CRUD operations of X protocol sessions are not
+ * captured. Text of statements matching the logSql.ignorePatternUnsafe option
+ * is not written.
+ *
+ * @throws std::logic_error if capture is already active or sessions are being
+ *         recorded or replayed.
+ */
+void start_workload_capture(const std::string &path);
+
+/**
+ * Stops the capture, sessions which are still open are no longer captured.
+ */
+void stop_workload_capture();
+
+bool is_workload_capture_active();
+
+struct Workload_replay_options {
+  using Session_factory = std::function<std::shared_ptr<ISession>()>;
+
+  // creates a new session connected to the target instance
+  Session_factory connect;
+
+  // maximum number of statements executed concurrently
+  std::size_t threads = 1;
+
+  // factor by which time between the statements is shortened, if 0, statements
+  // are executed without any delays
+  double speed_up = 1.0;
+};
+
+struct Statement_stats {
+  std::string digest;
+  Latency_histogram latency;
+  uint64_t errors = 0;
+};
+
+struct Workload_replay_result {
+  // sorted by the total execution time, in descending order
+  std::vector<Statement_stats> statements;
+  uint64_t sessions = 0;
+  uint64_t executed = 0;
+  uint64_t errors = 0;
+  // in microseconds
+  uint64_t duration = 0;
+};
+
+/**
+ * Replays the captured workload, preserving order of statements within each of
+ * the captured sessions. Each captured session is replayed using its own
+ * session to the target instance, captured sessions are distributed among the
+ * threads.
+ */
+class Workload_replayer final {
+ public:
+  Workload_replayer(std::vector<Workload_event> events,
+                    Workload_replay_options options);
+
+  Workload_replayer(const Workload_replayer &) = delete;
+  Workload_replayer(Workload_replayer &&) = delete;
+
+  Workload_replayer &operator=(const Workload_replayer &) = delete;
+  Workload_replayer &operator=(Workload_replayer &&) = delete;
+
+  ~Workload_replayer() = default;
+
+  /**
+   * Replays the workload.
+   *
+   * @throws std::runtime_error if replay was interrupted.
+   * @throws db::Error if session to the target instance cannot be established.
+   */
+  Workload_replay_result run();
+
+  void interrupt() { m_interrupted = true; }
+
+ private:
+  struct Worker_result;
+
+  void replay(const std::vector<const Workload_event *> &events,
+              std::chrono::steady_clock::time_point start,
+              Worker_result *result);
+
+  std::vector<Workload_event> m_events;
+  Workload_replay_options m_options;
+  std::atomic<bool> m_interrupted{false};
+};
+
+}  // namespace replay
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_REPLAY_WORKLOAD_H_
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/utils/json_row_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+/**
+ * Escape sequences used by rapidjson::Writer: 0 - character is written as is,
+ * 'u' - character is written as \u00XX, other - character is written as \X.
+ */
+constexpr std::array<char, 256> k_escape = [] {
+  std::array<char, 256> escape{};
+
+  for (int c = 0; c < 0x20; ++c) {
+    escape[c] = 'u';
+  }
+
+  escape['\b'] = 'b';
+  escape['\t'] = 't';
+  escape['\n'] = 'n';
+  escape['\f'] = 'f';
+  escape['\r'] = 'r';
+  escape['"'] = '"';
+  escape['\\'] = '\\';
+
+  return escape;
+}();
+
+constexpr char k_hex_digits[] = "0123456789ABCDEF";
+
+class String_stream final {
+ public:
+  using Ch = char;
+
+  explicit String_stream(std::string *out) : m_out(out) {}
+
+  void Put(Ch c) { m_out->push_back(c); }
+
+  void Flush() {}
+
+ private:
+  std::string *m_out;
+};
+
+template <typename T>
+inline void write_integer(T value, std::string *out) {
+  char buffer[24];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  out->append(buffer, result.ptr);
+}
+
+inline void write_double(double value, std::string *out) {
+  // same buffer size as used by shcore::My_writer
+  char buffer[32];
+  out->append(buffer, shcore::fmt_double(value, buffer, sizeof(buffer)));
+}
+
+}  // namespace
+
+Json_row_writer::Json_row_writer(const std::vector<Column> &metadata,
+                                 std::size_t binary_limit)
+    : m_binary_limit(binary_limit) {
+  m_fields.reserve(metadata.size());
+
+  for (const auto &column : metadata) {
+    auto &field = m_fields.emplace_back();
+    field.type = column.get_type();
+    write_string(column.get_column_label(), &field.key);
+    field.key += ':';
+  }
+}
+
+void Json_row_writer::write(const IRow &row, std::string *out) const {
+  out->push_back('{');
+
+  for (uint32_t i = 0, size = m_fields.size(); i < size; ++i) {
+    const auto &field = m_fields[i];
+
+    if (i > 0) out->push_back(',');
+
+    out->append(field.key);
+
+    if (row.is_null(i)) {
+      out->append("null");
+      continue;
+    }
+
+    switch (field.type) {
+      case Type::Null:
+        break;
+
+      case Type::String: {
+        const auto data = row.get_string_data(i);
+        write_string({data.first, data.second}, out);
+        break;
+      }
+
+      case Type::Bytes: {
+        const auto data = row.get_string_data(i);
+        write_bytes({data.first, data.second}, out);
+        break;
+      }
+
+      case Type::Json:
+        write_json(row.get_string(i), out);
+        break;
+
+      case Type::Geometry:
+      case Type::Date:
+      case Type::Time:
+      case Type::DateTime:
+      case Type::Enum:
+      case Type::Set:
+        write_string(row.get_as_string(i), out);
+        break;
+
+      case Type::Integer:
+        write_integer(row.get_int(i), out);
+        break;
+
+      case Type::UInteger:
+        write_integer(row.get_uint(i), out);
+        break;
+
+      case Type::Float:
+      case Type::Decimal:
+        write_double(static_cast<double>(row.get_float(i)), out);
+        break;
+
+      case Type::Double:
+        write_double(row.get_double(i), out);
+        break;
+
+      case Type::Bit: {
+        const auto [bit_value, bit_size] = row.get_bit(i);
+        write_string(shcore::bits_to_string_hex(bit_value, bit_size), out);
+        break;
+      }
+    }
+  }
+
+  out->push_back('}');
+}
+
+void Json_row_writer::write_json(const std::string &json, std::string *out) {
+  rapidjson::Document document;
+  document.Parse(json.c_str());
+
+  String_stream stream{out};
+  shcore::My_writer<String_stream> writer{stream};
+  document.Accept(writer);
+}
+
+void Json_row_writer::write_string(std::string_view s, std::string *out) {
+  out->reserve(out->size() + s.length() + 2);
+  out->push_back('"');
+
+  auto begin = s.data();
+  const auto end = begin + s.length();
+
+  for (auto it = begin; it != end; ++it) {
+    const auto c = static_cast<unsigned char>(*it);
+    const auto escape = k_escape[c];
+
+    if (0 == escape) continue;
+
+    out->append(begin, it);
+    out->push_back('\\');
+    out->push_back(escape);
+
+    if ('u' == escape) {
+      out->append("00");
+      out->push_back(k_hex_digits[c >> 4]);
+      out->push_back(k_hex_digits[c & 0xF]);
+    }
+
+    begin = it + 1;
+  }
+
+  out->append(begin, end);
+  out->push_back('"');
+}
+
+void Json_row_writer::write_bytes(std::string_view data,
+                                  std::string *out) const {
+  if (m_binary_limit > 0) {
+    // at most binary-limit + 1 bytes are written, the extra byte is an
+    // indicator for the consumer of the data that a truncation happened
+    data = data.substr(0, m_binary_limit + 1);
+  }
+
+  // base64 does not contain any characters which need to be escaped
+  const auto offset = out->size();
+  out->resize(offset + shcore::base64_encoded_length(data.length()) + 2);
+
+  auto target = out->data() + offset;
+  *target++ = '"';
+  target = shcore::encode_base64(data, target);
+  *target++ = '"';
+
+  out->resize(target - out->data());
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
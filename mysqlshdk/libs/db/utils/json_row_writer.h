@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_DB_UTILS_JSON_ROW_WRITER_H_
+#define MYSQLSHDK_LIBS_DB_UTILS_JSON_ROW_WRITER_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Writes rows as compact JSON documents, producing the same output as
+ * shcore::JSON_dumper in non-pretty mode.
+ *
+ * Values are written directly to the output buffer, without creating the
+ * intermediate values, quoted and escaped column names are computed once.
+ */
+class Json_row_writer final {
+ public:
+  /**
+   * @param metadata Columns of the rows to be written.
+   * @param binary_limit If not 0, at most binary_limit + 1 bytes of binary
+   *        values are written.
+   */
+  Json_row_writer(const std::vector<Column> &metadata,
+                  std::size_t binary_limit);
+
+  Json_row_writer(const Json_row_writer &) = delete;
+  Json_row_writer(Json_row_writer &&) = default;
+
+  Json_row_writer &operator=(const Json_row_writer &) = delete;
+  Json_row_writer &operator=(Json_row_writer &&) = default;
+
+  ~Json_row_writer() = default;
+
+  /**
+   * Appends a JSON object holding all the fields of the given row.
+   */
+  void write(const IRow &row, std::string *out) const;
+
+  /**
+   * Appends the given JSON document, normalized.
+   */
+  static void write_json(const std::string &json, std::string *out);
+
+  /**
+   * Appends the given string, quoted and escaped.
+   */
+  static void write_string(std::string_view s, std::string *out);
+
+ private:
+  struct Field {
+    Type type;
+    // "name":
+    std::string key;
+  };
+
+  void write_bytes(std::string_view data, std::string *out) const;
+
+  std::vector<Field> m_fields;
+  std::size_t m_binary_limit;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_UTILS_JSON_ROW_WRITER_H_
@@ -0,0 +1,743 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/binlog_reader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_lexing.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+namespace {
+
+// server sends an EOF packet instead of waiting for new events
+constexpr uint16_t k_binlog_dump_non_block = 1;
+
+// rows event flag, set in the last event of a statement
+constexpr uint16_t k_stmt_end_flag = 1;
+
+// post-header of a query event: thread ID (4), execution time (4), length of
+// the schema name (1), error code (2), length of the status variables (2)
+constexpr std::size_t k_query_post_header_size = 13;
+
+// post-header of a rows event: table ID (6), flags (2)
+constexpr std::size_t k_rows_post_header_size = 8;
+
+// post-header of a table map event: table ID (6), flags (2)
+constexpr std::size_t k_table_map_post_header_size = 8;
+
+constexpr std::size_t k_checksum_alg_size = 1;
+constexpr std::size_t k_checksum_size = 4;
+constexpr uint8_t k_checksum_crc32 = 1;
+
+uint64_t read_uint(const char *data, std::size_t size) {
+  uint64_t result = 0;
+
+  for (std::size_t i = 0; i < size; ++i) {
+    result |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+
+  return result;
+}
+
+[[noreturn]] void throw_malformed_event(Binlog_event_type type) {
+  throw std::runtime_error(shcore::str_format(
+      "Malformed binary log event of type %d", static_cast<int>(type)));
+}
+
+std::string encode_event(std::string_view event) {
+  std::string result;
+  const auto data = reinterpret_cast<const unsigned char *>(event.data());
+
+  if (!shcore::encode_base64(data, static_cast<int>(event.size()), &result)) {
+    throw std::runtime_error("Failed to encode a binary log event");
+  }
+
+  return result;
+}
+
+Binlog_statement_target make_target(Binlog_statement_target::Type type,
+                                    std::string_view name,
+                                    std::string_view default_schema) {
+  Binlog_statement_target target;
+
+  if (name.empty()) {
+    return target;
+  }
+
+  try {
+    if (Binlog_statement_target::Type::SCHEMA == type) {
+      target.schema = shcore::unquote_identifier(std::string{name});
+    } else {
+      shcore::split_schema_and_table(std::string{name}, &target.schema,
+                                     &target.name);
+
+      if (target.schema.empty()) {
+        target.schema = default_schema;
+      }
+    }
+  } catch (const std::exception &) {
+    return {};
+  }
+
+  target.type = type;
+
+  return target;
+}
+
+bool is_savepoint_statement(std::string_view query) {
+  // plain ROLLBACK is handled separately, this is ROLLBACK TO SAVEPOINT
+  return shcore::str_caseeq(
+      mysqlshdk::utils::SQL_iterator{query, 0, false}.next_token(),
+      "SAVEPOINT", "ROLLBACK", "RELEASE");
+}
+
+std::string_view next_name(mysqlshdk::utils::SQL_iterator *it) {
+  auto token = it->next_token();
+
+  while (shcore::str_caseeq(token, "IF", "NOT", "EXISTS")) {
+    token = it->next_token();
+  }
+
+  return token;
+}
+
+}  // namespace
+
+Binlog_event_header parse_binlog_event_header(std::string_view event) {
+  if (event.size() < Binlog_event_header::k_size) {
+    throw std::runtime_error("Binary log event is too short");
+  }
+
+  Binlog_event_header header;
+  const auto data = event.data();
+
+  header.timestamp = static_cast<uint32_t>(read_uint(data, 4));
+  header.type = static_cast<Binlog_event_type>(data[4]);
+  header.server_id = static_cast<uint32_t>(read_uint(data + 5, 4));
+  header.event_size = static_cast<uint32_t>(read_uint(data + 9, 4));
+  header.log_pos = static_cast<uint32_t>(read_uint(data + 13, 4));
+  header.flags = static_cast<uint16_t>(read_uint(data + 17, 2));
+
+  if (header.event_size < Binlog_event_header::k_size ||
+      header.event_size > event.size()) {
+    throw_malformed_event(header.type);
+  }
+
+  return header;
+}
+
+uint32_t binlog_event_size(std::string_view header) {
+  if (header.size() < Binlog_event_header::k_size) {
+    throw std::runtime_error("Binary log event is too short");
+  }
+
+  const auto size = static_cast<uint32_t>(read_uint(header.data() + 9, 4));
+
+  if (size < Binlog_event_header::k_size) {
+    throw_malformed_event(static_cast<Binlog_event_type>(header[4]));
+  }
+
+  return size;
+}
+
+uint32_t binlog_checksum_size(std::string_view format_description_event) {
+  // format description event is always followed by the checksum algorithm
+  // and the checksum, regardless of the algorithm which is used
+  if (format_description_event.size() <
+      Binlog_event_header::k_size + k_checksum_alg_size + k_checksum_size) {
+    throw_malformed_event(Binlog_event_type::FORMAT_DESCRIPTION);
+  }
+
+  const auto alg = static_cast<uint8_t>(
+      format_description_event[format_description_event.size() -
+                               k_checksum_size - k_checksum_alg_size]);
+
+  return k_checksum_crc32 == alg ? k_checksum_size : 0;
+}
+
+Binlog_event_support binlog_event_support(Binlog_event_type type) {
+  switch (type) {
+    case Binlog_event_type::FORMAT_DESCRIPTION:
+    case Binlog_event_type::QUERY:
+    case Binlog_event_type::XID:
+    case Binlog_event_type::TABLE_MAP:
+      return Binlog_event_support::APPLIED;
+
+    case Binlog_event_type::INTVAR:
+    case Binlog_event_type::RAND:
+    case Binlog_event_type::USER_VAR:
+    case Binlog_event_type::BEGIN_LOAD_QUERY:
+    case Binlog_event_type::EXECUTE_LOAD_QUERY:
+    case Binlog_event_type::INCIDENT:
+    case Binlog_event_type::XA_PREPARE:
+    case Binlog_event_type::TRANSACTION_PAYLOAD:
+      return Binlog_event_support::UNSUPPORTED;
+
+    default:
+      return is_binlog_rows_event(type) ? Binlog_event_support::APPLIED
+                                        : Binlog_event_support::IGNORED;
+  }
+}
+
+bool is_binlog_rows_event(Binlog_event_type type) {
+  switch (type) {
+    case Binlog_event_type::WRITE_ROWS_V1:
+    case Binlog_event_type::UPDATE_ROWS_V1:
+    case Binlog_event_type::DELETE_ROWS_V1:
+    case Binlog_event_type::WRITE_ROWS:
+    case Binlog_event_type::UPDATE_ROWS:
+    case Binlog_event_type::DELETE_ROWS:
+    case Binlog_event_type::PARTIAL_UPDATE_ROWS:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+bool binlog_rows_event_ends_statement(std::string_view event) {
+  const auto header = parse_binlog_event_header(event);
+  assert(is_binlog_rows_event(header.type));
+
+  if (header.event_size <
+      Binlog_event_header::k_size + k_rows_post_header_size) {
+    throw_malformed_event(header.type);
+  }
+
+  const auto flags = read_uint(event.data() + Binlog_event_header::k_size +
+                                   k_rows_post_header_size - 2,
+                               2);
+
+  return 0 != (flags & k_stmt_end_flag);
+}
+
+Binlog_query_event parse_binlog_query_event(std::string_view event,
+                                            uint32_t checksum_size) {
+  const auto header = parse_binlog_event_header(event);
+  assert(Binlog_event_type::QUERY == header.type);
+
+  constexpr auto k_body_offset =
+      Binlog_event_header::k_size + k_query_post_header_size;
+
+  if (header.event_size < k_body_offset + checksum_size) {
+    throw_malformed_event(header.type);
+  }
+
+  const auto data = event.data();
+  const auto schema_length =
+      read_uint(data + Binlog_event_header::k_size + 8, 1);
+  const auto status_vars_length =
+      read_uint(data + Binlog_event_header::k_size + 11, 2);
+  const auto schema_offset = k_body_offset + status_vars_length;
+  // schema name is followed by a NULL character
+  const auto query_offset = schema_offset + schema_length + 1;
+  const auto end = header.event_size - checksum_size;
+
+  if (query_offset > end) {
+    throw_malformed_event(header.type);
+  }
+
+  Binlog_query_event result;
+
+  result.schema = event.substr(schema_offset, schema_length);
+  result.query = event.substr(query_offset, end - query_offset);
+
+  return result;
+}
+
+Binlog_table_map_event parse_binlog_table_map_event(std::string_view event) {
+  const auto header = parse_binlog_event_header(event);
+  assert(Binlog_event_type::TABLE_MAP == header.type);
+
+  // body: length of the schema name (1), schema name, NULL character, length
+  // of the table name (1), table name, NULL character, column data
+  auto offset = Binlog_event_header::k_size + k_table_map_post_header_size;
+  const auto read_name = [&]() {
+    if (offset + 1 > header.event_size) {
+      throw_malformed_event(header.type);
+    }
+
+    const auto length = read_uint(event.data() + offset, 1);
+    ++offset;
+
+    if (offset + length + 1 > header.event_size) {
+      throw_malformed_event(header.type);
+    }
+
+    const auto name = event.substr(offset, length);
+    offset += length + 1;
+
+    return name;
+  };
+
+  Binlog_table_map_event result;
+
+  result.schema = read_name();
+  result.table = read_name();
+
+  return result;
+}
+
+bool is_binlog_dml_statement(std::string_view query) {
+  mysqlshdk::utils::SQL_iterator it{query, 0, false};
+  return shcore::str_caseeq(it.next_token(), "INSERT", "UPDATE", "DELETE",
+                            "REPLACE", "LOAD", "CALL", "DO", "SELECT", "WITH",
+                            "HANDLER");
+}
+
+Binlog_statement_target binlog_statement_target(
+    std::string_view query, std::string_view default_schema) {
+  using Type = Binlog_statement_target::Type;
+
+  mysqlshdk::utils::SQL_iterator it{query, 0, false};
+  auto token = it.next_token();
+
+  if (shcore::str_caseeq(token, "CREATE", "ALTER", "DROP")) {
+    // skip the modifiers (i.e. OR REPLACE, DEFINER = ...) up to the type of
+    // the object
+    while (it.valid()) {
+      token = it.next_token();
+
+      if (shcore::str_caseeq(token, "DATABASE", "SCHEMA")) {
+        return make_target(Type::SCHEMA, next_name(&it), default_schema);
+      }
+
+      if (shcore::str_caseeq(token, "TABLE", "VIEW")) {
+        return make_target(Type::TABLE, next_name(&it), default_schema);
+      }
+
+      if (shcore::str_caseeq(token, "PROCEDURE", "FUNCTION")) {
+        return make_target(Type::ROUTINE, next_name(&it), default_schema);
+      }
+
+      if (shcore::str_caseeq(token, "EVENT")) {
+        return make_target(Type::EVENT, next_name(&it), default_schema);
+      }
+
+      if (shcore::str_caseeq(token, "TRIGGER")) {
+        // trigger belongs to the schema of its table
+        auto target = make_target(Type::TABLE, next_name(&it), default_schema);
+
+        if (Type::NONE != target.type) {
+          target.type = Type::SCHEMA;
+          target.name.clear();
+        }
+
+        return target;
+      }
+
+      if (shcore::str_caseeq(token, "INDEX")) {
+        // index name is followed by the name of the table
+        while (it.valid() && !shcore::str_caseeq(it.next_token(), "ON")) {
+        }
+
+        return make_target(Type::TABLE, it.next_token(), default_schema);
+      }
+
+      if (shcore::str_caseeq(token, "USER", "ROLE", "SERVER", "TABLESPACE",
+                             "LOGFILE", "RESOURCE", "INSTANCE", "UNDO",
+                             "REFERENCE")) {
+        break;
+      }
+    }
+  } else if (shcore::str_caseeq(token, "RENAME")) {
+    if (shcore::str_caseeq(it.next_token(), "TABLE")) {
+      return make_target(Type::TABLE, it.next_token(), default_schema);
+    }
+  } else if (shcore::str_caseeq(token, "TRUNCATE")) {
+    token = it.next_token();
+
+    if (shcore::str_caseeq(token, "TABLE")) {
+      token = it.next_token();
+    }
+
+    return make_target(Type::TABLE, token, default_schema);
+  } else if (shcore::str_caseeq(token, "ANALYZE", "OPTIMIZE", "REPAIR")) {
+    token = it.next_token();
+
+    if (shcore::str_caseeq(token, "NO_WRITE_TO_BINLOG", "LOCAL")) {
+      token = it.next_token();
+    }
+
+    if (shcore::str_caseeq(token, "TABLE")) {
+      return make_target(Type::TABLE, it.next_token(), default_schema);
+    }
+  }
+
+  return {};
+}
+
+Binlog_reader::Binlog_reader(std::shared_ptr<db::mysql::Session> session)
+    : m_session(std::move(session)) {
+  assert(m_session);
+  std::memset(&m_rpl, 0, sizeof(m_rpl));
+}
+
+Binlog_reader::~Binlog_reader() { close(); }
+
+void Binlog_reader::open(const std::string &file, uint64_t position) {
+  assert(!m_open);
+
+  // let the server know that this client is checksum-aware, events are going
+  // to be sent exactly as they were written to the binary log
+  m_session->execute(
+      "SET @source_binlog_checksum = 'NONE', @master_binlog_checksum = "
+      "'NONE'");
+
+  m_file = file;
+
+  std::memset(&m_rpl, 0, sizeof(m_rpl));
+  m_rpl.file_name_length = m_file.length();
+  m_rpl.file_name = m_file.c_str();
+  m_rpl.start_position = position;
+  m_rpl.flags = MYSQL_RPL_SKIP_HEARTBEAT | k_binlog_dump_non_block;
+
+  const auto handle = m_session->get_handle();
+
+  if (mysql_binlog_open(handle, &m_rpl)) {
+    throw db::Error(mysql_error(handle), mysql_errno(handle),
+                    mysql_sqlstate(handle));
+  }
+
+  m_open = true;
+  m_eof = false;
+  m_checksum_size = 0;
+}
+
+std::string_view Binlog_reader::next() {
+  assert(m_open);
+
+  const auto handle = m_session->get_handle();
+
+  while (!m_eof) {
+    if (mysql_binlog_fetch(handle, &m_rpl)) {
+      throw db::Error(mysql_error(handle), mysql_errno(handle),
+                      mysql_sqlstate(handle));
+    }
+
+    if (0 == m_rpl.size) {
+      // EOF packet, there are no more events
+      m_eof = true;
+      break;
+    }
+
+    // skip the OK byte
+    std::string_view event{reinterpret_cast<const char *>(m_rpl.buffer) + 1,
+                           m_rpl.size - 1};
+    const auto header = parse_binlog_event_header(event);
+    event = event.substr(0, header.event_size);
+
+    switch (header.type) {
+      case Binlog_event_type::ROTATE:
+        // artificial rotate event is sent when the server starts reading a
+        // file, the real one is the last event in the file
+        if (!(header.flags & Binlog_event_header::k_artificial_flag)) {
+          m_eof = true;
+        }
+        break;
+
+      case Binlog_event_type::STOP:
+        m_eof = true;
+        break;
+
+      case Binlog_event_type::HEARTBEAT:
+      case Binlog_event_type::HEARTBEAT_V2:
+        break;
+
+      case Binlog_event_type::FORMAT_DESCRIPTION:
+        m_checksum_size = binlog_checksum_size(event);
+        return event;
+
+      default:
+        return event;
+    }
+  }
+
+  return {};
+}
+
+void Binlog_reader::close() {
+  if (m_open) {
+    mysql_binlog_close(m_session->get_handle(), &m_rpl);
+    m_open = false;
+  }
+}
+
+Binlog_file_reader::Binlog_file_reader(storage::IFile *file,
+                                       std::size_t buffer_size)
+    : m_file(file) {
+  assert(m_file);
+  m_buffer.resize(std::max(buffer_size, Binlog_event_header::k_size));
+}
+
+std::string_view Binlog_file_reader::next() {
+  // release the previous event
+  m_begin += m_event_size;
+  m_event_size = 0;
+
+  if (!fill(Binlog_event_header::k_size)) {
+    return {};
+  }
+
+  const auto size = binlog_event_size(
+      {m_buffer.data() + m_begin, Binlog_event_header::k_size});
+
+  if (!fill(size)) {
+    throw std::runtime_error("Binary log file " +
+                             m_file->full_path().masked() + " is truncated");
+  }
+
+  m_event_size = size;
+  m_position += size;
+
+  return {m_buffer.data() + m_begin, size};
+}
+
+bool Binlog_file_reader::fill(std::size_t size) {
+  if (m_end - m_begin >= size) {
+    return true;
+  }
+
+  // move the remaining data to the front of the buffer
+  if (m_begin > 0) {
+    std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+    m_end -= m_begin;
+    m_begin = 0;
+  }
+
+  if (m_buffer.size() < size) {
+    m_buffer.resize(size);
+  }
+
+  while (m_end < size) {
+    const auto bytes =
+        m_file->read(m_buffer.data() + m_end, m_buffer.size() - m_end);
+
+    if (bytes < 0) {
+      throw std::runtime_error("Failed to read binary log file " +
+                               m_file->full_path().masked() + ": " +
+                               shcore::errno_to_string(m_file->error()));
+    }
+
+    if (0 == bytes) {
+      break;
+    }
+
+    m_end += bytes;
+  }
+
+  if (m_end >= size) {
+    return true;
+  }
+
+  if (0 == m_end) {
+    // end of file
+    return false;
+  }
+
+  throw std::runtime_error("Binary log file " + m_file->full_path().masked() +
+                           " is truncated");
+}
+
+Binlog_statement_builder::Binlog_statement_builder(Execute execute,
+                                                   Filter filter)
+    : m_execute(std::move(execute)), m_filter(std::move(filter)) {
+  assert(m_execute);
+}
+
+void Binlog_statement_builder::push(std::string_view event) {
+  const auto header = parse_binlog_event_header(event);
+  event = event.substr(0, header.event_size);
+
+  switch (binlog_event_support(header.type)) {
+    case Binlog_event_support::IGNORED:
+      return;
+
+    case Binlog_event_support::UNSUPPORTED:
+      throw std::runtime_error(
+          shcore::str_format("Unsupported binary log event of type %d",
+                             static_cast<int>(header.type)));
+
+    case Binlog_event_support::APPLIED:
+      break;
+  }
+
+  switch (header.type) {
+    case Binlog_event_type::FORMAT_DESCRIPTION:
+      flush_rows_events();
+      m_checksum_size = binlog_checksum_size(event);
+      m_execute("BINLOG '" + encode_event(event) + "'");
+      break;
+
+    case Binlog_event_type::QUERY:
+      flush_rows_events();
+      push_query(event);
+      break;
+
+    case Binlog_event_type::XID:
+      flush_rows_events();
+      commit();
+      break;
+
+    case Binlog_event_type::TABLE_MAP:
+      push_table_map(event);
+      break;
+
+    default:
+      // rows event
+      append_rows_event(event);
+
+      if (is_binlog_rows_event(header.type) &&
+          binlog_rows_event_ends_statement(event)) {
+        flush_rows_events();
+      }
+      break;
+  }
+}
+
+uint64_t Binlog_statement_builder::push_all(std::string_view events) {
+  const auto transactions = m_transactions;
+
+  while (!events.empty()) {
+    const auto header = parse_binlog_event_header(events);
+    push(events.substr(0, header.event_size));
+    events.remove_prefix(header.event_size);
+  }
+
+  return m_transactions - transactions;
+}
+
+void Binlog_statement_builder::push_query(std::string_view event) {
+  const auto query = parse_binlog_query_event(event, m_checksum_size);
+
+  if (shcore::str_caseeq(query.query, "BEGIN")) {
+    m_execute("BEGIN");
+    m_in_transaction = true;
+    return;
+  }
+
+  if (shcore::str_caseeq(query.query, "COMMIT")) {
+    commit();
+    return;
+  }
+
+  if (shcore::str_caseeq(query.query, "ROLLBACK")) {
+    m_execute("ROLLBACK");
+    m_in_transaction = false;
+    return;
+  }
+
+  if (is_binlog_dml_statement(query.query)) {
+    throw std::runtime_error(
+        "Binary log contains a statement logged using the statement-based "
+        "format, which cannot be applied: " +
+        std::string{query.query.substr(0, 64)});
+  }
+
+  // savepoints are always applied
+  if (!m_filter || (m_in_transaction && is_savepoint_statement(query.query)) ||
+      m_filter(binlog_statement_target(query.query, query.schema))) {
+    if (!query.schema.empty() && query.schema != m_schema) {
+      m_schema = query.schema;
+      m_execute("USE " + shcore::quote_identifier(m_schema));
+    }
+
+    m_execute(std::string{query.query});
+  }
+
+  if (!m_in_transaction) {
+    // DDL, implicitly committed
+    ++m_transactions;
+  }
+}
+
+void Binlog_statement_builder::push_table_map(std::string_view event) {
+  if (m_filter) {
+    const auto table_map = parse_binlog_table_map_event(event);
+    Binlog_statement_target target;
+
+    target.type = Binlog_statement_target::Type::TABLE;
+    target.schema = table_map.schema;
+    target.name = table_map.table;
+
+    if (m_filter(target)) {
+      m_has_included_tables = true;
+    } else {
+      m_has_excluded_tables = true;
+    }
+
+    if (m_has_included_tables && m_has_excluded_tables) {
+      throw std::runtime_error(
+          "Binary log contains a statement which modifies both included and "
+          "excluded tables, including: " +
+          shcore::quote_identifier(target.schema) + "." +
+          shcore::quote_identifier(target.name));
+    }
+  }
+
+  append_rows_event(event);
+}
+
+void Binlog_statement_builder::append_rows_event(std::string_view event) {
+  if (!m_rows_events.empty()) {
+    m_rows_events += '\n';
+  }
+
+  m_rows_events += encode_event(event);
+}
+
+void Binlog_statement_builder::flush_rows_events() {
+  if (m_rows_events.empty()) {
+    return;
+  }
+
+  // statements which modify only the excluded tables are skipped
+  if (!m_has_excluded_tables) {
+    m_execute("BINLOG '" + m_rows_events + "'");
+  }
+
+  m_rows_events.clear();
+  m_has_included_tables = false;
+  m_has_excluded_tables = false;
+}
+
+void Binlog_statement_builder::commit() {
+  m_execute("COMMIT");
+  m_in_transaction = false;
+  ++m_transactions;
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_MYSQL_BINLOG_READER_H_
+#define MYSQLSHDK_LIBS_MYSQL_BINLOG_READER_H_
+
+#include <mysql.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+/**
+ * Types of the binary log events (v4 format) which are handled by the shell.
+ */
+enum class Binlog_event_type : uint8_t {
+  UNKNOWN = 0,
+  QUERY = 2,
+  STOP = 3,
+  ROTATE = 4,
+  INTVAR = 5,
+  RAND = 13,
+  USER_VAR = 14,
+  FORMAT_DESCRIPTION = 15,
+  XID = 16,
+  BEGIN_LOAD_QUERY = 17,
+  EXECUTE_LOAD_QUERY = 18,
+  TABLE_MAP = 19,
+  WRITE_ROWS_V1 = 23,
+  UPDATE_ROWS_V1 = 24,
+  DELETE_ROWS_V1 = 25,
+  INCIDENT = 26,
+  HEARTBEAT = 27,
+  WRITE_ROWS = 30,
+  UPDATE_ROWS = 31,
+  DELETE_ROWS = 32,
+  XA_PREPARE = 38,
+  PARTIAL_UPDATE_ROWS = 39,
+  TRANSACTION_PAYLOAD = 40,
+  HEARTBEAT_V2 = 41,
+};
+
+/**
+ * Common header of a binary log event.
+ */
+struct Binlog_event_header {
+  static constexpr std::size_t k_size = 19;
+
+  static constexpr uint16_t k_artificial_flag = 0x20;
+
+  uint32_t timestamp = 0;
+  Binlog_event_type type = Binlog_event_type::UNKNOWN;
+  uint32_t server_id = 0;
+  uint32_t event_size = 0;
+  // position of the next event in the binary log file
+  uint32_t log_pos = 0;
+  uint16_t flags = 0;
+};
+
+/**
+ * Parses the common header of an event.
+ *
+ * @param event Raw event, including the header.
+ *
+ * @throws std::runtime_error if the event is malformed.
+ */
+Binlog_event_header parse_binlog_event_header(std::string_view event);
+
+/**
+ * Reads the size of an event from its common header.
+ *
+ * @param header At least Binlog_event_header::k_size bytes of an event.
+ *
+ * @throws std::runtime_error if the header is malformed.
+ */
+uint32_t binlog_event_size(std::string_view header);
+
+/**
+ * Provides the size of the checksum appended to each event which follows the
+ * given format description event.
+ *
+ * @param event Raw format description event.
+ *
+ * @returns 0 if events are not checksummed, 4 if CRC32 is used.
+ */
+uint32_t binlog_checksum_size(std::string_view format_description_event);
+
+enum class Binlog_event_support {
+  // event is needed to apply the changes
+  APPLIED,
+  // event can be safely skipped
+  IGNORED,
+  // changes stored in this event cannot be applied
+  UNSUPPORTED,
+};
+
+/**
+ * Checks if changes stored in the given type of events can be applied using
+ * the Binlog_statement_builder.
+ */
+Binlog_event_support binlog_event_support(Binlog_event_type type);
+
+/**
+ * Checks if the given event contains row changes.
+ */
+bool is_binlog_rows_event(Binlog_event_type type);
+
+/**
+ * Checks if the given rows event is the last one of a statement, meaning that
+ * the table map events preceding it are no longer needed.
+ */
+bool binlog_rows_event_ends_statement(std::string_view event);
+
+struct Binlog_query_event {
+  std::string_view schema;
+  std::string_view query;
+};
+
+/**
+ * Extracts the default schema and the query from a query event.
+ *
+ * @param event Raw query event.
+ * @param checksum_size Size of the checksum appended to the event.
+ */
+Binlog_query_event parse_binlog_query_event(std::string_view event,
+                                            uint32_t checksum_size);
+
+struct Binlog_table_map_event {
+  std::string_view schema;
+  std::string_view table;
+};
+
+/**
+ * Extracts the schema and the table name from a table map event.
+ *
+ * @param event Raw table map event.
+ */
+Binlog_table_map_event parse_binlog_table_map_event(std::string_view event);
+
+/**
+ * Checks if the statement stored in a query event modifies the data, meaning
+ * that it was logged using the statement-based format.
+ */
+bool is_binlog_dml_statement(std::string_view query);
+
+/**
+ * Object modified by a statement stored in the binary log.
+ */
+struct Binlog_statement_target {
+  enum class Type {
+    // statement does not modify a schema object, i.e. account management
+    NONE,
+    SCHEMA,
+    TABLE,
+    ROUTINE,
+    EVENT,
+  };
+
+  Type type = Type::NONE;
+  std::string schema;
+  // empty if type is SCHEMA
+  std::string name;
+};
+
+/**
+ * Provides the object modified by the statement stored in a query event. If
+ * statement modifies multiple objects, the first one is returned.
+ *
+ * @param query Statement to be checked.
+ * @param default_schema Schema used if object name is not qualified.
+ */
+Binlog_statement_target binlog_statement_target(
+    std::string_view query, std::string_view default_schema);
+
+/**
+ * Reads events of a single binary log file from a server, using the
+ * replication protocol. Reading ends at the end of the file, events from the
+ * next file are not returned.
+ */
+class Binlog_reader final {
+ public:
+  Binlog_reader() = delete;
+
+  /**
+   * @param session Session used to read the events. It is not usable for any
+   *        other purpose once the reader is open.
+   */
+  explicit Binlog_reader(std::shared_ptr<db::mysql::Session> session);
+
+  Binlog_reader(const Binlog_reader &) = delete;
+  Binlog_reader(Binlog_reader &&) = delete;
+
+  Binlog_reader &operator=(const Binlog_reader &) = delete;
+  Binlog_reader &operator=(Binlog_reader &&) = delete;
+
+  ~Binlog_reader();
+
+  /**
+   * Starts reading the given file at the given position.
+   */
+  void open(const std::string &file, uint64_t position);
+
+  /**
+   * Provides the next event, rotate and heartbeat events are skipped.
+   *
+   * @returns Raw event, valid until the next call, or an empty view once the
+   *          end of the file is reached.
+   */
+  std::string_view next();
+
+  void close();
+
+  /**
+   * Size of the checksum appended to the events which are currently read.
+   */
+  uint32_t checksum_size() const { return m_checksum_size; }
+
+ private:
+  std::shared_ptr<db::mysql::Session> m_session;
+  std::string m_file;
+  MYSQL_RPL m_rpl;
+  bool m_open = false;
+  bool m_eof = false;
+  uint32_t m_checksum_size = 0;
+};
+
+/**
+ * Reads events stored in a file, one at a time.
+ */
+class Binlog_file_reader final {
+ public:
+  Binlog_file_reader() = delete;
+
+  /**
+   * @param file File to read from, needs to be open.
+   * @param buffer_size Initial size of the read buffer, buffer grows if an
+   *        event does not fit in it.
+   */
+  explicit Binlog_file_reader(storage::IFile *file,
+                              std::size_t buffer_size = 1024 * 1024);
+
+  Binlog_file_reader(const Binlog_file_reader &) = delete;
+  Binlog_file_reader(Binlog_file_reader &&) = delete;
+
+  Binlog_file_reader &operator=(const Binlog_file_reader &) = delete;
+  Binlog_file_reader &operator=(Binlog_file_reader &&) = delete;
+
+  ~Binlog_file_reader() = default;
+
+  /**
+   * Provides the next event.
+   *
+   * @returns Raw event, valid until the next call, or an empty view once the
+   *          end of the file is reached.
+   *
+   * @throws std::runtime_error if file cannot be read or is truncated.
+   */
+  std::string_view next();
+
+  /**
+   * Offset of the end of the event returned by the last call to next().
+   */
+  uint64_t position() const { return m_position; }
+
+ private:
+  bool fill(std::size_t size);
+
+  storage::IFile *m_file;
+  std::string m_buffer;
+  std::size_t m_begin = 0;
+  std::size_t m_end = 0;
+  std::size_t m_event_size = 0;
+  uint64_t m_position = 0;
+};
+
+/**
+ * Converts binary log events into SQL statements which apply the changes they
+ * represent. Row events are converted into BINLOG statements, preceded by the
+ * format description event they were written with.
+ */
+class Binlog_statement_builder final {
+ public:
+  using Execute = std::function<void(const std::string &)>;
+
+  /**
+   * Returns true if changes to the given object are to be applied.
+   */
+  using Filter = std::function<bool(const Binlog_statement_target &)>;
+
+  Binlog_statement_builder() = delete;
+
+  /**
+   * @param execute Executes the statements.
+   * @param filter If set, changes to objects which are not accepted by the
+   *        filter are skipped.
+   */
+  explicit Binlog_statement_builder(Execute execute, Filter filter = {});
+
+  Binlog_statement_builder(const Binlog_statement_builder &) = delete;
+  Binlog_statement_builder(Binlog_statement_builder &&) = delete;
+
+  Binlog_statement_builder &operator=(const Binlog_statement_builder &) =
+      delete;
+  Binlog_statement_builder &operator=(Binlog_statement_builder &&) = delete;
+
+  ~Binlog_statement_builder() = default;
+
+  /**
+   * Processes the given event, executing any statements which are complete.
+   *
+   * @throws std::runtime_error if event is not supported, or if it holds a
+   *         statement logged using the statement-based format.
+   */
+  void push(std::string_view event);
+
+  /**
+   * Processes all events stored in the given buffer.
+   *
+   * @returns number of transactions which were committed.
+   */
+  uint64_t push_all(std::string_view events);
+
+  /**
+   * Number of transactions committed so far.
+   */
+  uint64_t transactions() const { return m_transactions; }
+
+  /**
+   * Checks if a transaction was started and is not yet committed.
+   */
+  bool in_transaction() const { return m_in_transaction; }
+
+ private:
+  void push_query(std::string_view event);
+
+  void push_table_map(std::string_view event);
+
+  void append_rows_event(std::string_view event);
+
+  void flush_rows_events();
+
+  void commit();
+
+  Execute m_execute;
+  Filter m_filter;
+  uint32_t m_checksum_size = 0;
+  std::string m_rows_events;
+  // tables used by the current statement
+  bool m_has_included_tables = false;
+  bool m_has_excluded_tables = false;
+  std::string m_schema;
+  bool m_in_transaction = false;
+  uint64_t m_transactions = 0;
+};
+
+}  // namespace mysql
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_MYSQL_BINLOG_READER_H_
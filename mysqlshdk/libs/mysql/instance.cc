@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cinttypes>
 #include <map>
 #include <string_view>
 #include <utility>
@@ -74,6 +75,7 @@ void Instance::register_warnings_callback(const Warnings_callback &callback) {
 void Instance::refresh() {
   m_uuid.clear();
   m_group_name.clear();
+  clear_sysvar_snapshot();
 }
 
 std::string Instance::descr() const { return get_canonical_address(); }
@@ -235,6 +237,7 @@ void Instance::set_sysvar(const std::string &name, const std::string &value,
   set_stmt.done();
 
   query(set_stmt);
+  forget_sysvar(name, qualifier);
 }
 
 /**
@@ -260,6 +263,7 @@ void Instance::set_sysvar_default(const std::string &name,
   set_stmt.done();
 
   query(set_stmt);
+  forget_sysvar(name, qualifier);
 }
 
 /**
@@ -287,6 +291,7 @@ void Instance::set_sysvar(const std::string &name, const int64_t value,
   set_stmt.done();
 
   query(set_stmt);
+  forget_sysvar(name, qualifier);
 }
 
 /**
@@ -315,10 +320,101 @@ void Instance::set_sysvar(const std::string &name, const bool value,
   set_stmt.done();
 
   query(set_stmt);
+  forget_sysvar(name, qualifier);
+}
+
+void Instance::snapshot_sysvars(const std::vector<std::string> &names,
+                                const Var_qualifier scope) const {
+  const auto snapshot = sysvar_snapshot(scope);
+
+  if (!snapshot) {
+    throw std::runtime_error(
+        "Invalid variable scope to get variables value, "
+        "only GLOBAL and SESSION is supported.");
+  }
+
+  std::vector<std::string> missing;
+
+  for (const auto &name : names) {
+    auto lower = shcore::str_lower(name);
+
+    if (!snapshot->count(lower)) {
+      missing.emplace_back(std::move(lower));
+    }
+  }
+
+  if (missing.empty()) return;
+
+  const auto result = query(shcore::str_format(
+      "show %s variables where `variable_name` in (%s)",
+      Var_qualifier::GLOBAL == scope ? "GLOBAL" : "SESSION",
+      shcore::str_join(missing, ", ", shcore::quote_sql_string).c_str()));
+
+  // variables which do not exist are also remembered
+  for (auto &name : missing) {
+    snapshot->emplace(std::move(name), std::nullopt);
+  }
+
+  while (const auto row = result->fetch_one()) {
+    auto &value = (*snapshot)[shcore::str_lower(row->get_string(0))];
+
+    if (row->is_null(1)) {
+      value.reset();
+    } else {
+      value = row->get_string(1);
+    }
+  }
+}
+
+void Instance::clear_sysvar_snapshot() const {
+  if (m_sysvar_snapshot_hits) {
+    log_debug("%" PRIu64
+              " system variable reads were served from the snapshot, instead "
+              "of querying the server",
+              m_sysvar_snapshot_hits);
+  }
+
+  m_global_sysvars.clear();
+  m_session_sysvars.clear();
+  m_sysvar_snapshot_hits = 0;
+}
+
+Instance::Sysvar_snapshot *Instance::sysvar_snapshot(
+    const Var_qualifier scope) const {
+  switch (scope) {
+    case Var_qualifier::GLOBAL:
+      return &m_global_sysvars;
+
+    case Var_qualifier::SESSION:
+      return &m_session_sysvars;
+
+    default:
+      return nullptr;
+  }
+}
+
+void Instance::forget_sysvar(const std::string &name,
+                             const Var_qualifier qualifier) const {
+  // PERSIST_ONLY does not change the current value
+  const auto snapshot = sysvar_snapshot(
+      Var_qualifier::PERSIST == qualifier ? Var_qualifier::GLOBAL : qualifier);
+
+  if (snapshot && !snapshot->empty()) {
+    snapshot->erase(shcore::str_lower(name));
+  }
 }
 
 std::optional<std::string> Instance::get_system_variable(
     std::string_view name, const Var_qualifier scope) const {
+  if (const auto snapshot = sysvar_snapshot(scope);
+      snapshot && !snapshot->empty()) {
+    if (const auto it = snapshot->find(shcore::str_lower(name));
+        snapshot->end() != it) {
+      ++m_sysvar_snapshot_hits;
+      return it->second;
+    }
+  }
+
   shcore::sqlstring query;
   if (scope == Var_qualifier::GLOBAL)
     query = "show GLOBAL variables where ! in (?)"_sql;
@@ -182,6 +182,26 @@ class IInstance {
       const std::string &pattern,
       const Var_qualifier scope = Var_qualifier::GLOBAL) const = 0;
 
+  /**
+   * Reads the values of the given system variables using a single query, and
+   * serves the subsequent reads of these variables from memory, until the
+   * snapshot is cleared. Variables which are changed using set_sysvar() or
+   * set_sysvar_default() are removed from the snapshot.
+   *
+   * Variables which do not exist are also stored in the snapshot.
+   */
+  virtual void snapshot_sysvars(
+      const std::vector<std::string> & /* names */,
+      const Var_qualifier /* scope */ = Var_qualifier::GLOBAL) const {}
+
+  /**
+   * Discards the snapshot of system variables, subsequent reads query the
+   * server again.
+   */
+  virtual void clear_sysvar_snapshot() const {}
+
+  virtual bool has_sysvar_snapshot() const { return false; }
+
   virtual std::shared_ptr<db::ISession> get_session() const = 0;
   virtual void close_session() const = 0;
   virtual void install_plugin(const std::string &plugin_name) const = 0;
@@ -290,6 +310,34 @@ struct Suppress_binary_log {
   IInstance *m_instance;
 };
 
+/**
+ * Takes a snapshot of the given system variables, which is cleared when this
+ * object goes out of scope. Can be nested.
+ */
+class Scoped_sysvar_snapshot final {
+ public:
+  Scoped_sysvar_snapshot(const IInstance &inst,
+                         const std::vector<std::string> &names,
+                         const Var_qualifier scope = Var_qualifier::GLOBAL)
+      : m_instance(inst), m_clear(!inst.has_sysvar_snapshot()) {
+    m_instance.snapshot_sysvars(names, scope);
+  }
+
+  Scoped_sysvar_snapshot(const Scoped_sysvar_snapshot &) = delete;
+  Scoped_sysvar_snapshot(Scoped_sysvar_snapshot &&) = delete;
+  Scoped_sysvar_snapshot &operator=(const Scoped_sysvar_snapshot &) = delete;
+  Scoped_sysvar_snapshot &operator=(Scoped_sysvar_snapshot &&) = delete;
+
+  ~Scoped_sysvar_snapshot() {
+    // nested snapshots extend the outer one, it's cleared by the outermost
+    if (m_clear) m_instance.clear_sysvar_snapshot();
+  }
+
+ private:
+  const IInstance &m_instance;
+  bool m_clear;
+};
+
 class Set_variable final {
  public:
   Set_variable(const Set_variable &) = delete;
@@ -425,6 +473,16 @@ class Instance : public IInstance {
 
   void close_session() const override { _session->close(); }
 
+  void snapshot_sysvars(
+      const std::vector<std::string> &names,
+      const Var_qualifier scope = Var_qualifier::GLOBAL) const override;
+
+  void clear_sysvar_snapshot() const override;
+
+  bool has_sysvar_snapshot() const override {
+    return !m_global_sysvars.empty() || !m_session_sysvars.empty();
+  }
+
   std::optional<std::string> get_system_variable(
       std::string_view name,
       const Var_qualifier scope = Var_qualifier::GLOBAL) const override;
@@ -517,10 +575,19 @@ class Instance : public IInstance {
 
   void execute(const std::string &sql) const override;
 
- private:
+ protected:
   void process_result_warnings(const std::string &sql,
                                mysqlshdk::db::IResult &result) const;
 
+ private:
+  using Sysvar_snapshot =
+      std::map<std::string, std::optional<std::string>, std::less<>>;
+
+  Sysvar_snapshot *sysvar_snapshot(const Var_qualifier scope) const;
+
+  void forget_sysvar(const std::string &name,
+                     const Var_qualifier qualifier) const;
+
  private:
   std::shared_ptr<db::ISession> _session;
   mutable mysqlshdk::utils::Version _version;
@@ -534,6 +601,10 @@ class Instance : public IInstance {
   mutable std::optional<int> m_xport;
   mutable uint32_t m_server_id = 0;
   int m_sql_binlog_suppress_count = 0;
+  mutable Sysvar_snapshot m_global_sysvars;
+  mutable Sysvar_snapshot m_session_sysvars;
+  // number of reads served from the snapshot, instead of querying the server
+  mutable uint64_t m_sysvar_snapshot_hits = 0;
   Warnings_callback m_warnings_callback = nullptr;
 };
 
@@ -324,6 +324,21 @@ void check_server_variables_compatibility(
     }
   }
 
+  // read all the required variables (including their old names) at once
+  std::vector<std::string> names;
+
+  for (const auto &req : requirements) {
+    names.emplace_back(req.name);
+
+    if (auto old_name = get_replication_option_keyword(utils::Version(0, 0, 0),
+                                                       req.name);
+        old_name != req.name) {
+      names.emplace_back(std::move(old_name));
+    }
+  }
+
+  Scoped_sysvar_snapshot sysvars{instance, names};
+
   for (auto &req : requirements) {
     log_debug("Checking if '%s' is compatible with InnoDB Cluster.",
               req.name.c_str());
@@ -142,6 +142,13 @@ rest::Signed_request Oci_bucket::list_objects_request(
   return Signed_request(std::move(path));
 }
 
+rest::Signed_request Oci_bucket::list_objects_after_request(
+    const std::string &prefix, bool recursive,
+    const Object_details::Fields_mask &fields, const std::string &start_after) {
+  // start is inclusive, object with this name is going to be filtered out
+  return list_objects_request(prefix, 0, recursive, fields, start_after);
+}
+
 std::vector<Object_details> Oci_bucket::parse_list_objects(
     const rest::Base_response_buffer &buffer, std::string *next_start_from,
     std::unordered_set<std::string> *out_prefixes) {
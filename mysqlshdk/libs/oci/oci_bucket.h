@@ -84,6 +84,8 @@ class Oci_bucket : public storage::backend::object_storage::Container {
 
   void delete_();
 
+  bool has_list_objects_range() const override { return true; }
+
  private:
   rest::Signed_request create_request(const std::string &object_name,
                                       rest::Headers headers = {}) const;
@@ -93,6 +95,11 @@ class Oci_bucket : public storage::backend::object_storage::Container {
       const Object_details::Fields_mask &fields,
       const std::string &start_from) override;
 
+  rest::Signed_request list_objects_after_request(
+      const std::string &prefix, bool recursive,
+      const Object_details::Fields_mask &fields,
+      const std::string &start_after) override;
+
   std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
       std::unordered_set<std::string> *out_prefixes) override;
@@ -24,6 +24,11 @@
 #include "mysqlshdk/libs/ssh/ssh_common.h"
 
 #include <fcntl.h>
+#ifndef _MSC_VER
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
 #include <libssh/callbacks.h>
 #include <libssh/sftp.h>
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -160,6 +165,66 @@ void set_socket_non_blocking(int sock) {
 #endif
 }
 
+void create_socket_pair(int sockets[2]) {
+  errno = 0;
+#ifdef _WIN32
+  // there's no socketpair() on Windows, emulate it using a loopback connection
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  if (listener == -1) {
+    throw Ssh_tunnel_exception("unable to create socket: " + get_error());
+  }
+
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  memset(&addr, 0, len);
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  addr.sin_port = htons(0);
+
+  if (bind(listener, (struct sockaddr *)&addr, len) == -1 ||
+      getsockname(listener, (struct sockaddr *)&addr, &len) == -1 ||
+      listen(listener, 1) == -1) {
+    ssh_close_socket(listener);
+    throw Ssh_tunnel_exception("unable to create socket pair: " + get_error());
+  }
+
+  sockets[1] = socket(AF_INET, SOCK_STREAM, 0);
+
+  if (sockets[1] == -1 ||
+      connect(sockets[1], (struct sockaddr *)&addr, len) == -1) {
+    if (sockets[1] != -1) ssh_close_socket(sockets[1]);
+    ssh_close_socket(listener);
+    throw Ssh_tunnel_exception("unable to create socket pair: " + get_error());
+  }
+
+  sockets[0] = accept(listener, nullptr, nullptr);
+  ssh_close_socket(listener);
+
+  if (sockets[0] == -1) {
+    ssh_close_socket(sockets[1]);
+    throw Ssh_tunnel_exception("unable to create socket pair: " + get_error());
+  }
+#else
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == -1) {
+    throw Ssh_tunnel_exception("unable to create socket pair: " + get_error());
+  }
+#endif
+
+  try {
+    set_socket_non_blocking(sockets[0]);
+  } catch (...) {
+    ssh_close_socket(sockets[1]);
+    throw;
+  }
+
+  try {
+    set_socket_non_blocking(sockets[1]);
+  } catch (...) {
+    ssh_close_socket(sockets[0]);
+    throw;
+  }
+}
+
 static void setup_libssh() {
   ssh_threads_set_callbacks(ssh_threads_get_std_threads());
   update_libssh_log_level(shcore::current_logger()->get_log_level());
@@ -57,6 +57,14 @@ void ssh_close_socket(int socket);
 
 std::string get_error();
 void set_socket_non_blocking(int sock);
+
+/**
+ * Creates a pair of connected, non-blocking sockets. Writing to one of them
+ * wakes up a thread which polls the other one.
+ *
+ * @param sockets receives the created sockets
+ */
+void create_socket_pair(int sockets[2]);
 void init_libssh();
 
 enum class Ssh_return_type {
@@ -132,7 +140,7 @@ class Ssh_thread {
   Ssh_thread &operator=(const Ssh_thread &other) = delete;
   Ssh_thread &operator=(Ssh_thread &&other) = delete;
 
-  void stop();
+  virtual void stop();
   bool is_running() const;
   void start();
   void join();
@@ -70,14 +70,17 @@ std::string Ssh_connection_options::key_file_uri() const {
 
 void Ssh_connection_options::set_default_data() {
   // Default values
-  if (!has_config_file()) {
-    auto options = mysqlsh::current_shell_options(true);
-    if (options) {
+  if (auto options = mysqlsh::current_shell_options(true)) {
+    if (!has_config_file()) {
       const auto &config_file = options->get().ssh.config_file;
       if (!config_file.empty()) {
         set_config_file(config_file);
       }
     }
+
+    if (const auto buffer_size = options->get().ssh.buffer_size) {
+      set_buffer_size(buffer_size);
+    }
   }
 
   preload_ssh_config();
@@ -207,7 +207,7 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
   std::string m_key_password;
 
   // Not really an SSH option, used to pass the configured shell option
-  std::size_t m_buffer_size = 10240;
+  std::size_t m_buffer_size = 65536;
 };
 }  // namespace ssh
 }  // namespace mysqlshdk
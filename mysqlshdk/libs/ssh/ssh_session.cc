@@ -130,18 +130,21 @@ static const char k_public_key_allowed[] = {
 int libssh_auth_callback(const char *prompt, char *buf, size_t len, int echo,
                          int UNUSED(verify), void *userdata) {
   std::string return_value;
+  auto session = static_cast<Ssh_session *>(userdata);
+
   if (echo == 1) {
-    if (mysqlsh::current_console()->prompt(prompt, &return_value) !=
-        shcore::Prompt_result::Ok)
+    if (!session->can_prompt() ||
+        mysqlsh::current_console()->prompt(prompt, &return_value) !=
+            shcore::Prompt_result::Ok)
       return -1;
   } else {
-    auto session = static_cast<Ssh_session *>(userdata);
     auto &options = session->get_options();
 
     if (strcmp(prompt, "Passphrase for private key:") == 0 &&
         options.has_keyfile_password()) {
       return_value = options.get_key_file_password();
-    } else if (mysqlsh::current_console()->prompt_password(
+    } else if (!session->can_prompt() ||
+               mysqlsh::current_console()->prompt_password(
                    prompt, &return_value) != shcore::Prompt_result::Ok) {
       return -1;
     }
@@ -172,7 +175,7 @@ Ssh_session::Ssh_session()
 Ssh_session::~Ssh_session() {}
 
 std::tuple<Ssh_return_type, std::string> Ssh_session::connect(
-    const Ssh_connection_options &config) {
+    const Ssh_connection_options &config, bool interactive) {
   if (is_connected()) {
     throw std::logic_error(
         "Unable to connect already connected SSHSession, please disconnect "
@@ -181,7 +184,8 @@ std::tuple<Ssh_return_type, std::string> Ssh_session::connect(
 
   // auto lock = lock_session();
   m_options = config;
-  m_interactive = m_options.interactive();
+  m_can_prompt = interactive;
+  m_interactive = interactive && m_options.interactive();
   // We need to set the host before reading the config, otherwise we will get
   // error. This will be of course overridden by optionsParseconfig
   try {
@@ -397,7 +401,7 @@ bool Ssh_session::open_channel(::ssh::Channel *chann) {
 void Ssh_session::clean_connect() {
   if (!ssh_is_connected(m_session->getCSession())) {
     disconnect();
-    connect(m_options);
+    connect(m_options, m_can_prompt);
   }
 }
 
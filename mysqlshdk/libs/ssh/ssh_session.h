@@ -70,11 +70,13 @@ class Ssh_session final {
    * handle fingerprint matching.
    *
    * @param config Ssh_connection_config
+   * @param interactive if false, user is never prompted, even if wizards are
+   * enabled
    * @return tuple which holds return code and message assigned for the given
    * code.
    */
   std::tuple<Ssh_return_type, std::string> connect(
-      const Ssh_connection_options &config);
+      const Ssh_connection_options &config, bool interactive = true);
 
   void disconnect();
   bool is_connected() const;
@@ -93,6 +95,8 @@ class Ssh_session final {
 
   const Ssh_connection_options &get_options() { return m_options; }
 
+  bool can_prompt() const { return m_can_prompt; }
+
   Ssh_session_info get_session_info() const {
     return {m_options, m_time_created};
   }
@@ -119,6 +123,7 @@ class Ssh_session final {
   bool m_is_connected;
   ssh_callbacks_struct m_ssh_callbacks;
   bool m_interactive;
+  bool m_can_prompt = true;
 
   Ssh_config_data m_config;
   std::chrono::system_clock::time_point m_time_created;
@@ -40,6 +40,17 @@ namespace mysqlshdk {
 namespace ssh {
 
 namespace {
+
+// maximum number of SSH sessions used by a single tunnel
+constexpr std::size_t k_max_tunnel_sessions = 4;
+
+// additional session is opened when all sessions handle this many connections
+constexpr std::size_t k_connections_per_session = 4;
+
+// all events which need to be handled wake up the thread, this is just a safety
+// net
+constexpr int k_poll_timeout_ms = 1000;
+
 int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents),
                     void *UNUSED(userdata)) {
   // the return should be:
@@ -50,6 +61,15 @@ int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents),
   return 0;
 }
 
+int on_wakeup_event(socket_t fd, int UNUSED(revents), void *UNUSED(userdata)) {
+  char buff[64];
+
+  while (recv(fd, buff, sizeof(buff), 0) > 0) {
+  }
+
+  return 0;
+}
+
 void cleanup_socket(ssh_event e, int sock,
                     std::unique_ptr<::ssh::Channel> chan) {
   ssh_event_remove_fd(e, sock);
@@ -64,25 +84,37 @@ Ssh_tunnel_handler::Ssh_tunnel_handler(uint16_t local_port, int local_socket,
     : m_session(std::move(session)),
       m_local_port(local_port),
       m_local_socket(local_socket) {
+  m_buffer_size = m_session->config().get_buffer_size();
+  m_buffer = std::unique_ptr<char[]>(new char[m_buffer_size]);
+  create_socket_pair(m_wakeup_sockets);
   make_event();
 }
 
 Ssh_tunnel_handler::~Ssh_tunnel_handler() {
   stop();
+  m_shards.clear();
+  close_queued_connections();
   if (m_session) {
     cleanup_event();
     m_session->disconnect();
     m_session.reset();
   }
+
+  for (const auto sock : m_wakeup_sockets) {
+    if (sock != -1) ssh_close_socket(sock);
+  }
 }
 
 void Ssh_tunnel_handler::make_event() {
   m_event = ssh_event_new();
   ssh_event_add_session(m_event, m_session->get_csession());
+  ssh_event_add_fd(m_event, m_wakeup_sockets[0], POLLIN, on_wakeup_event,
+                   this);
 }
 
 void Ssh_tunnel_handler::cleanup_event() {
   if (m_event) {
+    ssh_event_remove_fd(m_event, m_wakeup_sockets[0]);
     ssh_event_remove_session(m_event, m_session->get_csession());
     ssh_event_free(m_event);
     m_event = nullptr;
@@ -99,6 +131,37 @@ const Ssh_connection_options &Ssh_tunnel_handler::config() const {
 
 void Ssh_tunnel_handler::run() { handle_connection(); }
 
+void Ssh_tunnel_handler::stop() {
+  m_stop = true;
+  wakeup();
+
+  std::thread shard_creator;
+
+  {
+    std::lock_guard<std::mutex> lock(m_shards_mutex);
+    std::swap(shard_creator, m_shard_creator);
+  }
+
+  // new shards are not created once the handler is stopped
+  if (shard_creator.joinable()) shard_creator.join();
+
+  {
+    std::lock_guard<std::mutex> lock(m_shards_mutex);
+
+    for (const auto &shard : m_shards) {
+      shard->stop();
+    }
+  }
+
+  Ssh_thread::stop();
+}
+
+void Ssh_tunnel_handler::wakeup() {
+  const char byte = 0;
+  // if the socket buffer is full, the thread is going to wake up anyway
+  send(m_wakeup_sockets[1], &byte, 1, MSG_NOSIGNAL);
+}
+
 // This is noop function so ssh_even_dopoll will exit once client socket will
 // have new data
 
@@ -107,13 +170,20 @@ void Ssh_tunnel_handler::handle_connection() {
   int rc = 0;
 
   do {
-    std::unique_lock<std::recursive_mutex> lock(m_new_connection_mtx);
-    if (!m_new_connection.empty()) {
-      prepare_tunnel(m_new_connection.front());
-      m_new_connection.pop();
+    std::queue<int> new_connections;
+
+    {
+      std::lock_guard<std::recursive_mutex> lock(m_new_connection_mtx);
+      std::swap(new_connections, m_new_connection);
+    }
+
+    for (; !new_connections.empty(); new_connections.pop()) {
+      prepare_tunnel(new_connections.front());
     }
-    lock.unlock();
-    rc = ssh_event_dopoll(m_event, 100);
+
+    // new connections and stop requests use the wakeup socket, data is
+    // signalled by the SSH session and client sockets
+    rc = ssh_event_dopoll(m_event, k_poll_timeout_ms);
 
     if (rc == SSH_ERROR) {
       auto ssh_error = m_session->get_ssh_error();
@@ -128,7 +198,7 @@ void Ssh_tunnel_handler::handle_connection() {
             "retrying");
 
       for (auto &s_it : m_client_socket_list) {
-        cleanup_socket(m_event, s_it.first, std::move(s_it.second));
+        close_tunnel(s_it.first, std::move(s_it.second));
       }
       m_client_socket_list.clear();
 
@@ -151,7 +221,7 @@ void Ssh_tunnel_handler::handle_connection() {
         transfer_data_to_client(it->first, it->second.get());
         ++it;
       } catch (const Ssh_tunnel_exception &exc) {
-        cleanup_socket(m_event, it->first, std::move(it->second));
+        close_tunnel(it->first, std::move(it->second));
         it = m_client_socket_list.erase(it);
         log_error("SSH: tunnel handler: Error during data transfer: %s",
                   exc.what());
@@ -160,12 +230,28 @@ void Ssh_tunnel_handler::handle_connection() {
   } while (!m_stop);
 
   for (auto &s_it : m_client_socket_list) {
-    cleanup_socket(m_event, s_it.first, std::move(s_it.second));
+    close_tunnel(s_it.first, std::move(s_it.second));
   }
   m_client_socket_list.clear();
+  close_queued_connections();
   log_debug3("SSH: tunnel handler: Tunnel handler thread stopped.");
 }
 
+void Ssh_tunnel_handler::close_tunnel(int client_socket,
+                                      std::unique_ptr<::ssh::Channel> chan) {
+  cleanup_socket(m_event, client_socket, std::move(chan));
+  --m_connections;
+}
+
+void Ssh_tunnel_handler::close_queued_connections() {
+  std::lock_guard<std::recursive_mutex> lock(m_new_connection_mtx);
+
+  for (; !m_new_connection.empty(); m_new_connection.pop()) {
+    ssh_close_socket(m_new_connection.front());
+    --m_connections;
+  }
+}
+
 bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
   log_debug3("SSH: tunnel handler: About to handle new connection.");
   struct sockaddr_in client;
@@ -191,20 +277,97 @@ bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
     log_error("SSH: tunnel handler: Failed to set SO_NOSIGPIPE on socket");
 #endif
 
-  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
-  m_new_connection.push(client_sock);
+  select_shard()->queue_connection(client_sock);
   log_debug3("SSH: tunnel handler: Accepted new connection.");
   return true;
 }
 
+void Ssh_tunnel_handler::queue_connection(int client_socket) {
+  ++m_connections;
+
+  {
+    std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
+    m_new_connection.push(client_socket);
+  }
+
+  wakeup();
+}
+
+Ssh_tunnel_handler *Ssh_tunnel_handler::select_shard() {
+  std::lock_guard<std::mutex> lock(m_shards_mutex);
+  auto selected = this;
+
+  for (const auto &shard : m_shards) {
+    if (shard->is_running() && shard->m_connections < selected->m_connections) {
+      selected = shard.get();
+    }
+  }
+
+  if (selected->m_connections >= k_connections_per_session &&
+      !m_sharding_disabled && !m_creating_shard && !m_stop &&
+      m_shards.size() + 1 < k_max_tunnel_sessions) {
+    // connecting takes a while, this connection is handled by one of the
+    // existing sessions, the next ones are going to use the new session
+    if (m_shard_creator.joinable()) m_shard_creator.join();
+
+    m_creating_shard = true;
+    m_shard_creator = std::thread(&Ssh_tunnel_handler::create_shard, this,
+                                  config());
+  }
+
+  return selected;
+}
+
+void Ssh_tunnel_handler::create_shard(const Ssh_connection_options &config) {
+  log_debug2("SSH: tunnel handler: Opening additional session for port: %d",
+             static_cast<int>(m_local_port));
+
+  std::unique_ptr<Ssh_tunnel_handler> shard;
+
+  try {
+    auto session = std::make_unique<Ssh_session>();
+    // user cannot be prompted here, session is opened only if credentials used
+    // by the main session are sufficient
+    const auto result = session->connect(config, false);
+
+    if (Ssh_return_type::CONNECTED != std::get<0>(result)) {
+      throw Ssh_tunnel_exception(std::get<1>(result));
+    }
+
+    shard = std::make_unique<Ssh_tunnel_handler>(m_local_port, m_local_socket,
+                                                 std::move(session));
+    shard->start();
+  } catch (const std::exception &exc) {
+    log_warning(
+        "SSH: tunnel handler: Unable to open additional session, connections "
+        "will share the existing ones: %s",
+        exc.what());
+
+    std::lock_guard<std::mutex> lock(m_shards_mutex);
+    m_sharding_disabled = true;
+    m_creating_shard = false;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_shards_mutex);
+
+  // if handler was stopped in the meantime, shard is not needed, it's going
+  // to be stopped once the lock is released
+  if (!m_stop) {
+    m_shards.emplace_back(std::move(shard));
+  }
+
+  m_creating_shard = false;
+}
+
 void Ssh_tunnel_handler::transfer_data_from_client(int sock,
                                                    ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
 
-  while (!m_stop && (readlen = recv(sock, buff.data(), buff.size(), 0)) > 0) {
+  while (!m_stop &&
+         (readlen = recv(sock, m_buffer.get(), m_buffer_size, 0)) > 0) {
     int b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.get(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       try {
         b_written = chan->write(buff_ptr, readlen);
@@ -240,10 +403,9 @@ std::string err_code_to_string(int err) {
 void Ssh_tunnel_handler::transfer_data_to_client(int sock,
                                                  ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
   do {
     try {
-      readlen = chan->readNonblocking(buff.data(), buff.size());
+      readlen = chan->readNonblocking(m_buffer.get(), m_buffer_size);
     } catch (::ssh::SshException &exc) {
       throw Ssh_tunnel_exception(exc.getError());
     }
@@ -261,7 +423,7 @@ void Ssh_tunnel_handler::transfer_data_to_client(int sock,
     }
 
     ssize_t b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.get(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       do {
         b_written = send(sock, buff_ptr, readlen, MSG_NOSIGNAL);
@@ -325,6 +487,7 @@ void Ssh_tunnel_handler::prepare_tunnel(int client_socket) {
           "event handler.");
       channel.reset();
       ssh_close_socket(client_socket);
+      --m_connections;
     } else {
       log_debug("SSH: tunnel handler: Tunnel created.");
       m_client_socket_list.insert(
@@ -332,12 +495,14 @@ void Ssh_tunnel_handler::prepare_tunnel(int client_socket) {
     }
   } catch (const ssh::Ssh_tunnel_exception &exc) {
     ssh_close_socket(client_socket);
+    --m_connections;
     log_error(
         "SSH: tunnel handler: Unable to open tunnel. Exception when opening "
         "tunnel: %s",
         exc.what());
   } catch (::ssh::SshException &exc) {
     ssh_close_socket(client_socket);
+    --m_connections;
     log_error(
         "SSH: tunnel handler: Unable to open tunnel. Exception when opening "
         "tunnel: %s",
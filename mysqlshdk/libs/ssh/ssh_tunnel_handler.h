@@ -35,6 +35,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 #include "mysqlshdk/libs/ssh/ssh_common.h"
 #include "mysqlshdk/libs/ssh/ssh_session.h"
 
@@ -45,6 +46,10 @@ namespace ssh {
  * @brief Handle SSH data transfer between local port and remote port using
  * ssh::Channel.
  *
+ * Connections accepted on the local socket are distributed between this
+ * handler and its shards, each shard uses a separate SSH session and a
+ * separate thread, so that multiple connections are not limited by a single
+ * encrypted stream.
  */
 class Ssh_tunnel_handler : public Ssh_thread {
  public:
@@ -63,6 +68,11 @@ class Ssh_tunnel_handler : public Ssh_thread {
    */
   bool handle_new_connection(int incoming_socket);
 
+  /**
+   * @brief stops this handler and all of its shards.
+   */
+  void stop() override;
+
   void use() { ++m_usage; }
   int release() {
     assert(m_usage > 0);
@@ -87,12 +97,35 @@ class Ssh_tunnel_handler : public Ssh_thread {
   void transfer_data_to_client(int sock, ::ssh::Channel *chan);
   std::unique_ptr<::ssh::Channel> open_tunnel();
   void prepare_tunnel(int client_socket);
+  void close_tunnel(int client_socket, std::unique_ptr<::ssh::Channel> chan);
+  void close_queued_connections();
   void make_event();
   void cleanup_event();
 
+  void queue_connection(int client_socket);
+  void wakeup();
+
+  Ssh_tunnel_handler *select_shard();
+  void create_shard(const Ssh_connection_options &config);
+
   std::recursive_mutex m_new_connection_mtx;
   std::queue<int> m_new_connection;
   std::atomic_int m_usage = 0;
+  // number of connections queued or handled by this handler
+  std::atomic<std::size_t> m_connections = 0;
+  // handlers which use additional SSH sessions
+  std::vector<std::unique_ptr<Ssh_tunnel_handler>> m_shards;
+  bool m_sharding_disabled = false;
+  // opens additional SSH sessions, so that connections are not accepted while
+  // waiting for the SSH handshake
+  std::thread m_shard_creator;
+  bool m_creating_shard = false;
+  // protects shards, accessed by the listener thread and by stop()
+  std::mutex m_shards_mutex;
+  // writing to the second socket wakes up the ssh_event_dopoll() call
+  int m_wakeup_sockets[2] = {-1, -1};
+  std::unique_ptr<char[]> m_buffer;
+  std::size_t m_buffer_size = 0;
 };
 
 }  // namespace ssh
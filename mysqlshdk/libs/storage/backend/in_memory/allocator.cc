@@ -32,6 +32,7 @@
 
 #include "mysqlshdk/include/scripting/shexcept.h"
 #include "mysqlshdk/libs/utils/debug.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 
 namespace mysqlshdk {
 namespace storage {
@@ -99,10 +100,35 @@ std::vector<char *> Allocator::allocate(std::size_t memory) {
   {
     std::unique_lock lock{m_mutex};
 
+    if (m_block_limit && m_used_blocks + blocks > m_block_limit) {
+      if (!m_wait_for_memory) {
+        throw std::runtime_error(shcore::str_format(
+            "Unable to allocate %zu bytes, the memory limit of %zu bytes would "
+            "be exceeded, memory in use: %zu bytes",
+            blocks * m_block_size, m_block_limit * m_block_size,
+            m_used_blocks * m_block_size));
+      }
+
+      // memory in use is going to be freed by other threads
+      ++m_waiting_allocations;
+      m_memory_freed.wait(lock, [this, blocks]() {
+        return m_interrupted || 0 == m_used_blocks ||
+               m_used_blocks + blocks <= m_block_limit;
+      });
+      --m_waiting_allocations;
+
+      if (m_interrupted) {
+        throw std::runtime_error("Memory allocation was interrupted");
+      }
+    }
+
     while (blocks > m_available_blocks) {
       add_page();
     }
 
+    m_used_blocks += blocks;
+    m_peak_used_blocks = std::max(m_peak_used_blocks, m_used_blocks);
+
     while (blocks > 0) {
       auto page = m_pages.begin()->get();
 
@@ -129,8 +155,52 @@ std::vector<char *> Allocator::allocate(std::size_t memory) {
 }
 
 void Allocator::free(char *block) {
+  {
+    std::lock_guard lock{m_mutex};
+    free_block(block);
+  }
+
+  m_memory_freed.notify_all();
+}
+
+void Allocator::set_memory_limit(std::size_t limit, bool wait) {
+  {
+    std::lock_guard lock{m_mutex};
+    m_block_limit = block_count(limit);
+    m_wait_for_memory = wait;
+  }
+
+  // limit could have been increased
+  m_memory_freed.notify_all();
+}
+
+std::size_t Allocator::memory_limit() const {
+  std::lock_guard lock{m_mutex};
+  return m_block_limit * m_block_size;
+}
+
+void Allocator::interrupt() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_interrupted = true;
+  }
+
+  m_memory_freed.notify_all();
+}
+
+std::size_t Allocator::memory_in_use() const {
+  std::lock_guard lock{m_mutex};
+  return m_used_blocks * m_block_size;
+}
+
+std::size_t Allocator::peak_memory_in_use() const {
+  std::lock_guard lock{m_mutex};
+  return m_peak_used_blocks * m_block_size;
+}
+
+std::size_t Allocator::waiting_allocations() const {
   std::lock_guard lock{m_mutex};
-  free_block(block);
+  return m_waiting_allocations;
 }
 
 void Allocator::add_page() {
@@ -169,6 +239,7 @@ void Allocator::free_block(char *block) {
 
   page->m_available_blocks.emplace_back(block);
   ++m_available_blocks;
+  --m_used_blocks;
 
   if (m_blocks_per_page == page->m_available_blocks.size()) {
     // page is completely empty
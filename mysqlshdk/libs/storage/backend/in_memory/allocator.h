@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATOR_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATOR_H_
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -100,12 +101,59 @@ class Allocator final {
    * Allocates the requested memory. Memory is returned in blocks of a constant
    * size, which means that more memory can be allocated than requested.
    *
+   * If a memory limit is set and this allocation would exceed it, this method
+   * either waits until enough memory is freed by other threads, or throws,
+   * depending on the policy. When waiting, a request is always fulfilled if no
+   * memory is in use, even if it is bigger than the limit.
+   *
    * @param memory Size of the memory to be allocated.
    *
+   * @throws std::runtime_error If memory limit would be exceeded and
+   *                            allocator is not allowed to wait.
+   * @throws std::runtime_error If allocator was interrupted while waiting.
+   *
    * @returns allocated memory blocks
    */
   std::vector<char *> allocate(std::size_t memory);
 
+  /**
+   * Limits the total size of the memory blocks which are in use.
+   *
+   * @param limit Memory limit, 0 means unlimited. Rounded up to the block
+   *        size.
+   * @param wait If true, allocations which would exceed the limit wait until
+   *        enough memory is freed, otherwise they throw.
+   */
+  void set_memory_limit(std::size_t limit, bool wait);
+
+  /**
+   * Provides the current memory limit, 0 means unlimited.
+   */
+  std::size_t memory_limit() const;
+
+  /**
+   * Aborts all allocations which are waiting for the memory to be freed, and
+   * the ones which are going to wait.
+   */
+  void interrupt();
+
+  /**
+   * Provides the total size of the memory blocks which are currently in use.
+   */
+  std::size_t memory_in_use() const;
+
+  /**
+   * Provides the highest total size of the memory blocks which were in use at
+   * the same time.
+   */
+  std::size_t peak_memory_in_use() const;
+
+  /**
+   * Provides the number of allocations which are waiting for the memory to be
+   * freed.
+   */
+  std::size_t waiting_allocations() const;
+
   /**
    * Frees a single memory block.
    *
@@ -130,11 +178,15 @@ class Allocator final {
    */
   template <typename Iter>
   void free(Iter begin, Iter end) {
-    std::lock_guard lock{m_mutex};
+    {
+      std::lock_guard lock{m_mutex};
 
-    while (begin != end) {
-      free_block(*begin++);
+      while (begin != end) {
+        free_block(*begin++);
+      }
     }
+
+    m_memory_freed.notify_all();
   }
 
  private:
@@ -237,8 +289,23 @@ class Allocator final {
   // number of available blocks
   std::size_t m_available_blocks = 0;
 
+  // number of blocks in use
+  std::size_t m_used_blocks = 0;
+  // highest number of blocks in use
+  std::size_t m_peak_used_blocks = 0;
+
+  // maximum number of blocks in use, 0 - unlimited
+  std::size_t m_block_limit = 0;
+  // whether to wait for memory if the limit is reached
+  bool m_wait_for_memory = true;
+  bool m_interrupted = false;
+  // number of allocations waiting for memory
+  std::size_t m_waiting_allocations = 0;
+
   // controls access to memory
-  std::mutex m_mutex;
+  mutable std::mutex m_mutex;
+  // signalled when memory is freed
+  std::condition_variable m_memory_freed;
 };
 
 struct Data_block {
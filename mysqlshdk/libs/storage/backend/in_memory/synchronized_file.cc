@@ -70,12 +70,15 @@ void Synchronized_file::close() {
   // first close request has to come from the writer, as reader is still
   // waiting for the input
   if (m_writing) {
-    if (auto r = m_read_requests.try_pop(1ms);
-        r.value_or(false) && m_request.written > 0) {
-      // if there's a read operation pending, signal that it's finished
-      m_read_responses.push({m_request.written});
+    if (m_owns_request || m_read_requests.try_pop(1ms).value_or(false)) {
+      if (m_request.written > 0) {
+        // if there's a read operation pending, signal that it's finished
+        m_read_responses.push({m_request.written});
+      }
     }
 
+    m_owns_request = false;
+
     // signal EOF to the reader
     m_read_responses.push({0});
 
@@ -140,38 +143,47 @@ ssize_t Synchronized_file::write(const void *buffer, std::size_t length) {
       return 0;
     }
 
-    if (auto r = m_read_requests.try_pop(k_sleep_interval); r.value_or(false)) {
-      if (length > m_request.length) {
-        // write buffer is longer than the read buffer, signal that it is full
-        auto response = m_request.written;
-
-        if (0 == m_request.written) {
-          // the read buffer is too small, signal this to the reader, it is
-          // either going to provide a bigger one, or abort the operation
-          response = -1;
-        }
-
-        m_read_responses.push({response});
-      } else {
-        ::memcpy(m_request.buffer, buffer, length);
-
-        m_size += length;
-        m_request.buffer = static_cast<char *>(m_request.buffer) + length;
-        m_request.written += length;
-        m_request.length -= length;
-
-        m_pending_write = 0;
-
-        if (0 == m_request.length) {
-          // read buffer is full
-          m_read_responses.push({m_request.written});
-        } else {
-          // push the read buffer back to the queue
-          m_read_requests.push(true);
-        }
-
-        return length;
+    if (!m_owns_request) {
+      if (auto r = m_read_requests.try_pop(k_sleep_interval);
+          !r.value_or(false)) {
+        continue;
+      }
+
+      m_owns_request = true;
+    }
+
+    if (length > m_request.length) {
+      // write buffer is longer than the read buffer, signal that it is full
+      auto response = m_request.written;
+
+      if (0 == m_request.written) {
+        // the read buffer is too small, signal this to the reader, it is
+        // either going to provide a bigger one, or abort the operation
+        response = -1;
       }
+
+      m_owns_request = false;
+      m_read_responses.push({response});
+    } else {
+      ::memcpy(m_request.buffer, buffer, length);
+
+      m_size += length;
+      m_request.buffer = static_cast<char *>(m_request.buffer) + length;
+      m_request.written += length;
+      m_request.length -= length;
+
+      m_pending_write = 0;
+
+      if (0 == m_request.length) {
+        // read buffer is full
+        m_owns_request = false;
+        m_read_responses.push({m_request.written});
+      }
+
+      // otherwise the writer holds on to the read buffer, subsequent writes
+      // are going to fill it without synchronizing with the reader
+
+      return length;
     }
   }
 }
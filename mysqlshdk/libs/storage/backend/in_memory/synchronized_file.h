@@ -39,8 +39,10 @@ namespace in_memory {
 
 /**
  * I/O operations are synchronized, write waits for a read operation in order
- * to write directly to the buffer. Only a single reader and a single writer are
- * allowed at a time. The reader and the writer must be in separate threads.
+ * to write directly to the buffer. Once a read buffer is received, subsequent
+ * writes fill it until it's full, or the next write does not fit, and only then
+ * the reader is notified. Only a single reader and a single writer are allowed
+ * at a time. The reader and the writer must be in separate threads.
  */
 class Synchronized_file : public Virtual_fs::IFile {
  public:
@@ -161,6 +163,10 @@ class Synchronized_file : public Virtual_fs::IFile {
 
   // access to this variable is protected by the two queues
   Read_request m_request;
+
+  // set when the writer has received a read request which has not been
+  // answered yet, accessed only by the writer
+  bool m_owns_request = false;
 };
 
 }  // namespace in_memory
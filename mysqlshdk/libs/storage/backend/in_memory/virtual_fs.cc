@@ -211,7 +211,10 @@ std::vector<std::string> Virtual_fs::split_path(const std::string &path) {
   return shcore::str_split(path, std::string{1, k_path_separator});
 }
 
-void Virtual_fs::interrupt() { m_interrupted = true; }
+void Virtual_fs::interrupt() {
+  m_interrupted = true;
+  m_allocator.interrupt();
+}
 
 void Virtual_fs::set_uses_synchronized_io(
     std::function<bool(std::string_view)> callback) {
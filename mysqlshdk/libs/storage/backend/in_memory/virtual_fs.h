@@ -308,6 +308,37 @@ class Virtual_fs final {
    */
   void set_uses_synchronized_io(std::function<bool(std::string_view)> callback);
 
+  /**
+   * Limits the memory used by the files which do not use synchronized I/O.
+   * Memory used by such files is freed while they are read.
+   *
+   * @param limit Memory limit, 0 means unlimited.
+   * @param wait If true, writes which would exceed the limit wait until enough
+   *        memory is freed, otherwise they throw.
+   */
+  void set_memory_limit(std::size_t limit, bool wait) {
+    m_allocator.set_memory_limit(limit, wait);
+  }
+
+  /**
+   * Provides the highest amount of memory used by the files at the same time.
+   */
+  std::size_t peak_memory_usage() const {
+    return m_allocator.peak_memory_in_use();
+  }
+
+  /**
+   * Provides the amount of memory currently used by the files.
+   */
+  std::size_t memory_usage() const { return m_allocator.memory_in_use(); }
+
+  /**
+   * Whether any of the writes is waiting for the memory to be freed.
+   */
+  bool is_waiting_for_memory() const {
+    return m_allocator.waiting_allocations() > 0;
+  }
+
  private:
   Allocator m_allocator;
   std::unordered_map<std::string, std::unique_ptr<Directory>> m_dirs;
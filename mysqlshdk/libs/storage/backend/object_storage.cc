@@ -23,9 +23,14 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
+#include <algorithm>
+#include <exception>
 #include <iterator>
+#include <thread>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/rest/error_codes.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlshdk {
@@ -33,6 +38,15 @@ namespace storage {
 namespace backend {
 namespace object_storage {
 
+namespace {
+
+// minimum number of objects in a range listed by a single thread
+constexpr std::size_t k_objects_per_listing_range = 10000;
+
+constexpr std::size_t k_max_listing_ranges = 8;
+
+}  // namespace
+
 Directory::Directory(const Config_ptr &config, const std::string &name)
     : m_name(name),
       m_prefix(m_name.empty() ? "" : m_name + "/"),
@@ -61,13 +75,7 @@ void Directory::create() { m_created = true; }
 std::unordered_set<IDirectory::File_info> Directory::list_files(
     bool hidden_files) const {
   std::unordered_set<IDirectory::File_info> files;
-  std::vector<Object_details> objects;
-
-  try {
-    objects = m_container->list_objects(m_prefix, 0, false);
-  } catch (const rest::Response_error &error) {
-    throw rest::to_exception(error);
-  }
+  auto objects = list_objects();
 
   if (m_prefix.empty()) {
     for (auto &object : objects) {
@@ -121,13 +129,7 @@ std::unordered_set<IDirectory::File_info> Directory::list_multipart_uploads()
 std::unordered_set<IDirectory::File_info> Directory::filter_files(
     const std::string &pattern) const {
   std::unordered_set<IDirectory::File_info> files;
-  std::vector<Object_details> objects;
-
-  try {
-    objects = m_container->list_objects(m_prefix, 0, false);
-  } catch (const rest::Response_error &error) {
-    throw rest::to_exception(error);
-  }
+  auto objects = list_objects();
 
   if (m_prefix.empty()) {
     for (auto &object : objects) {
@@ -147,6 +149,87 @@ std::unordered_set<IDirectory::File_info> Directory::filter_files(
   return files;
 }
 
+std::vector<Object_details> Directory::list_objects() const {
+  std::vector<Object_details> objects;
+
+  try {
+    if (m_listing_boundaries.empty() ||
+        !m_container->has_list_objects_range()) {
+      objects = m_container->list_objects(m_prefix, 0, false);
+    } else {
+      objects = list_objects_in_ranges();
+    }
+  } catch (const rest::Response_error &error) {
+    throw rest::to_exception(error);
+  }
+
+  update_listing_boundaries(objects);
+
+  return objects;
+}
+
+std::vector<Object_details> Directory::list_objects_in_ranges() const {
+  const auto ranges = m_listing_boundaries.size() + 1;
+  std::vector<std::vector<Object_details>> results(ranges);
+  std::vector<std::exception_ptr> exceptions(ranges);
+  std::vector<std::thread> threads;
+
+  log_debug("Listing '%s' using %zu threads", m_prefix.c_str(), ranges);
+
+  threads.reserve(ranges);
+
+  for (std::size_t i = 0; i < ranges; ++i) {
+    threads.emplace_back(
+        mysqlsh::spawn_scoped_thread([this, i, &results, &exceptions]() {
+          try {
+            // each thread needs its own connection
+            const auto container = m_container->config()->container();
+
+            results[i] = container->list_objects_range(
+                m_prefix, 0 == i ? "" : m_listing_boundaries[i - 1],
+                i < m_listing_boundaries.size() ? m_listing_boundaries[i] : "",
+                false);
+          } catch (...) {
+            exceptions[i] = std::current_exception();
+          }
+        }));
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  std::vector<Object_details> objects = std::move(results[0]);
+
+  for (std::size_t i = 1; i < ranges; ++i) {
+    std::move(results[i].begin(), results[i].end(),
+              std::back_inserter(objects));
+  }
+
+  return objects;
+}
+
+void Directory::update_listing_boundaries(
+    const std::vector<Object_details> &objects) const {
+  // objects are listed in the lexicographical order of their names, split them
+  // into ranges of similar size
+  const auto size = objects.size();
+  const auto ranges =
+      std::min(size / k_objects_per_listing_range, k_max_listing_ranges);
+
+  m_listing_boundaries.clear();
+
+  for (std::size_t i = 1; i < ranges; ++i) {
+    m_listing_boundaries.emplace_back(objects[i * size / ranges - 1].name);
+  }
+}
+
 std::string Directory::join_path(const std::string &a,
                                  const std::string &b) const {
   return a.empty() ? b : a + "/" + b;
@@ -27,6 +27,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -93,6 +94,10 @@ class Directory : public mysqlshdk::storage::IDirectory {
    * NOTE: This function emulates non recursive listing by returning ONLY those
    * object names that reside on the emulated directory but dont have / as part
    * of their name.
+   *
+   * NOTE: If the previous listing returned many objects and the container
+   * supports listing of ranges, the key space is split using the names of the
+   * previously listed objects and the ranges are listed in parallel.
    */
   std::unordered_set<File_info> list_files(
       bool hidden_files = false) const override;
@@ -123,6 +128,16 @@ class Directory : public mysqlshdk::storage::IDirectory {
 
  private:
   std::unordered_set<IDirectory::File_info> list_multipart_uploads() const;
+
+  std::vector<Object_details> list_objects() const;
+
+  std::vector<Object_details> list_objects_in_ranges() const;
+
+  void update_listing_boundaries(const std::vector<Object_details> &objects)
+      const;
+
+  // names of objects which split the key space into ranges listed in parallel
+  mutable std::vector<std::string> m_listing_boundaries;
 };
 
 /**
@@ -71,39 +71,62 @@ std::vector<Object_details> Container::list_objects(
     auto request = list_objects_request(
         prefix, remaining < MAX_LIST_OBJECTS_LIMIT ? remaining : 0, recursive,
         fields, next_start);
-    rest::String_response response;
-
-    try {
-      ensure_connection()->get(&request, &response);
-    } catch (const Response_error &error) {
-      throw Response_error(error.status_code(),
-                           "Failed to list objects using prefix '" + prefix +
-                               "': " + error.what());
+    auto list = execute_list_objects(&request, prefix, &next_start,
+                                     out_prefixes);
+
+    if (remaining) {
+      remaining -= result.size();
     }
 
-    next_start.clear();
+    std::move(list.begin(), list.end(), std::back_inserter(result));
 
-    try {
-      auto list =
-          parse_list_objects(response.buffer, &next_start, out_prefixes);
+    if (next_start.empty() || result.size() == limit) {
+      done = true;
+    }
+  }
 
-      if (remaining) {
-        remaining -= result.size();
-      }
+  return result;
+}
 
-      std::move(list.begin(), list.end(), std::back_inserter(result));
-    } catch (const shcore::Exception &error) {
-      const auto msg = "Failed to parse 'list objects' (with prefix '" +
-                       prefix + "') response: " + error.what();
-      const auto &raw_data = response.buffer;
+std::vector<Object_details> Container::list_objects_range(
+    const std::string &prefix, const std::string &start_after,
+    const std::string &last, bool recursive,
+    const Object_details::Fields_mask &fields,
+    std::unordered_set<std::string> *out_prefixes) {
+  if (!has_list_objects_range()) {
+    throw std::logic_error(
+        "Listing of object ranges is not supported by this container");
+  }
 
-      log_debug2("%s\n%.*s", msg.c_str(), static_cast<int>(raw_data.size()),
-                 raw_data.data());
+  bool done = false;
+  std::vector<Object_details> result;
+  std::string next_start;
+
+  while (!done) {
+    // first request starts after the given object, subsequent ones continue
+    // where the previous one has finished
+    auto request =
+        next_start.empty()
+            ? list_objects_after_request(prefix, recursive, fields, start_after)
+            : list_objects_request(prefix, 0, recursive, fields, next_start);
+    auto list = execute_list_objects(&request, prefix, &next_start,
+                                     out_prefixes);
+
+    for (auto &object : list) {
+      // start of the range may be inclusive, depending on the backend
+      if (object.name <= start_after) {
+        continue;
+      }
+
+      if (!last.empty() && object.name > last) {
+        done = true;
+        break;
+      }
 
-      throw shcore::Exception::runtime_error(msg);
+      result.emplace_back(std::move(object));
     }
 
-    if (next_start.empty() || result.size() == limit) {
+    if (next_start.empty()) {
       done = true;
     }
   }
@@ -111,6 +134,42 @@ std::vector<Object_details> Container::list_objects(
   return result;
 }
 
+rest::Signed_request Container::list_objects_after_request(
+    const std::string &, bool, const Object_details::Fields_mask &,
+    const std::string &) {
+  throw std::logic_error(
+      "Container::list_objects_after_request() is not implemented");
+}
+
+std::vector<Object_details> Container::execute_list_objects(
+    rest::Signed_request *request, const std::string &prefix,
+    std::string *next_start, std::unordered_set<std::string> *out_prefixes) {
+  rest::String_response response;
+
+  try {
+    ensure_connection()->get(request, &response);
+  } catch (const Response_error &error) {
+    throw Response_error(error.status_code(),
+                         "Failed to list objects using prefix '" + prefix +
+                             "': " + error.what());
+  }
+
+  next_start->clear();
+
+  try {
+    return parse_list_objects(response.buffer, next_start, out_prefixes);
+  } catch (const shcore::Exception &error) {
+    const auto msg = "Failed to parse 'list objects' (with prefix '" + prefix +
+                     "') response: " + error.what();
+    const auto &raw_data = response.buffer;
+
+    log_debug2("%s\n%.*s", msg.c_str(), static_cast<int>(raw_data.size()),
+               raw_data.data());
+
+    throw shcore::Exception::runtime_error(msg);
+  }
+}
+
 size_t Container::head_object(const std::string &object_name) {
   auto request = head_object_request(object_name);
   Response response;
@@ -95,6 +95,35 @@ class Container {
       const Object_details::Fields_mask &fields = Object_details::NAME_SIZE,
       std::unordered_set<std::string> *out_prefixes = nullptr);
 
+  /**
+   * Determines whether the objects can be listed starting after the given
+   * object name.
+   */
+  virtual bool has_list_objects_range() const { return false; }
+
+  /**
+   * Lists objects in the bucket, whose names are in the given range.
+   *
+   * @param prefix: List only objects with the specified prefix.
+   * @param start_after: List objects with names greater than this one, if
+   *                     empty, listing starts with the first object.
+   * @param last: List objects with names not greater than this one, if empty,
+   *              listing ends with the last object.
+   * @param recursive: Recurse into subdirectories.
+   * @param fields: Fields to fetch.
+   * @param out_prefixes: If not recursive, names of the subdirectories will
+   *                      be stored here.
+   *
+   * @returns A list of objects.
+   *
+   * @throws std::logic_error if bucket does not support listing of ranges.
+   */
+  std::vector<Object_details> list_objects_range(
+      const std::string &prefix, const std::string &start_after,
+      const std::string &last, bool recursive = true,
+      const Object_details::Fields_mask &fields = Object_details::NAME_SIZE,
+      std::unordered_set<std::string> *out_prefixes = nullptr);
+
   /**
    * Retrieves basic information from an object in the bucket.
    *
@@ -254,6 +283,15 @@ class Container {
       const Object_details::Fields_mask &fields,
       const std::string &start_from) = 0;
 
+  virtual rest::Signed_request list_objects_after_request(
+      const std::string &prefix, bool recursive,
+      const Object_details::Fields_mask &fields,
+      const std::string &start_after);
+
+  std::vector<Object_details> execute_list_objects(
+      rest::Signed_request *request, const std::string &prefix,
+      std::string *next_start, std::unordered_set<std::string> *out_prefixes);
+
   virtual std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
       std::unordered_set<std::string> *out_prefixes) = 0;
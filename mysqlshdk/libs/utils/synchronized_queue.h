@@ -38,7 +38,7 @@
 
 namespace shcore {
 
-enum class Queue_priority { LOWEST = 1, LOW, MEDIUM, HIGH };
+enum class Queue_priority { LOWEST = 1, LOW, MEDIUM, HIGH, HIGHEST };
 
 /**
  * Multiple producer, multiple consumer synchronized FIFO queue.
@@ -126,7 +126,7 @@ class Synchronized_queue final {
 
   static constexpr Priority_t k_shutdown_priority = 0;
   static constexpr Priority_t k_max_priority =
-      map_priority(Queue_priority::HIGH);
+      map_priority(Queue_priority::HIGHEST);
 
   mutable std::mutex m_queue_mutex;
   std::condition_variable m_task_ready;
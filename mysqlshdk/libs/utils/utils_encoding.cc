@@ -24,13 +24,46 @@
 #include "mysqlshdk/libs/utils/utils_encoding.h"
 
 #include <openssl/evp.h>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 
 namespace shcore {
 namespace {
 using BIO_ptr = std::unique_ptr<BIO, decltype(&::BIO_free)>;
-}
+
+constexpr std::string_view k_base64_alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr std::string_view k_hex_digits = "0123456789ABCDEF";
+
+// maps 12 bits of input to two base64 characters, this allows to encode three
+// bytes using two lookups
+constexpr auto k_base64_pairs = []() {
+  std::array<char, 2 * 4096> table{};
+
+  for (std::size_t i = 0; i < 4096; ++i) {
+    table[2 * i] = k_base64_alphabet[i >> 6];
+    table[2 * i + 1] = k_base64_alphabet[i & 0x3F];
+  }
+
+  return table;
+}();
+
+// maps a byte to two hexadecimal digits
+constexpr auto k_hex_pairs = []() {
+  std::array<char, 2 * 256> table{};
+
+  for (std::size_t i = 0; i < 256; ++i) {
+    table[2 * i] = k_hex_digits[i >> 4];
+    table[2 * i + 1] = k_hex_digits[i & 0xF];
+  }
+
+  return table;
+}();
+}  // namespace
 
 bool decode_base64(const std::string &source, std::string *target) {
   assert(target);
@@ -73,4 +106,40 @@ bool encode_base64(const unsigned char *source, int source_length,
   return false;
 }
 
+char *encode_base64(std::string_view source, char *target) {
+  auto in = reinterpret_cast<const unsigned char *>(source.data());
+  auto length = source.length();
+
+  while (length >= 3) {
+    const uint32_t v = (in[0] << 16) | (in[1] << 8) | in[2];
+
+    ::memcpy(target, &k_base64_pairs[2 * (v >> 12)], 2);
+    ::memcpy(target + 2, &k_base64_pairs[2 * (v & 0xFFF)], 2);
+
+    in += 3;
+    length -= 3;
+    target += 4;
+  }
+
+  if (length > 0) {
+    const uint32_t v = (in[0] << 16) | (2 == length ? in[1] << 8 : 0);
+
+    *target++ = k_base64_alphabet[v >> 18];
+    *target++ = k_base64_alphabet[(v >> 12) & 0x3F];
+    *target++ = 2 == length ? k_base64_alphabet[(v >> 6) & 0x3F] : '=';
+    *target++ = '=';
+  }
+
+  return target;
+}
+
+char *encode_hex(std::string_view source, char *target) {
+  for (const auto c : source) {
+    ::memcpy(target, &k_hex_pairs[2 * static_cast<unsigned char>(c)], 2);
+    target += 2;
+  }
+
+  return target;
+}
+
 }  // namespace shcore
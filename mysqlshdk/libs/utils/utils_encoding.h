@@ -24,7 +24,9 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_ENCODING_H_
 #define MYSQLSHDK_LIBS_UTILS_ENCODING_H_
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace shcore {
 /**
@@ -37,6 +39,36 @@ namespace shcore {
 bool decode_base64(const std::string &source, std::string *target);
 bool encode_base64(const unsigned char *source, int source_length,
                    std::string *encoded);
+
+/**
+ * Provides the length of the base64 representation of the given number of
+ * bytes, including padding.
+ */
+constexpr std::size_t base64_encoded_length(std::size_t length) {
+  return (length + 2) / 3 * 4;
+}
+
+/**
+ * Encodes the given data using base64, with padding, without line breaks.
+ *
+ * @param source Data to be encoded.
+ * @param target Buffer which is going to hold the encoded data, must be able to
+ *        hold at least base64_encoded_length(source.length()) characters.
+ *
+ * @returns Pointer past the last written character.
+ */
+char *encode_base64(std::string_view source, char *target);
+
+/**
+ * Encodes the given data using upper-case hexadecimal digits, writes
+ * 2 * source.length() characters.
+ *
+ * @param source Data to be encoded.
+ * @param target Buffer which is going to hold the encoded data.
+ *
+ * @returns Pointer past the last written character.
+ */
+char *encode_hex(std::string_view source, char *target);
 }  // namespace shcore
 
 #endif  // MYSQLSHDK_LIBS_UTILS_ENCODING_H_
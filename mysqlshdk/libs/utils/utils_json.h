@@ -102,6 +102,7 @@ class SHCORE_PUBLIC Writer_base {
   virtual void append_string(const char *data, size_t length) = 0;
   virtual void append_float(double data) = 0;
   virtual void append_document(const rapidjson::Document &document) = 0;
+  virtual void append_raw(const char *data, size_t length) = 0;
 
  public:
   const std::string &str() const { return _data.data; }
@@ -132,6 +133,9 @@ class SHCORE_PUBLIC Raw_writer final : public Writer_base {
   virtual void append_document(const rapidjson::Document &document) {
     document.Accept(_writer);
   };
+  virtual void append_raw(const char *data, size_t length) {
+    _writer.RawValue(data, length, rapidjson::kObjectType);
+  }
 
  private:
   My_writer<SStream> _writer;
@@ -163,6 +167,9 @@ class SHCORE_PUBLIC Pretty_writer final : public Writer_base {
   virtual void append_document(const rapidjson::Document &document) {
     document.Accept(_writer);
   };
+  virtual void append_raw(const char *data, size_t length) {
+    _writer.RawValue(data, length, rapidjson::kObjectType);
+  }
 
  private:
   My_pretty_writer<SStream> _writer;
@@ -253,6 +260,13 @@ class SHCORE_PUBLIC JSON_dumper final {
 
   void append_json(const std::string &data) const;
 
+  /**
+   * Appends the given JSON text as is, it's not validated nor formatted.
+   */
+  void append_raw_json(const std::string &data) const {
+    _writer->append_raw(data.c_str(), data.length());
+  }
+
   int deep_level() const { return _deep_level; }
 
   const std::string &str() const { return _writer->str(); }
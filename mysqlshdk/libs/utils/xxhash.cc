@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/xxhash.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+constexpr uint64_t k_prime_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t k_prime_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t k_prime_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t k_prime_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t k_prime_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+// the algorithm uses little-endian byte order
+inline uint64_t read_64(const unsigned char *p) {
+  uint64_t value = 0;
+
+  for (int i = 7; i >= 0; --i) {
+    value = (value << 8) | p[i];
+  }
+
+  return value;
+}
+
+inline uint32_t read_32(const unsigned char *p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline uint64_t round(uint64_t acc, uint64_t input) {
+  acc += input * k_prime_2;
+  acc = rotl(acc, 31);
+  acc *= k_prime_1;
+  return acc;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t value) {
+  acc ^= round(0, value);
+  acc = acc * k_prime_1 + k_prime_4;
+  return acc;
+}
+
+inline const unsigned char *process_stripes(const unsigned char *p,
+                                            const unsigned char *end,
+                                            uint64_t *acc) {
+  while (end - p >= 32) {
+    acc[0] = round(acc[0], read_64(p));
+    acc[1] = round(acc[1], read_64(p + 8));
+    acc[2] = round(acc[2], read_64(p + 16));
+    acc[3] = round(acc[3], read_64(p + 24));
+    p += 32;
+  }
+
+  return p;
+}
+
+}  // namespace
+
+void Xxhash64::reset(uint64_t seed) {
+  m_seed = seed;
+  m_total_length = 0;
+  m_acc[0] = seed + k_prime_1 + k_prime_2;
+  m_acc[1] = seed + k_prime_2;
+  m_acc[2] = seed;
+  m_acc[3] = seed - k_prime_1;
+  m_buffered = 0;
+}
+
+void Xxhash64::update(const void *data, std::size_t length) {
+  if (!length) {
+    return;
+  }
+
+  auto p = static_cast<const unsigned char *>(data);
+  const auto end = p + length;
+
+  m_total_length += length;
+
+  if (m_buffered + length < k_stripe_size) {
+    // not enough data to fill a stripe
+    memcpy(m_buffer + m_buffered, p, length);
+    m_buffered += length;
+    return;
+  }
+
+  if (m_buffered) {
+    // complete the buffered stripe
+    const auto missing = k_stripe_size - m_buffered;
+    memcpy(m_buffer + m_buffered, p, missing);
+    p += missing;
+    process_stripes(m_buffer, m_buffer + k_stripe_size, m_acc);
+    m_buffered = 0;
+  }
+
+  p = process_stripes(p, end, m_acc);
+
+  if (p < end) {
+    m_buffered = end - p;
+    memcpy(m_buffer, p, m_buffered);
+  }
+}
+
+uint64_t Xxhash64::digest() const {
+  uint64_t h;
+
+  if (m_total_length >= k_stripe_size) {
+    h = rotl(m_acc[0], 1) + rotl(m_acc[1], 7) + rotl(m_acc[2], 12) +
+        rotl(m_acc[3], 18);
+    h = merge_round(h, m_acc[0]);
+    h = merge_round(h, m_acc[1]);
+    h = merge_round(h, m_acc[2]);
+    h = merge_round(h, m_acc[3]);
+  } else {
+    h = m_seed + k_prime_5;
+  }
+
+  h += m_total_length;
+
+  // process the remaining bytes
+  auto p = m_buffer;
+  const auto end = m_buffer + m_buffered;
+
+  while (end - p >= 8) {
+    h ^= round(0, read_64(p));
+    h = rotl(h, 27) * k_prime_1 + k_prime_4;
+    p += 8;
+  }
+
+  if (end - p >= 4) {
+    h ^= static_cast<uint64_t>(read_32(p)) * k_prime_1;
+    h = rotl(h, 23) * k_prime_2 + k_prime_3;
+    p += 4;
+  }
+
+  while (p < end) {
+    h ^= (*p) * k_prime_5;
+    h = rotl(h, 11) * k_prime_1;
+    ++p;
+  }
+
+  // final mix
+  h ^= h >> 33;
+  h *= k_prime_2;
+  h ^= h >> 29;
+  h *= k_prime_3;
+  h ^= h >> 32;
+
+  return h;
+}
+
+std::string Xxhash64::hex_digest() const {
+  char buffer[17];
+  snprintf(buffer, sizeof(buffer), "%016" PRIX64, digest());
+  return buffer;
+}
+
+uint64_t Xxhash64::hash(const void *data, std::size_t length, uint64_t seed) {
+  Xxhash64 h{seed};
+  h.update(data, length);
+  return h.digest();
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_XXHASH_H_
+#define MYSQLSHDK_LIBS_UTILS_XXHASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace mysqlshdk {
+namespace utils {
+
+/**
+ * Streaming implementation of the 64-bit xxHash (XXH64) algorithm. This is a
+ * fast non-cryptographic hash, suitable for detecting data corruption.
+ */
+class Xxhash64 final {
+ public:
+  explicit Xxhash64(uint64_t seed = 0) { reset(seed); }
+
+  Xxhash64(const Xxhash64 &) = default;
+  Xxhash64(Xxhash64 &&) = default;
+
+  Xxhash64 &operator=(const Xxhash64 &) = default;
+  Xxhash64 &operator=(Xxhash64 &&) = default;
+
+  ~Xxhash64() = default;
+
+  /**
+   * Resets the state, hash is going to be computed from scratch.
+   */
+  void reset(uint64_t seed = 0);
+
+  /**
+   * Adds the given data to the hash.
+   */
+  void update(const void *data, std::size_t length);
+
+  /**
+   * Provides hash of all the data added so far. State is not modified, more
+   * data can be added afterwards.
+   */
+  uint64_t digest() const;
+
+  /**
+   * Provides hash of all the data added so far, as a 16 character long
+   * hexadecimal string.
+   */
+  std::string hex_digest() const;
+
+  /**
+   * Computes hash of the given data.
+   */
+  static uint64_t hash(const void *data, std::size_t length,
+                       uint64_t seed = 0);
+
+ private:
+  static constexpr std::size_t k_stripe_size = 32;
+
+  uint64_t m_seed;
+  uint64_t m_total_length;
+  uint64_t m_acc[4];
+  unsigned char m_buffer[k_stripe_size];
+  std::size_t m_buffered;
+};
+
+}  // namespace utils
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_XXHASH_H_
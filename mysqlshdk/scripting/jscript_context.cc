@@ -36,10 +36,18 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <list>
 #include <stack>
+#include <system_error>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/xxhash.h"
 #include "scripting/module_registry.h"
 #include "scripting/object_factory.h"
 #include "scripting/object_registry.h"
@@ -163,6 +171,128 @@ class Current_script {
   std::stack<std::string> m_scripts;
 };
 
+/**
+ * Persistent cache of the code compiled by V8, stored in the user
+ * configuration directory. Entries are keyed by the hash of the source code
+ * and the version tag of V8's cached data, modified scripts or an upgraded V8
+ * use new entries. The number of entries is limited, the least recently used
+ * ones are removed.
+ */
+class Code_cache final {
+ public:
+  // maximum number of entries kept in the cache
+  static constexpr std::size_t k_max_entries = 256;
+
+  Code_cache()
+      : m_dir(path::join_path(get_user_config_path(), "cache", "js")) {}
+
+  /**
+   * Reads the cached data of the given source code.
+   *
+   * @returns nullptr if there's no cached data
+   */
+  std::unique_ptr<v8::ScriptCompiler::CachedData> load(
+      const std::string &source) const {
+    const auto entry = file(source);
+    std::ifstream in(entry, std::ios::binary | std::ios::ate);
+
+    if (!in.is_open()) return {};
+
+    // modification time marks the last use of the entry
+    std::error_code ec;
+    std::filesystem::last_write_time(
+        fs_path(entry), std::filesystem::file_time_type::clock::now(), ec);
+
+    const auto size = static_cast<std::size_t>(in.tellg());
+
+    if (0 == size) return {};
+
+    auto buffer = std::make_unique<uint8_t[]>(size);
+    in.seekg(0);
+
+    if (!in.read(reinterpret_cast<char *>(buffer.get()), size)) return {};
+
+    // V8 takes the ownership of the buffer
+    return std::make_unique<v8::ScriptCompiler::CachedData>(
+        buffer.release(), static_cast<int>(size),
+        v8::ScriptCompiler::CachedData::BufferOwned);
+  }
+
+  /**
+   * Writes the cached data of the given source code.
+   */
+  void store(const std::string &source,
+             const v8::ScriptCompiler::CachedData &data) const {
+    try {
+      create_directory(m_dir);
+
+      const auto target = file(source);
+      // cache can be written by multiple shell instances at the same time,
+      // entry is written to a temporary file and then renamed
+      const auto tmp = target + "." +
+                       get_random_string(8, "abcdefghijklmnopqrstuvwxyz");
+
+      {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(data.data), data.length);
+
+        if (!out.good()) {
+          throw std::runtime_error("failed to write '" + tmp + "'");
+        }
+      }
+
+      rename_file(tmp, target);
+      evict();
+    } catch (const std::exception &e) {
+      log_debug("Failed to store the JavaScript code cache: %s", e.what());
+    }
+  }
+
+ private:
+  static std::filesystem::path fs_path(const std::string &p) {
+#ifdef _WIN32
+    return std::filesystem::path{utf8_to_wide(p)};
+#else
+    return std::filesystem::path{p};
+#endif
+  }
+
+  /**
+   * Removes the least recently used entries, if there are too many of them.
+   */
+  void evict() const {
+    std::vector<std::pair<std::filesystem::file_time_type,
+                          std::filesystem::path>>
+        entries;
+    std::error_code ec;
+
+    for (const auto &entry :
+         std::filesystem::directory_iterator(fs_path(m_dir), ec)) {
+      if (entry.is_regular_file(ec)) {
+        entries.emplace_back(entry.last_write_time(ec), entry.path());
+      }
+    }
+
+    if (entries.size() <= k_max_entries) return;
+
+    const auto end = entries.begin() + (entries.size() - k_max_entries);
+    std::nth_element(entries.begin(), end, entries.end());
+
+    for (auto it = entries.begin(); it != end; ++it) {
+      // entry can be removed by another instance at the same time
+      std::filesystem::remove(it->second, ec);
+    }
+  }
+
+  std::string file(const std::string &source) const {
+    mysqlshdk::utils::Xxhash64 hash{v8::ScriptCompiler::CachedDataVersionTag()};
+    hash.update(source.data(), source.length());
+    return path::join_path(m_dir, hash.hex_digest() + ".bin");
+  }
+
+  std::string m_dir;
+};
+
 v8::MaybeLocal<v8::Value> evaluate_repl(v8::Isolate *isolate,
                                         v8::Local<v8::String> source) {
   return v8::debug::EvaluateGlobal(
@@ -274,6 +404,14 @@ class JScript_context::Impl {
    * and inserts the definitions on the JS globals.
    */
   void load_core_module() const;
+
+  /*
+   * Compiles the given source code, compilation is skipped if the persistent
+   * code cache holds an up-to-date entry for this code.
+   */
+  v8::MaybeLocal<v8::Script> compile_cached(v8::Local<v8::Context> context,
+                                            const std::string &source,
+                                            v8::ScriptOrigin *origin) const;
   void load_module(const std::string &path, v8::Local<v8::Value> module,
                    bool *js_exception = nullptr);
 
@@ -296,6 +434,7 @@ class JScript_context::Impl {
   std::vector<v8::Global<v8::Context>> m_stored_contexts;
   std::list<std::shared_ptr<JScript_function_storage>> m_stored_functions;
   Current_script m_current_script;
+  Code_cache m_code_cache;
 };
 
 JScript_context::Impl::Impl(JScript_context *owner)
@@ -393,8 +532,8 @@ void JScript_context::Impl::load_core_module() const {
   shcore::Scoped_naming_style style(NamingStyle::LowerCamelCase);
 
   v8::ScriptOrigin script_origin{m_isolate, v8_string("core.js")};
-  auto script = v8::Script::Compile(
-      lcontext, v8_string("(function (){" + shcore::js_core_module + "})();"),
+  auto script = compile_cached(
+      lcontext, "(function (){" + shcore::js_core_module + "})();",
       &script_origin);
 
   v8::MaybeLocal<v8::Value> result;
@@ -407,6 +546,37 @@ void JScript_context::Impl::load_core_module() const {
   }
 }
 
+v8::MaybeLocal<v8::Script> JScript_context::Impl::compile_cached(
+    v8::Local<v8::Context> context, const std::string &source,
+    v8::ScriptOrigin *origin) const {
+  auto cached_data = m_code_cache.load(source);
+  const bool use_cache = nullptr != cached_data;
+  // source takes the ownership of the cached data
+  v8::ScriptCompiler::Source code{v8_string(source), *origin,
+                                  cached_data.release()};
+
+  auto script = v8::ScriptCompiler::Compile(
+      context, &code,
+      use_cache ? v8::ScriptCompiler::kConsumeCodeCache
+                : v8::ScriptCompiler::kNoCompileOptions);
+
+  if (script.IsEmpty() || (use_cache && !code.GetCachedData()->rejected)) {
+    return script;
+  }
+
+  // there was no cached data, or it was rejected by V8 (i.e. flags have
+  // changed), store the new one
+  std::unique_ptr<v8::ScriptCompiler::CachedData> new_data{
+      v8::ScriptCompiler::CreateCodeCache(
+          script.ToLocalChecked()->GetUnboundScript())};
+
+  if (new_data) {
+    m_code_cache.store(source, *new_data);
+  }
+
+  return script;
+}
+
 void JScript_context::Impl::load_module(const std::string &path,
                                         v8::Local<v8::Value> module,
                                         bool *js_exception) {
@@ -434,10 +604,10 @@ void JScript_context::Impl::load_module(const std::string &path,
   v8::ScriptOrigin script_origin{m_isolate, v8_string(path)};
   // immediately invoked function expression inside of another IIFE, this saves
   // some C++ code to extract the data from the module object
-  v8::MaybeLocal<v8::Script> script = v8::Script::Compile(
+  v8::MaybeLocal<v8::Script> script = compile_cached(
       new_context,
-      v8_string("(function(m){(function(exports,module,__filename,__dirname){" +
-                source + "})(m.exports,m,m.__filename,m.__dirname)});"),
+      "(function(m){(function(exports,module,__filename,__dirname){" + source +
+          "})(m.exports,m,m.__filename,m.__dirname)});",
       &script_origin);
 
   if (script.IsEmpty()) {
@@ -262,6 +262,10 @@ std::vector<std::string> Shell_core::get_global_objects(Mode mode) {
   return globals;
 }
 
+void Shell_core::remove_global(const std::string &name) {
+  _globals.erase(name);
+}
+
 std::vector<std::string> Shell_core::get_all_globals() {
   std::vector<std::string> globals;
 
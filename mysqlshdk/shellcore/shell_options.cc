@@ -330,8 +330,8 @@ Shell_options::Shell_options(
          }
          return value;
       })
-    (&storage.ssh.buffer_size, 10240, "ssh.bufferSize",
-    "Set buffer size in bytes for data transfer, default is 10240 (10Kb)",
+    (&storage.ssh.buffer_size, 65536, "ssh.bufferSize",
+    "Set buffer size in bytes for data transfer, default is 65536 (64Kb)",
       shcore::opts::Range<int>(0, std::numeric_limits<int>::max()));
 
 #ifdef _WIN32
@@ -915,6 +915,22 @@ Shell_options::Shell_options(
           throw std::invalid_argument("Value for --quiet-start if any, must be any of 1 or 2");
         }
       })
+    (&storage.capture_workload, "", cmdline("--capture-workload=<path>"),
+        "Captures SQL statements executed by all sessions opened by the shell, "
+        "together with their timing, and writes them to the given file. The "
+        "file can be replayed using util.replayWorkload(). Text of statements "
+        "matching the logSql.ignorePatternUnsafe option is not written.")
+    (&storage.daemon, "", cmdline("--daemon=<path>"),
+        "Runs the shell as a daemon, which listens for requests on the given "
+        "UNIX socket. Interpreters, plugins and sessions are kept open between "
+        "the requests.")
+    (&storage.use_daemon, "", cmdline("--use-daemon=<path>"),
+        "Forwards the code given with --execute or read from the standard "
+        "input, or the command line operation, to the daemon listening on the "
+        "given UNIX socket, and prints its output.")
+    (&storage.startup_profile, false, cmdline("--startup-profile"),
+        "Prints the time spent in each of the initialization stages of the "
+        "shell.")
 
       (cmdline("--debug=<control>"),
       [this](const std::string &, const char* value) {
@@ -979,6 +995,7 @@ Shell_options::Shell_options(
 
     check_password_conflicts();
     check_ssh_conflicts();
+    check_daemon_conflicts();
 
     if (!flags.is_set(Option_flags::CONNECTION_ONLY)) {
       check_file_execute_conflicts();
@@ -1434,6 +1451,37 @@ void Shell_options::check_ssh_conflicts() {
   }
 }
 
+void Shell_options::check_daemon_conflicts() {
+  if (storage.daemon.empty() && storage.use_daemon.empty()) return;
+
+#ifdef _WIN32
+  throw std::runtime_error(
+      "The --daemon and --use-daemon options are not supported on Windows.");
+#else   // !_WIN32
+  if (!storage.daemon.empty() && !storage.use_daemon.empty()) {
+    throw std::runtime_error(
+        "Conflicting options: --daemon and --use-daemon cannot be used at the "
+        "same time.");
+  }
+
+  if (!storage.daemon.empty() &&
+      (!storage.execute_statement.empty() || !storage.run_file.empty() ||
+       !storage.run_module.empty() || m_shell_cli_operation)) {
+    throw std::runtime_error(
+        "The --daemon option cannot be used to execute code, it only handles "
+        "the requests forwarded using the --use-daemon option.");
+  }
+
+  if (!storage.use_daemon.empty() &&
+      (!storage.run_file.empty() || !storage.run_module.empty() ||
+       !storage.import_args.empty())) {
+    throw std::runtime_error(
+        "The --use-daemon option can be used only with --execute, the command "
+        "line operations or with the code read from the standard input.");
+  }
+#endif  // !_WIN32
+}
+
 void Shell_options::check_result_format() {
   if (storage.wrap_json != "off" &&
       get_option_source(SHCORE_RESULT_FORMAT) == Source::Command_line &&
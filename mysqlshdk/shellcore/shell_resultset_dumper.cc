@@ -33,6 +33,7 @@
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/db/column.h"
 #include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/db/utils/json_row_writer.h"
 #include "mysqlshdk/libs/utils/dtoa.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_encoding.h"  // base64 encoding utilities
@@ -675,6 +676,8 @@ size_t Resultset_dumper_base::dump_documents(bool is_doc_result) {
 
   if (!row) return row_count;
 
+  if (!pretty) return dump_raw_documents(row, is_doc_result, as_array);
+
   if (as_array) m_printer->raw_print("[\n");
   while (row) {
     shcore::JSON_dumper dumper(
@@ -703,6 +706,54 @@ size_t Resultset_dumper_base::dump_documents(bool is_doc_result) {
   return row_count;
 }
 
+/**
+ * Dumps a compact JSON document for each row/document, rows are written
+ * directly to a buffer which is printed in large chunks.
+ */
+size_t Resultset_dumper_base::dump_raw_documents(
+    const mysqlshdk::db::IRow *row, bool is_doc_result, bool as_array) {
+  // buffered output is printed once it reaches this size
+  constexpr std::size_t k_chunk_size = 64 * 1024;
+
+  const mysqlshdk::db::Json_row_writer writer{
+      m_result->get_metadata(),
+      mysqlsh::current_shell_options()->get().binary_limit};
+  std::string buffer;
+  size_t row_count = 0;
+
+  buffer.reserve(k_chunk_size + k_chunk_size / 4);
+
+  if (as_array) buffer += "[\n";
+
+  while (row) {
+    if (row_count > 0) {
+      if (as_array) buffer += ',';
+      buffer += '\n';
+    }
+
+    if (is_doc_result) {
+      writer.write_json(row->get_string(0), &buffer);
+    } else {
+      writer.write(*row, &buffer);
+    }
+
+    if (buffer.size() >= k_chunk_size) {
+      m_printer->raw_print(buffer);
+      buffer.clear();
+    }
+
+    row_count++;
+    row = m_result->fetch_one();
+  }
+
+  buffer += '\n';
+  if (as_array) buffer += "]\n";
+
+  m_printer->raw_print(buffer);
+
+  return row_count;
+}
+
 size_t Resultset_dumper_base::dump_tabbed() {
   const auto &metadata = m_result->get_metadata();
   auto row = m_result->fetch_one();
@@ -834,14 +885,36 @@ std::string Resultset_dumper_base::format_json(const std::string &item_label,
 
     const auto &metadata = m_result->get_metadata();
     auto row = m_result->fetch_one();
-    while (row) {
-      if (is_doc_result) {
-        dumper.append_json(row->get_string(0));
-      } else {
-        dump_json_row(&dumper, metadata, row);
+
+    if (pretty) {
+      while (row) {
+        if (is_doc_result) {
+          dumper.append_json(row->get_string(0));
+        } else {
+          dump_json_row(&dumper, metadata, row);
+        }
+        (*row_count)++;
+        row = m_result->fetch_one();
+      }
+    } else {
+      // compact rows are written directly, without the per-value calls
+      const mysqlshdk::db::Json_row_writer writer{
+          metadata, mysqlsh::current_shell_options()->get().binary_limit};
+      std::string json;
+
+      while (row) {
+        json.clear();
+
+        if (is_doc_result) {
+          writer.write_json(row->get_string(0), &json);
+        } else {
+          writer.write(*row, &json);
+        }
+
+        dumper.append_raw_json(json);
+        (*row_count)++;
+        row = m_result->fetch_one();
       }
-      (*row_count)++;
-      row = m_result->fetch_one();
     }
   }
 
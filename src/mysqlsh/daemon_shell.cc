@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "src/mysqlsh/daemon_shell.h"
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif  // !_WIN32
+
+#include <rapidjson/document.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/ishell_core.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "mysqlshdk/shellcore/shell_cli_operation.h"
+
+namespace mysqlsh {
+
+namespace {
+
+// how often (in milliseconds) the daemon checks if it was interrupted
+constexpr int k_poll_interval = 100;
+
+std::string message(const char *key, const std::string &value) {
+  shcore::JSON_dumper dumper;
+  dumper.start_object();
+  dumper.append_string(key, value);
+  dumper.end_object();
+  return dumper.str() + "\n";
+}
+
+std::string exit_code_message(int code) {
+  shcore::JSON_dumper dumper;
+  dumper.start_object();
+  dumper.append_int("exitCode", code);
+  dumper.end_object();
+  return dumper.str() + "\n";
+}
+
+#ifndef _WIN32
+
+std::string socket_error(const std::string &context) {
+  return context + ": " + shcore::errno_to_string(errno);
+}
+
+sockaddr_un socket_address(const std::string &path) {
+  sockaddr_un addr{};
+
+  if (path.length() >= sizeof(addr.sun_path)) {
+    throw std::invalid_argument("The path of the UNIX socket is too long: " +
+                                path);
+  }
+
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.length() + 1);
+
+  return addr;
+}
+
+int open_socket() {
+  const auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (fd < 0) {
+    throw std::runtime_error(socket_error("Failed to create a UNIX socket"));
+  }
+
+  return fd;
+}
+
+/**
+ * Connects to the daemon listening on the given socket.
+ *
+ * @returns socket descriptor or -1 if connection was not possible
+ */
+int connect_to_daemon(const std::string &path) {
+  const auto addr = socket_address(path);
+  const auto fd = open_socket();
+
+  if (::connect(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) <
+      0) {
+    const auto error = errno;
+    ::close(fd);
+    errno = error;
+    return -1;
+  }
+
+  return fd;
+}
+
+bool send_all(int fd, const std::string &data) {
+  std::size_t offset = 0;
+
+  while (offset < data.length()) {
+    const auto bytes = ::send(fd, data.c_str() + offset,
+                              data.length() - offset, MSG_NOSIGNAL);
+
+    if (bytes < 0) {
+      if (EINTR == errno) continue;
+      return false;
+    }
+
+    offset += static_cast<std::size_t>(bytes);
+  }
+
+  return true;
+}
+
+/**
+ * Reads a single line from the socket, the buffer holds data which was
+ * received but not yet consumed.
+ *
+ * @returns false if connection was closed (or stop was requested) before the
+ *          whole line was received
+ */
+bool read_line(int fd, std::string *buffer, std::string *line,
+               const std::atomic<bool> *stop = nullptr) {
+  char data[4096];
+
+  while (true) {
+    if (const auto pos = buffer->find('\n'); std::string::npos != pos) {
+      line->assign(*buffer, 0, pos);
+      buffer->erase(0, pos + 1);
+      return true;
+    }
+
+    if (stop) {
+      pollfd pfd{fd, POLLIN, 0};
+      const auto ready = ::poll(&pfd, 1, k_poll_interval);
+
+      if (*stop) return false;
+
+      if (ready < 0) {
+        if (EINTR == errno) continue;
+        return false;
+      }
+
+      if (0 == ready) continue;
+    }
+
+    const auto bytes = ::recv(fd, data, sizeof(data), 0);
+
+    if (bytes < 0) {
+      if (EINTR == errno) continue;
+      return false;
+    }
+
+    if (0 == bytes) return false;
+
+    buffer->append(data, static_cast<std::size_t>(bytes));
+  }
+}
+
+#endif  // !_WIN32
+
+}  // namespace
+
+/**
+ * Streams everything printed by the shell to the client, while it exists.
+ */
+class Daemon_shell::Output final : public shcore::Interpreter_print_handler {
+ public:
+  explicit Output(int fd)
+      : shcore::Interpreter_print_handler(this, &Output::print_stdout,
+                                          &Output::print_stderr,
+                                          &Output::print_stderr),
+        m_fd(fd) {
+    current_console()->add_print_handler(this);
+  }
+
+  Output(const Output &) = delete;
+  Output(Output &&) = delete;
+
+  Output &operator=(const Output &) = delete;
+  Output &operator=(Output &&) = delete;
+
+  ~Output() override { current_console()->remove_print_handler(this); }
+
+  void send(const std::string &data) {
+#ifndef _WIN32
+    // if client is gone, output is discarded
+    if (m_connected && !send_all(m_fd, data)) {
+      log_warning("Client of the daemon has disconnected: %s",
+                  shcore::errno_to_string(errno).c_str());
+      m_connected = false;
+    }
+#endif  // !_WIN32
+  }
+
+ private:
+  static bool print_stdout(void *user_data, const char *text) {
+    static_cast<Output *>(user_data)->send(message("stdout", text));
+    return true;
+  }
+
+  static bool print_stderr(void *user_data, const char *text) {
+    static_cast<Output *>(user_data)->send(message("stderr", text));
+    return true;
+  }
+
+  int m_fd;
+  bool m_connected = true;
+};
+
+Daemon_shell::Daemon_shell(std::shared_ptr<Shell_options> options)
+    : Json_shell(std::move(options)) {}
+
+Daemon_shell::~Daemon_shell() {
+  for (const auto &session : m_sessions) {
+    try {
+      if (session.second->is_open()) session.second->close();
+    } catch (const std::exception &e) {
+      log_warning("Failed to close the session to '%s': %s",
+                  session.first.c_str(), e.what());
+    }
+  }
+}
+
+int Daemon_shell::serve(const std::string &socket_path) {
+#ifdef _WIN32
+  throw std::runtime_error("The daemon mode is not supported on Windows.");
+#else   // !_WIN32
+  const auto addr = socket_address(socket_path);
+
+  if (const auto fd = connect_to_daemon(socket_path); fd >= 0) {
+    ::close(fd);
+    throw std::runtime_error("Another daemon is already listening on '" +
+                             socket_path + "'.");
+  }
+
+  // remove the socket left by a daemon which has been terminated, anything
+  // else is left untouched
+  if (struct stat st; 0 == ::lstat(socket_path.c_str(), &st)) {
+    if (!S_ISSOCK(st.st_mode)) {
+      throw std::runtime_error("The path '" + socket_path +
+                               "' already exists and it is not a UNIX socket.");
+    }
+
+    ::unlink(socket_path.c_str());
+  }
+
+  const auto fd = open_socket();
+  shcore::Scoped_callback close_socket([fd, &socket_path]() {
+    ::close(fd);
+    ::unlink(socket_path.c_str());
+  });
+
+  {
+    // socket is created with user-only permissions, there's no window in which
+    // other users could connect to it
+    const auto previous_umask = ::umask(S_IRWXG | S_IRWXO);
+    shcore::Scoped_callback restore_umask(
+        [previous_umask]() { ::umask(previous_umask); });
+
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) <
+        0) {
+      throw std::runtime_error(
+          socket_error("Failed to bind to the UNIX socket '" + socket_path +
+                       "'"));
+    }
+  }
+
+  // requests are executed with the privileges of this process, only the
+  // owner can send them
+  if (::chmod(socket_path.c_str(), S_IRUSR | S_IWUSR) < 0) {
+    throw std::runtime_error(socket_error(
+        "Failed to change permissions of the UNIX socket '" + socket_path +
+        "'"));
+  }
+
+  if (::listen(fd, SOMAXCONN) < 0) {
+    throw std::runtime_error(socket_error(
+        "Failed to listen on the UNIX socket '" + socket_path + "'"));
+  }
+
+  m_default_session = shell_context()->get_dev_session();
+
+  shcore::Interrupt_handler intr_handler([this]() {
+    m_stop = true;
+    return false;
+  });
+
+  log_info("Daemon is listening on '%s'", socket_path.c_str());
+  current_console()->print_info("MySQL Shell daemon is listening on '" +
+                                socket_path + "'.");
+
+  while (!m_stop) {
+    pollfd pfd{fd, POLLIN, 0};
+    const auto ready = ::poll(&pfd, 1, k_poll_interval);
+
+    if (ready < 0 && EINTR != errno) {
+      throw std::runtime_error(socket_error("Failed to wait for requests"));
+    }
+
+    if (ready <= 0) continue;
+
+    const auto client = ::accept(fd, nullptr, nullptr);
+
+    if (client < 0) {
+      if (EINTR == errno || ECONNABORTED == errno) continue;
+      throw std::runtime_error(socket_error("Failed to accept a connection"));
+    }
+
+    shcore::Scoped_callback close_client([client]() { ::close(client); });
+
+    serve_client(client);
+  }
+
+  log_info("Daemon has been stopped");
+
+  return 0;
+#endif  // !_WIN32
+}
+
+void Daemon_shell::serve_client(int fd) {
+#ifndef _WIN32
+  std::string buffer;
+  std::string line;
+
+  while (read_line(fd, &buffer, &line, &m_stop)) {
+    if (shcore::str_strip(line).empty()) continue;
+
+    Output output{fd};
+    int exit_code = 1;
+
+    try {
+      exit_code = handle_request(line);
+    } catch (const shcore::Exception &e) {
+      current_console()->print_error(e.format());
+    } catch (const std::exception &e) {
+      current_console()->print_error(e.what());
+    }
+
+    output.send(exit_code_message(exit_code));
+  }
+#else   // _WIN32
+  (void)fd;
+#endif  // _WIN32
+}
+
+int Daemon_shell::handle_request(const std::string &request) {
+  rapidjson::Document doc;
+  doc.Parse(request.c_str(), request.length());
+
+  if (doc.HasParseError() || !doc.IsObject()) {
+    throw std::invalid_argument("Invalid request: " + request);
+  }
+
+  if (doc.HasMember("complete")) {
+    Json_shell::process_line(request);
+    return 0;
+  }
+
+  const auto get_string = [&doc](const char *name) -> std::string {
+    if (!doc.HasMember(name)) return {};
+
+    if (!doc[name].IsString()) {
+      throw std::invalid_argument(shcore::str_format(
+          "Invalid request, '%s' member is expected to be a string.", name));
+    }
+
+    return doc[name].GetString();
+  };
+
+  use_session(get_string("connect"));
+
+  const auto previous_mode = interactive_mode();
+  shcore::Scoped_callback restore_mode([this, previous_mode]() {
+    if (interactive_mode() != previous_mode) {
+      switch_shell_mode(previous_mode, {});
+    }
+  });
+
+  if (const auto mode = get_string("mode"); !mode.empty()) {
+    if (const auto new_mode = shcore::parse_mode(mode);
+        new_mode != previous_mode) {
+      switch_shell_mode(new_mode, {});
+    }
+  }
+
+  if (doc.HasMember("cli")) {
+    if (!doc["cli"].IsArray()) {
+      throw std::invalid_argument(
+          "Invalid request, 'cli' member is expected to be an array.");
+    }
+
+    std::vector<std::string> args;
+
+    for (const auto &arg : doc["cli"].GetArray()) {
+      if (!arg.IsString()) {
+        throw std::invalid_argument(
+            "Invalid request, 'cli' member is expected to be an array of "
+            "strings.");
+      }
+
+      args.emplace_back(arg.GetString(), arg.GetStringLength());
+    }
+
+    return execute_cli(args);
+  }
+
+  if (doc.HasMember("execute")) {
+    std::stringstream stream(get_string("execute"));
+    log_debug2("CODE:\n%s", stream.str().c_str());
+
+    return process_stream(stream, "(daemon)", {});
+  }
+
+  throw std::invalid_argument("Invalid command in request: " + request);
+}
+
+int Daemon_shell::execute_cli(const std::vector<std::string> &args) {
+  std::vector<const char *> argv;
+  argv.reserve(args.size());
+
+  for (const auto &arg : args) {
+    argv.emplace_back(arg.c_str());
+  }
+
+  shcore::Options::Cmdline_iterator iterator(static_cast<int>(argv.size()),
+                                             argv.data(), 0);
+  shcore::cli::Shell_cli_operation operation;
+  operation.parse(&iterator);
+
+  register_cli_providers(operation.get_provider());
+
+  try {
+    print_result(operation.execute());
+  } catch (const std::invalid_argument &e) {
+    current_console()->print_error(e.what());
+    return 10;
+  } catch (const std::exception &e) {
+    current_console()->print_error(e.what());
+    return 1;
+  }
+
+  return 0;
+}
+
+void Daemon_shell::use_session(const std::string &uri) {
+  std::shared_ptr<ShellBaseSession> session;
+
+  if (uri.empty()) {
+    // requests without a connection use the session the daemon was started
+    // with (if any)
+    session = m_default_session;
+  } else {
+    const mysqlshdk::db::Connection_options options{uri};
+    auto &pooled = m_sessions[options.as_uri()];
+
+    if (!pooled || !pooled->is_open()) {
+      pooled = connect(options, false, false);
+      pooled->enable_sql_mode_tracking();
+    }
+
+    session = pooled;
+  }
+
+  const auto active = shell_context()->get_dev_session();
+
+  if (active == session) return;
+
+  // session opened by the previous request (i.e. using shell.connect()) is not
+  // visible to this one
+  if (active && active != m_default_session) {
+    const auto pooled = std::find_if(
+        m_sessions.begin(), m_sessions.end(),
+        [&active](const auto &entry) { return entry.second == active; });
+
+    if (m_sessions.end() == pooled && active->is_open()) {
+      try {
+        active->close();
+      } catch (const std::exception &e) {
+        log_warning("Failed to close the session opened by a request: %s",
+                    e.what());
+      }
+    }
+  }
+
+  if (session && session->is_open()) {
+    set_active_session(session);
+  } else {
+    // there's no session to be used, this request starts without one
+    std::shared_ptr<ShellBaseSession> null_session;
+    shell_context()->set_dev_session(null_session);
+    _global_shell->set_session_global(null_session);
+  }
+}
+
+int forward_to_daemon(const Shell_options::Storage &options,
+                      const std::vector<std::string> &cli_args) {
+#ifdef _WIN32
+  (void)options;
+  (void)cli_args;
+  throw std::runtime_error("The daemon mode is not supported on Windows.");
+#else   // !_WIN32
+  shcore::JSON_dumper request;
+  request.start_object();
+
+  if (!cli_args.empty()) {
+    request.append_string("cli");
+    request.start_array();
+
+    for (const auto &arg : cli_args) {
+      request.append_string(arg);
+    }
+
+    request.end_array();
+  } else if (!options.execute_statement.empty()) {
+    request.append_string("execute", options.execute_statement);
+  } else {
+    request.append_string(
+        "execute", std::string{std::istreambuf_iterator<char>(std::cin), {}});
+  }
+
+  if (shcore::IShell_core::Mode::None != options.initial_mode) {
+    request.append_string("mode", shcore::to_string(options.initial_mode));
+  }
+
+  if (options.has_connection_data()) {
+    // password is sent as well, socket is accessible only by its owner
+    request.append_string("connect", options.connection_options().as_uri(
+                                         mysqlshdk::db::uri::formats::full()));
+  }
+
+  request.end_object();
+
+  const auto fd = connect_to_daemon(options.use_daemon);
+
+  if (fd < 0) {
+    std::cerr << socket_error(
+                     "Unable to connect to the MySQL Shell daemon at '" +
+                     options.use_daemon + "'")
+              << std::endl;
+    return 1;
+  }
+
+  shcore::Scoped_callback close_socket([fd]() { ::close(fd); });
+
+  if (!send_all(fd, request.str() + "\n")) {
+    std::cerr << socket_error("Failed to send the request to the daemon")
+              << std::endl;
+    return 1;
+  }
+
+  // no more requests, daemon will finish handling this client after this one
+  ::shutdown(fd, SHUT_WR);
+
+  std::string buffer;
+  std::string line;
+
+  while (read_line(fd, &buffer, &line)) {
+    rapidjson::Document doc;
+    doc.Parse(line.c_str(), line.length());
+
+    if (doc.HasParseError() || !doc.IsObject()) {
+      std::cerr << "Invalid response from the daemon: " << line << std::endl;
+      return 1;
+    }
+
+    if (doc.HasMember("exitCode") && doc["exitCode"].IsInt()) {
+      return doc["exitCode"].GetInt();
+    }
+
+    for (const auto &stream : {std::make_pair("stdout", stdout),
+                               std::make_pair("stderr", stderr)}) {
+      if (doc.HasMember(stream.first) && doc[stream.first].IsString()) {
+        const auto &text = doc[stream.first];
+        fwrite(text.GetString(), 1, text.GetStringLength(), stream.second);
+        fflush(stream.second);
+      }
+    }
+  }
+
+  std::cerr << "The MySQL Shell daemon closed the connection unexpectedly."
+            << std::endl;
+  return 1;
+#endif  // !_WIN32
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SRC_MYSQLSH_DAEMON_SHELL_H_
+#define SRC_MYSQLSH_DAEMON_SHELL_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/base_session.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "src/mysqlsh/json_shell.h"
+
+namespace mysqlsh {
+
+/**
+ * A long-lived shell which handles the requests sent over a UNIX socket.
+ *
+ * Each request is a single line holding a JSON object:
+ *
+ * - execute - code to be executed,
+ * - cli - array with the command line operation arguments (what follows '--'),
+ * - complete - same as in Json_shell,
+ * - mode - optional, mode used to execute the code (sql, js, py),
+ * - connect - optional, URI of the instance the request is executed against.
+ *
+ * Output of a request is streamed back, one JSON object per line: either
+ * {"stdout": "text"} or {"stderr": "text"}, the last one is
+ * {"exitCode": code}.
+ *
+ * Interpreters, plugins and global variables are initialized once and shared
+ * by all requests. Sessions to the instances given in the 'connect' member
+ * are pooled and reused by the subsequent requests. Requests without this
+ * member use the session the daemon was started with (if any), sessions
+ * opened by a request are closed before the next one is handled. Requests are
+ * handled one at a time.
+ *
+ * The socket is accessible only by the user running the daemon.
+ */
+class Daemon_shell : public Json_shell {
+ public:
+  explicit Daemon_shell(std::shared_ptr<Shell_options> options);
+
+  ~Daemon_shell() override;
+
+  /**
+   * Listens on the given UNIX socket and handles the requests until the shell
+   * is interrupted.
+   *
+   * @param socket_path path of the UNIX socket
+   *
+   * @returns exit code of the shell
+   */
+  int serve(const std::string &socket_path);
+
+ private:
+  class Output;
+
+  void serve_client(int fd);
+
+  int handle_request(const std::string &request);
+
+  int execute_cli(const std::vector<std::string> &args);
+
+  void use_session(const std::string &uri);
+
+  std::atomic<bool> m_stop{false};
+  std::shared_ptr<ShellBaseSession> m_default_session;
+  std::map<std::string, std::shared_ptr<ShellBaseSession>> m_sessions;
+};
+
+/**
+ * Forwards the request described by the command line options to the daemon,
+ * prints its output.
+ *
+ * @param options shell options
+ * @param cli_args arguments of the command line operation (if any)
+ *
+ * @returns exit code of the request
+ */
+int forward_to_daemon(const Shell_options::Storage &options,
+                      const std::vector<std::string> &cli_args);
+
+}  // namespace mysqlsh
+
+#endif  // SRC_MYSQLSH_DAEMON_SHELL_H_
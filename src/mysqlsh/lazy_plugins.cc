@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "src/mysqlsh/lazy_plugins.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "modules/mod_extensible_object.h"
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+// changes whenever format of the manifest changes
+constexpr int k_manifest_version = 2;
+
+std::vector<std::string> to_vector(const shcore::Array_t &array) {
+  std::vector<std::string> result;
+
+  if (array) {
+    for (const auto &value : *array) {
+      result.emplace_back(value.as_string());
+    }
+  }
+
+  return result;
+}
+
+// FNV-1a, signatures need to be stable between the runs
+void fnv1a(std::string_view data, uint64_t *hash) {
+  for (const auto c : data) {
+    *hash ^= static_cast<unsigned char>(c);
+    *hash *= UINT64_C(0x100000001b3);
+  }
+}
+
+void collect_members(const std::string &prefix,
+                     const std::shared_ptr<Extensible_object> &object,
+                     std::vector<std::string> *members) {
+  for (const auto &name : object->get_members()) {
+    auto qualified = prefix + "." + name;
+    const auto member = object->get_member(name);
+
+    if (shcore::Object == member.get_type()) {
+      if (const auto child = member.as_object<Extensible_object>()) {
+        collect_members(qualified, child, members);
+      }
+    }
+
+    members->emplace_back(std::move(qualified));
+  }
+}
+
+}  // namespace
+
+Plugin_manifest::Plugin_manifest(std::string path) : m_path(std::move(path)) {}
+
+void Plugin_manifest::load() {
+  m_plugins.clear();
+  m_modified = false;
+
+  std::string data;
+
+  if (!shcore::load_text_file(m_path, data)) return;
+
+  try {
+    const auto manifest = shcore::Value::parse(data).as_map();
+
+    if (k_manifest_version != manifest->get_int("version")) {
+      log_info("Plugin manifest '%s' has a different version, ignoring it",
+               m_path.c_str());
+      m_modified = true;
+      return;
+    }
+
+    const auto plugins = manifest->get_array("plugins");
+
+    if (!plugins) throw std::runtime_error("missing list of plugins");
+
+    for (const auto &entry : *plugins) {
+      const auto map = entry.as_map();
+      Plugin plugin;
+
+      plugin.file = map->get_string("file");
+      plugin.signature = map->get_int("signature");
+      plugin.globals = to_vector(map->get_array("globals"));
+      plugin.cli_globals = to_vector(map->get_array("cliGlobals"));
+      plugin.reports = to_vector(map->get_array("reports"));
+      plugin.side_effects = map->get_bool("sideEffects");
+
+      auto file = plugin.file;
+      m_plugins.emplace(std::move(file), std::move(plugin));
+    }
+  } catch (const std::exception &e) {
+    log_warning("Failed to read the plugin manifest '%s', ignoring it: %s",
+                m_path.c_str(), e.what());
+    m_plugins.clear();
+    m_modified = true;
+  }
+}
+
+void Plugin_manifest::save() {
+  if (!m_modified) return;
+
+  const auto plugins = shcore::make_array();
+
+  for (const auto &entry : m_plugins) {
+    const auto &plugin = entry.second;
+    const auto map = shcore::make_dict();
+
+    map->emplace("file", plugin.file);
+    map->emplace("signature", plugin.signature);
+    map->emplace("globals", shcore::make_array(plugin.globals));
+    map->emplace("cliGlobals", shcore::make_array(plugin.cli_globals));
+    map->emplace("reports", shcore::make_array(plugin.reports));
+    map->emplace("sideEffects", plugin.side_effects);
+
+    plugins->emplace_back(map);
+  }
+
+  const auto manifest = shcore::make_dict();
+  manifest->emplace("version", k_manifest_version);
+  manifest->emplace("plugins", plugins);
+
+  if (shcore::create_file(m_path, shcore::Value(manifest).json(true))) {
+    m_modified = false;
+  } else {
+    log_warning("Failed to write the plugin manifest '%s': %s", m_path.c_str(),
+                shcore::get_last_error().c_str());
+  }
+}
+
+const Plugin_manifest::Plugin *Plugin_manifest::find(
+    const std::string &file) const {
+  const auto it = m_plugins.find(file);
+
+  if (m_plugins.end() == it || it->second.signature != signature(file)) {
+    return nullptr;
+  }
+
+  return &it->second;
+}
+
+void Plugin_manifest::store(Plugin plugin) {
+  plugin.signature = signature(plugin.file);
+
+  auto file = plugin.file;
+  m_plugins[std::move(file)] = std::move(plugin);
+  m_modified = true;
+}
+
+void Plugin_manifest::retain(const std::vector<std::string> &files) {
+  for (auto it = m_plugins.begin(); it != m_plugins.end();) {
+    if (std::find(files.begin(), files.end(), it->first) == files.end()) {
+      it = m_plugins.erase(it);
+      m_modified = true;
+    } else {
+      ++it;
+    }
+  }
+}
+
+int64_t Plugin_manifest::signature(const std::string &file) {
+  namespace fs = std::filesystem;
+
+  const auto directory = fs::u8path(file).parent_path();
+  std::error_code ec;
+  std::vector<std::string> entries;
+
+  for (fs::recursive_directory_iterator
+           it{directory, fs::directory_options::skip_permission_denied, ec},
+       end;
+       !ec && it != end; it.increment(ec)) {
+    const auto &path = it->path();
+
+    if (it->is_directory(ec)) {
+      if ("__pycache__" == path.filename()) it.disable_recursion_pending();
+      continue;
+    }
+
+    if (".pyc" == path.extension()) continue;
+
+    const auto size = it->file_size(ec);
+    const auto time = it->last_write_time(ec);
+
+    if (ec) break;
+
+    entries.emplace_back(
+        path.lexically_relative(directory).generic_string() + ':' +
+        std::to_string(size) + ':' +
+        std::to_string(time.time_since_epoch().count()));
+  }
+
+  if (ec) {
+    log_debug("Failed to compute signature of the plugin '%s': %s",
+              file.c_str(), ec.message().c_str());
+    return 0;
+  }
+
+  // order of the directory entries is not specified
+  std::sort(entries.begin(), entries.end());
+
+  uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+  for (const auto &entry : entries) {
+    fnv1a(entry, &hash);
+    fnv1a({"\n", 1}, &hash);
+  }
+
+  return static_cast<int64_t>(hash);
+}
+
+Output_detector::Output_detector()
+    : shcore::Interpreter_print_handler(this, &Output_detector::on_print,
+                                        &Output_detector::on_print, nullptr) {
+  current_console()->add_print_handler(this);
+}
+
+Output_detector::~Output_detector() {
+  current_console()->remove_print_handler(this);
+}
+
+bool Output_detector::on_print(void *user_data, const char *text) {
+  if (text && *text) {
+    static_cast<Output_detector *>(user_data)->m_detected = true;
+  }
+
+  // other handlers need to print the text
+  return false;
+}
+
+std::vector<std::string> extension_object_members(const std::string &name,
+                                                  const shcore::Value &value) {
+  std::vector<std::string> members;
+
+  if (shcore::Object == value.get_type()) {
+    if (const auto object = value.as_object<Extensible_object>()) {
+      collect_members(name, object, &members);
+    }
+  }
+
+  return members;
+}
+
+Lazy_plugin_object::Lazy_plugin_object(std::string name, bool cli_enabled,
+                                       Loader loader)
+    : m_name(std::move(name)),
+      m_cli_enabled(cli_enabled),
+      m_loader(std::move(loader)) {}
+
+const std::shared_ptr<shcore::Cpp_object_bridge> &Lazy_plugin_object::object()
+    const {
+  if (!m_object) {
+    log_debug("Global object '%s' was used, loading its plugin",
+              m_name.c_str());
+
+    m_object = m_loader();
+
+    if (!m_object) {
+      throw std::runtime_error("The plugin which has registered the '" +
+                               m_name +
+                               "' global object could not be loaded.");
+    }
+  }
+
+  return m_object;
+}
+
+std::string Lazy_plugin_object::class_name() const {
+  return object()->class_name();
+}
+
+std::vector<std::string> Lazy_plugin_object::get_members() const {
+  return object()->get_members();
+}
+
+shcore::Value Lazy_plugin_object::get_member(const std::string &prop) const {
+  return object()->get_member(prop);
+}
+
+bool Lazy_plugin_object::has_member(const std::string &prop) const {
+  return object()->has_member(prop);
+}
+
+void Lazy_plugin_object::set_member(const std::string &prop,
+                                    shcore::Value value) {
+  object()->set_member(prop, std::move(value));
+}
+
+bool Lazy_plugin_object::has_method(const std::string &name) const {
+  return object()->has_method(name);
+}
+
+shcore::Value Lazy_plugin_object::call(const std::string &name,
+                                       const shcore::Argument_list &args) {
+  return object()->call(name, args);
+}
+
+shcore::Value Lazy_plugin_object::get_member_advanced(
+    const std::string &prop) const {
+  return object()->get_member_advanced(prop);
+}
+
+bool Lazy_plugin_object::has_member_advanced(const std::string &prop) const {
+  return object()->has_member_advanced(prop);
+}
+
+void Lazy_plugin_object::set_member_advanced(const std::string &prop,
+                                             shcore::Value value) {
+  object()->set_member_advanced(prop, std::move(value));
+}
+
+bool Lazy_plugin_object::has_method_advanced(const std::string &name) const {
+  return object()->has_method_advanced(name);
+}
+
+shcore::Value Lazy_plugin_object::call_advanced(
+    const std::string &name, const shcore::Argument_list &args,
+    const shcore::Dictionary_t &kwargs) {
+  return object()->call_advanced(name, args, kwargs);
+}
+
+std::string &Lazy_plugin_object::append_descr(std::string &s_out, int indent,
+                                              int quote_strings) const {
+  return object()->append_descr(s_out, indent, quote_strings);
+}
+
+std::string &Lazy_plugin_object::append_repr(std::string &s_out) const {
+  return object()->append_repr(s_out);
+}
+
+std::string Lazy_plugin_object::help(const std::string &item) {
+  return object()->help(item);
+}
+
+std::string Lazy_plugin_object::get_help_id() const {
+  return object()->get_help_id();
+}
+
+}  // namespace mysqlsh
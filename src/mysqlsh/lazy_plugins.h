@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SRC_MYSQLSH_LAZY_PLUGINS_H_
+#define SRC_MYSQLSH_LAZY_PLUGINS_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/lang_base.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+
+namespace mysqlsh {
+
+/**
+ * Cache of the global objects and reports registered by each of the plugins,
+ * used to defer loading of the plugins until their objects are used.
+ *
+ * An entry is valid as long as none of the files in the directory of the
+ * plugin is added, removed or modified.
+ */
+class Plugin_manifest final {
+ public:
+  struct Plugin {
+    std::string file;
+    // signature of the directory of the plugin
+    int64_t signature = 0;
+    // global objects registered by the plugin
+    std::vector<std::string> globals;
+    // subset of globals which can be called from the command line
+    std::vector<std::string> cli_globals;
+    // reports registered by the plugin
+    std::vector<std::string> reports;
+    // plugin did something else than registering global objects and reports
+    // (i.e. printed something or extended objects registered before it)
+    bool side_effects = false;
+
+    /**
+     * Plugin can be loaded lazily if it only registers global objects, these
+     * are replaced with placeholders which load the plugin on first use.
+     */
+    bool lazy() const {
+      return !globals.empty() && reports.empty() && !side_effects;
+    }
+  };
+
+  explicit Plugin_manifest(std::string path);
+
+  Plugin_manifest(const Plugin_manifest &) = delete;
+  Plugin_manifest(Plugin_manifest &&) = default;
+
+  Plugin_manifest &operator=(const Plugin_manifest &) = delete;
+  Plugin_manifest &operator=(Plugin_manifest &&) = default;
+
+  ~Plugin_manifest() = default;
+
+  /**
+   * Reads the manifest, missing or invalid file results in an empty manifest.
+   */
+  void load();
+
+  /**
+   * Writes the manifest, if it was modified.
+   */
+  void save();
+
+  /**
+   * Provides an up-to-date entry for the given initialization file.
+   *
+   * @returns nullptr if there is no entry or plugin was modified
+   */
+  const Plugin *find(const std::string &file) const;
+
+  /**
+   * Stores an entry, signature of the directory of the plugin is recorded.
+   */
+  void store(Plugin plugin);
+
+  /**
+   * Removes entries of the plugins which are not in the given list.
+   */
+  void retain(const std::vector<std::string> &files);
+
+  /**
+   * Computes a signature of the directory holding the given initialization
+   * file, using relative paths, sizes and modification times of all files in
+   * that directory and its subdirectories. Python bytecode caches are not
+   * included, as these are written when the plugin is loaded.
+   */
+  static int64_t signature(const std::string &file);
+
+ private:
+  std::string m_path;
+  std::map<std::string, Plugin> m_plugins;
+  bool m_modified = false;
+};
+
+/**
+ * Detects if anything was printed to the standard or error output while it
+ * exists, output is not consumed.
+ */
+class Output_detector final : public shcore::Interpreter_print_handler {
+ public:
+  Output_detector();
+
+  Output_detector(const Output_detector &) = delete;
+  Output_detector(Output_detector &&) = delete;
+
+  Output_detector &operator=(const Output_detector &) = delete;
+  Output_detector &operator=(Output_detector &&) = delete;
+
+  ~Output_detector() override;
+
+  bool detected() const { return m_detected; }
+
+ private:
+  static bool on_print(void *user_data, const char *text);
+
+  bool m_detected = false;
+};
+
+/**
+ * Lists the qualified names of the members of the given global extension
+ * object and of all its child objects.
+ *
+ * @returns empty list if value is not an extension object
+ */
+std::vector<std::string> extension_object_members(const std::string &name,
+                                                  const shcore::Value &value);
+
+/**
+ * Placeholder of a global object registered by a plugin which was not loaded
+ * yet. Plugin is loaded when the object is used for the first time, all
+ * operations are then forwarded to the object registered by the plugin.
+ */
+class Lazy_plugin_object : public shcore::Cpp_object_bridge {
+ public:
+  using Loader =
+      std::function<std::shared_ptr<shcore::Cpp_object_bridge>()>;
+
+  Lazy_plugin_object(std::string name, bool cli_enabled, Loader loader);
+
+  std::string class_name() const override;
+
+  bool cli_enabled() const { return m_cli_enabled; }
+
+  /**
+   * Loads the plugin (if needed).
+   *
+   * @returns the object registered by the plugin
+   */
+  const std::shared_ptr<shcore::Cpp_object_bridge> &object() const;
+
+  using shcore::Cpp_object_bridge::get_member;
+  using shcore::Cpp_object_bridge::set_member;
+
+  std::vector<std::string> get_members() const override;
+  shcore::Value get_member(const std::string &prop) const override;
+  bool has_member(const std::string &prop) const override;
+  void set_member(const std::string &prop, shcore::Value value) override;
+  bool has_method(const std::string &name) const override;
+  shcore::Value call(const std::string &name,
+                     const shcore::Argument_list &args) override;
+
+  shcore::Value get_member_advanced(const std::string &prop) const override;
+  bool has_member_advanced(const std::string &prop) const override;
+  void set_member_advanced(const std::string &prop,
+                           shcore::Value value) override;
+  bool has_method_advanced(const std::string &name) const override;
+  shcore::Value call_advanced(
+      const std::string &name, const shcore::Argument_list &args,
+      const shcore::Dictionary_t &kwargs = {}) override;
+
+  std::string &append_descr(std::string &s_out, int indent = -1,
+                            int quote_strings = 0) const override;
+  std::string &append_repr(std::string &s_out) const override;
+
+  std::string help(const std::string &item = {}) override;
+  std::string get_help_id() const override;
+
+ private:
+  std::string m_name;
+  bool m_cli_enabled;
+  Loader m_loader;
+  mutable std::shared_ptr<shcore::Cpp_object_bridge> m_object;
+};
+
+}  // namespace mysqlsh
+
+#endif  // SRC_MYSQLSH_LAZY_PLUGINS_H_
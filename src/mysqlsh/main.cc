@@ -24,11 +24,13 @@
 #include "modules/mod_utils.h"
 #include "modules/util/json_importer.h"
 #include "mysqlsh/cmdline_shell.h"
+#include "mysqlsh/daemon_shell.h"
 #include "mysqlsh/json_shell.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
 #include "mysqlshdk/include/shellcore/interrupt_helper.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/db/mysql/auth_plugins/fido.h"
+#include "mysqlshdk/libs/db/replay/workload.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
@@ -568,6 +570,9 @@ static std::shared_ptr<mysqlsh::Shell_options> process_args(int *argc,
 
   detect_interactive(shell_options.get(), &stdin_is_tty, &stdout_is_tty);
 
+  // daemon handles the requests in the same way as the --execute option
+  if (!options.daemon.empty()) shell_options->set_interactive(false);
+
   // If not a tty, then autocompletion can't be used, so we disable
   // name cache for autocompletion... but keep it for db object from DevAPI
   if (!options.db_name_cache_set &&
@@ -583,6 +588,18 @@ static std::shared_ptr<mysqlsh::Shell_options> process_args(int *argc,
   return shell_options;
 }
 
+// Returns the arguments of the command line operation (what follows '--').
+static std::vector<std::string> cli_operation_args(int argc, char **argv) {
+  std::vector<std::string> args;
+  int i = 1;
+
+  while (i < argc && strcmp(argv[i], "--") != 0) ++i;
+
+  for (++i; i < argc; ++i) args.emplace_back(argv[i]);
+
+  return args;
+}
+
 static void init_shell(std::shared_ptr<mysqlsh::Command_line_shell> shell) {
 #ifdef ENABLE_SESSION_RECORDING
   init_debug_shell(shell);
@@ -732,6 +749,17 @@ int main(int argc, char **argv) {
 
   mysqlsh::Scoped_shell_options scoped_shell_options(shell_options);
 
+  // the request is handled by the daemon, nothing needs to be initialized
+  if (!options.use_daemon.empty()) {
+    try {
+      return mysqlsh::forward_to_daemon(options,
+                                        cli_operation_args(argc, argv));
+    } catch (const std::exception &e) {
+      std::cerr << e.what() << std::endl;
+      return 1;
+    }
+  }
+
   std::shared_ptr<shcore::Logger> logger;
   try {
     // Setup logging
@@ -749,6 +777,18 @@ int main(int argc, char **argv) {
   mysqlsh::Scoped_log_sql log_sql(std::make_shared<shcore::Log_sql>());
   shcore::current_log_sql()->push("main");
 
+  if (!options.capture_workload.empty()) {
+    try {
+      mysqlshdk::db::replay::start_workload_capture(options.capture_workload);
+    } catch (const std::exception &e) {
+      fprintf(stderr, "%s\n", e.what());
+      exit(1);
+    }
+  }
+
+  shcore::Scoped_callback stop_capture(
+      []() { mysqlshdk::db::replay::stop_workload_capture(); });
+
   std::shared_ptr<mysqlsh::Command_line_shell> shell;
 #ifdef HAVE_PYTHON
   shcore::Scoped_callback cleanup([&shell] {
@@ -770,7 +810,11 @@ int main(int argc, char **argv) {
 
     // The Json_shell mode is enabled when this env variable is defined
     char *json_shell = getenv("MYSQLSH_JSON_SHELL");
-    if (json_shell) {
+    if (!options.daemon.empty()) {
+      // requests are not allowed to prompt
+      shell_options->set_wizards(false);
+      shell.reset(new mysqlsh::Daemon_shell(shell_options), finalize_shell);
+    } else if (json_shell) {
       // The variable needs to be remvoved in case AAPI sandbox operations are
       // executed, this is because the launched shell instance will also use the
       // variable, breaking the output parsing
@@ -842,6 +886,8 @@ int main(int argc, char **argv) {
 
       // Open the default shell session
       if (options.has_connection_data(true)) {
+        const auto profile_stage = shell->profile_startup_stage("connection");
+
         try {
           auto restore_print_on_error =
               shcore::Scoped_callback([shell]() { shell->restore_print(); });
@@ -911,6 +957,9 @@ int main(int argc, char **argv) {
       }
 
       try {
+        const auto profile_stage =
+            shell->profile_startup_stage("extra globals");
+
         // initialize globals requested via command line (i.e. --cluster,
         // --replicaset)
         shell->init_extra_globals();
@@ -921,6 +970,8 @@ int main(int argc, char **argv) {
 
       if (valid_color_capability) shell->load_prompt_theme(pick_prompt_theme());
 
+      shell->print_startup_profile();
+
       const auto shell_cli_operation = shell_options->get_shell_cli_operation();
 
       if (shell_cli_operation) {
@@ -957,6 +1008,9 @@ int main(int argc, char **argv) {
       } else if (!options.import_args.empty()) {
         ret_val = execute_import_command(shell.get(), options.import_args,
                                          options.import_opts);
+      } else if (!options.daemon.empty()) {
+        ret_val = std::static_pointer_cast<mysqlsh::Daemon_shell>(shell)->serve(
+            options.daemon);
       } else if (options.interactive) {
         shell->load_state();
 
@@ -571,6 +571,12 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
               : std::make_shared<mysqlsh::Shell_console>(custom_delegate)} {
   DEBUG_OBJ_ALLOC(Mysql_shell);
 
+  if (cmdline_options->get().startup_profile) {
+    m_startup_profile = std::make_unique<mysqlshdk::utils::Profile_timer>();
+  }
+
+  const auto profile_stage = profile_startup_stage("global objects");
+
   // Registers the interactive objects if required
   _global_shell = std::make_shared<mysqlsh::Shell>(this);
   _global_js_sys = std::make_shared<mysqlsh::Sys>(_shell.get());
@@ -707,11 +713,21 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
 Mysql_shell::~Mysql_shell() { DEBUG_OBJ_DEALLOC(Mysql_shell); }
 
 void Mysql_shell::finish_init() {
-  // Python needs to be initialized in case there are python start files/plugins
-  // but we do this only once for the whole application.
-  if (mysqlshdk::utils::in_main_thread()) shell_context()->init_py();
+  {
+    const auto profile_stage = profile_startup_stage("interpreters");
+
+    // Python needs to be initialized in case there are python start
+    // files/plugins but we do this only once for the whole application.
+    // Non-interactive sessions initialize it on demand, when a Python file is
+    // loaded or Python code is executed.
+    if (mysqlshdk::utils::in_main_thread() &&
+        (options().interactive ||
+         shcore::IShell_core::Mode::Python == options().initial_mode)) {
+      shell_context()->init_py();
+    }
 
-  Base_shell::finish_init();
+    Base_shell::finish_init();
+  }
 
   // if Python is disabled it means we're creating another instance of shell in
   // a thread. because of that we don't want to initialize everything again for
@@ -719,73 +735,92 @@ void Mysql_shell::finish_init() {
   // Also the shell_cli_operation is not needed as context won't need that.
 
   if (mysqlshdk::utils::in_main_thread()) {
-    File_list startup_files;
-    get_startup_scripts(&startup_files);
-    load_files(startup_files, "startup files");
+    {
+      const auto profile_stage = profile_startup_stage("startup scripts");
+
+      File_list startup_files;
+      get_startup_scripts(&startup_files);
+      load_files(startup_files, "startup files");
+    }
+
+    {
+      const auto profile_stage = profile_startup_stage("plugins");
 
-    File_list plugins;
-    get_plugins(&plugins);
-    load_files(plugins, "plugins");
+      File_list plugins;
+      get_plugins(&plugins);
+      load_plugins(plugins);
+    }
 
     auto shell_cli_operation = m_shell_options.get()->get_shell_cli_operation();
     if (shell_cli_operation) {
-      auto providers = shell_cli_operation->get_provider();
-
-      providers->register_provider("dba", _global_dba);
-      providers->register_provider("cluster", [this](bool for_help) {
-        return create_default_cluster_object(for_help);
-      });
-      providers->register_provider("rs", [this](bool for_help) {
-        return create_default_replicaset_object(for_help);
-      });
-      providers->register_provider("clusterset", [this](bool for_help) {
-        return create_default_clusterset_object(for_help);
-      });
-
-      auto shell_provider =
-          providers->register_provider("shell", _global_shell);
-      shell_provider->register_provider("options",
-                                        _global_shell->get_shell_options());
-
-      // Callback to recursively register CLI enabled plugin objects
-      std::function<void(shcore::cli::Provider * parent,
-                         const std::shared_ptr<Extensible_object> &)>
-          register_providers;
-
-      register_providers =
-          [&register_providers](
-              shcore::cli::Provider *parent,
-              const std::shared_ptr<Extensible_object> &object) {
-            // If the object is CLI enabled, registers it as a provider
-            if (object->cli_enabled()) {
-              auto new_provider =
-                  parent->register_provider(object->get_name(), object);
-
-              // Iterates over the object childrens to register CLI enabled
-              // objects recursively
-              auto child_names = object->get_members();
-              for (const auto &name : child_names) {
-                auto child = object->get_member(name);
-                if (child.get_type() == shcore::Value_type::Object) {
-                  auto child_object = child.as_object<Extensible_object>();
-
-                  if (child_object) {
-                    register_providers(new_provider.get(), child_object);
-                  }
-                }
-              }
-            }
-          };
-
-      // Iterates over the global extensible objects to register anything that
-      // is CLI enabled as a provider
-      auto global_object_names = _shell->get_all_globals();
-      for (const auto &name : global_object_names) {
-        auto extension_object =
-            _shell->get_global(name).as_object<Extensible_object>();
-        if (extension_object) register_providers(providers, extension_object);
+      const auto profile_stage = profile_startup_stage("cli providers");
+      register_cli_providers(shell_cli_operation->get_provider());
+    }
+  }
+}
+
+void Mysql_shell::register_cli_providers(shcore::cli::Provider *providers) {
+  providers->register_provider("dba", _global_dba);
+  providers->register_provider("cluster", [this](bool for_help) {
+    return create_default_cluster_object(for_help);
+  });
+  providers->register_provider("rs", [this](bool for_help) {
+    return create_default_replicaset_object(for_help);
+  });
+  providers->register_provider("clusterset", [this](bool for_help) {
+    return create_default_clusterset_object(for_help);
+  });
+
+  auto shell_provider = providers->register_provider("shell", _global_shell);
+  shell_provider->register_provider("options",
+                                    _global_shell->get_shell_options());
+
+  // Callback to recursively register CLI enabled plugin objects
+  std::function<void(shcore::cli::Provider * parent,
+                     const std::shared_ptr<Extensible_object> &)>
+      register_providers;
+
+  register_providers = [&register_providers](
+                           shcore::cli::Provider *parent,
+                           const std::shared_ptr<Extensible_object> &object) {
+    // If the object is CLI enabled, registers it as a provider
+    if (object->cli_enabled()) {
+      auto new_provider = parent->register_provider(object->get_name(), object);
+
+      // Iterates over the object childrens to register CLI enabled
+      // objects recursively
+      auto child_names = object->get_members();
+      for (const auto &name : child_names) {
+        auto child = object->get_member(name);
+        if (child.get_type() == shcore::Value_type::Object) {
+          auto child_object = child.as_object<Extensible_object>();
+
+          if (child_object) {
+            register_providers(new_provider.get(), child_object);
+          }
+        }
       }
     }
+  };
+
+  // Iterates over the global extensible objects to register anything that
+  // is CLI enabled as a provider
+  auto global_object_names = _shell->get_all_globals();
+  for (const auto &name : global_object_names) {
+    auto global = _shell->get_global(name);
+
+    if (shcore::Object != global.get_type()) continue;
+
+    if (const auto lazy = global.as_object<Lazy_plugin_object>()) {
+      // plugins which do not provide CLI enabled objects stay unloaded
+      if (!lazy->cli_enabled()) continue;
+
+      lazy->object();
+      global = _shell->get_global(name);
+    }
+
+    auto extension_object = global.as_object<Extensible_object>();
+    if (extension_object) register_providers(providers, extension_object);
   }
 }
 
@@ -816,6 +851,220 @@ void Mysql_shell::load_files(const File_list &file_list,
   }
 }
 
+void Mysql_shell::load_plugins(const File_list &file_list) {
+  Plugin_manifest manifest{shcore::path::join_path(
+      shcore::get_user_config_path(), "plugin_manifest.json")};
+  manifest.load();
+
+  // placeholders are not used in interactive sessions, these need the help and
+  // auto-completion of all the objects registered by plugins
+  const bool allow_lazy = !options().interactive;
+  bool load_failed = false;
+  std::vector<std::string> files;
+
+  log_info("Loading plugins...");
+  for (const auto &files_to_load : file_list) {
+    const auto mode = files_to_load.first;
+
+    for (const auto &plugin : files_to_load.second) {
+      log_debug("- %s", plugin.file.c_str());
+      files.emplace_back(plugin.file);
+
+      const auto entry = allow_lazy ? manifest.find(plugin.file) : nullptr;
+
+      if (entry && entry->lazy()) {
+        register_lazy_plugin(mode, plugin, *entry);
+        continue;
+      }
+
+      // plugin can use objects registered by any of the plugins loaded before
+      if (!m_lazy_plugins.empty()) load_lazy_plugins(m_lazy_plugins.size() - 1);
+
+      const auto stage_name =
+          "plugin " +
+          shcore::path::basename(shcore::path::dirname(plugin.file));
+      const auto profile_stage = profile_startup_stage(stage_name.c_str());
+
+      if (!load_plugin(mode, plugin, &manifest)) {
+        load_failed = true;
+      }
+    }
+  }
+
+  manifest.retain(files);
+
+  try {
+    manifest.save();
+  } catch (const std::exception &e) {
+    log_warning("Failed to write the plugin manifest: %s", e.what());
+  }
+
+  if (load_failed) {
+    auto msg = shcore::str_format(
+        "Found errors loading plugins, for more details look at the log at: %s",
+        shcore::current_logger()->logfile_name().c_str());
+    current_console()->print_warning(msg);
+  }
+}
+
+bool Mysql_shell::load_plugin(shcore::IShell_core::Mode mode,
+                              const shcore::Plugin_definition &plugin,
+                              Plugin_manifest *manifest) {
+  const auto reports = _global_shell->get_shell_reports();
+  const auto globals_before = _shell->get_all_globals();
+  const auto reports_before = reports->list_reports();
+
+  // members of the objects registered before this plugin, a plugin which
+  // extends them is not loaded lazily
+  const auto existing_members = [this, &globals_before]() {
+    std::vector<std::string> members;
+
+    for (const auto &name : globals_before) {
+      auto object_members =
+          extension_object_members(name, _shell->get_global(name));
+      std::move(object_members.begin(), object_members.end(),
+                std::back_inserter(members));
+    }
+
+    return members;
+  };
+  const auto members_before = existing_members();
+  bool printed = false;
+
+  {
+    Output_detector output;
+
+    if (!_shell->load_plugin(mode, plugin)) {
+      // don't cache anything about a plugin which failed to load
+      return false;
+    }
+
+    printed = output.detected();
+  }
+
+  Plugin_manifest::Plugin entry;
+  entry.file = plugin.file;
+  entry.side_effects = printed || existing_members() != members_before;
+
+  for (const auto &name : _shell->get_all_globals()) {
+    if (std::find(globals_before.begin(), globals_before.end(), name) ==
+        globals_before.end()) {
+      entry.globals.emplace_back(name);
+
+      const auto global = _shell->get_global(name);
+
+      if (shcore::Object == global.get_type()) {
+        const auto object = global.as_object<Extensible_object>();
+
+        if (object && object->cli_enabled()) {
+          entry.cli_globals.emplace_back(name);
+        }
+      }
+    }
+  }
+
+  for (const auto &name : reports->list_reports()) {
+    if (std::find(reports_before.begin(), reports_before.end(), name) ==
+        reports_before.end()) {
+      entry.reports.emplace_back(name);
+    }
+  }
+
+  manifest->store(std::move(entry));
+
+  return true;
+}
+
+void Mysql_shell::register_lazy_plugin(shcore::IShell_core::Mode mode,
+                                       const shcore::Plugin_definition &plugin,
+                                       const Plugin_manifest::Plugin &entry) {
+  log_debug("Deferring load of the plugin '%s'", plugin.file.c_str());
+
+  const auto index = m_lazy_plugins.size();
+  m_lazy_plugins.emplace_back(Lazy_plugin{mode, plugin, entry.globals});
+
+  for (const auto &name : entry.globals) {
+    const bool cli_enabled =
+        std::find(entry.cli_globals.begin(), entry.cli_globals.end(), name) !=
+        entry.cli_globals.end();
+
+    Lazy_plugin_object::Loader loader =
+        [this, index, name]() -> std::shared_ptr<shcore::Cpp_object_bridge> {
+      load_lazy_plugins(index);
+
+      const auto global = _shell->get_global(name);
+
+      // plugin did not register this object this time
+      if (shcore::Object != global.get_type() ||
+          global.as_object<Lazy_plugin_object>()) {
+        return nullptr;
+      }
+
+      return global.as_object<shcore::Cpp_object_bridge>();
+    };
+
+    std::shared_ptr<shcore::Object_bridge> placeholder =
+        std::make_shared<Lazy_plugin_object>(name, cli_enabled,
+                                             std::move(loader));
+
+    _shell->set_global(name, shcore::Value(std::move(placeholder)),
+                       shcore::IShell_core::all_scripting_modes());
+  }
+}
+
+void Mysql_shell::load_lazy_plugins(std::size_t last) {
+  // plugins are loaded in the original order, a plugin can use objects
+  // registered by the plugins found before it
+  for (std::size_t i = 0; i <= last && i < m_lazy_plugins.size(); ++i) {
+    auto &lazy = m_lazy_plugins[i];
+
+    if (lazy.loaded) continue;
+
+    lazy.loaded = true;
+
+    log_debug("Loading deferred plugin '%s'", lazy.plugin.file.c_str());
+
+    for (const auto &name : lazy.globals) {
+      _shell->remove_global(name);
+    }
+
+    if (!_shell->load_plugin(lazy.mode, lazy.plugin)) {
+      current_console()->print_warning(shcore::str_format(
+          "Found errors loading plugin '%s', for more details look at the log "
+          "at: %s",
+          lazy.plugin.file.c_str(),
+          shcore::current_logger()->logfile_name().c_str()));
+    }
+  }
+}
+
+shcore::on_leave_scope Mysql_shell::profile_startup_stage(const char *note) {
+  if (!m_startup_profile) return {};
+
+  m_startup_profile->stage_begin(note);
+
+  return shcore::on_leave_scope(
+      [profile = m_startup_profile.get()]() { profile->stage_end(); });
+}
+
+void Mysql_shell::print_startup_profile() const {
+  if (!m_startup_profile) return;
+
+  std::string report = "Startup profile (ms):\n";
+
+  for (const auto &point : m_startup_profile->trace_points()) {
+    report += shcore::str_format("%10.3f  %s%s\n",
+                                 point.milliseconds_elapsed(),
+                                 std::string(2 * point.depth, ' ').c_str(),
+                                 point.note);
+  }
+
+  report += shcore::str_format("%10.3f  total\n",
+                               m_startup_profile->total_milliseconds_elapsed());
+
+  current_console()->print_diag(report);
+}
+
 void Mysql_shell::get_startup_scripts(File_list *file_list) {
   std::string dir =
       shcore::path::join_path(shcore::get_user_config_path(), "init.d");
@@ -33,10 +33,13 @@
 #include "modules/mod_sys.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/ssh/ssh_manager.h"
+#include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "scripting/types.h"
 #include "shellcore/base_shell.h"
 #include "shellcore/shell_core.h"
 #include "shellcore/shell_options.h"
+#include "src/mysqlsh/lazy_plugins.h"
 
 namespace mysqlsh {
 class Shell;  // from modules
@@ -87,6 +90,18 @@ class Mysql_shell : public mysqlsh::Base_shell {
                              std::vector<shcore::Plugin_definition>>;
   void load_files(const File_list &file_list, const std::string &context);
 
+  /**
+   * Loads the plugins, recording the objects they register in the plugin
+   * manifest.
+   *
+   * In non-interactive sessions, plugins which according to the manifest only
+   * register global objects (do not register reports, print anything or
+   * extend objects registered before them) are not loaded, placeholders are
+   * registered instead and the plugin is loaded when one of them is used for
+   * the first time.
+   */
+  void load_plugins(const File_list &file_list);
+
   /**
    * Gets all the startup files for the supported scripting languages at:
    *
@@ -107,10 +122,29 @@ class Mysql_shell : public mysqlsh::Base_shell {
                    bool allow_recursive);
   void finish_init() override;
 
+  /**
+   * Registers the global objects which can be called from the command line
+   * (including the CLI enabled plugin objects) in the given provider.
+   */
+  void register_cli_providers(shcore::cli::Provider *providers);
+
   void init_extra_globals();
 
   std::shared_ptr<mysqlsh::Shell> get_shell() const { return _global_shell; }
 
+  /**
+   * Marks the beginning of the given initialization stage, the stage ends when
+   * the returned object goes out of scope. No-op if --startup-profile was not
+   * given.
+   */
+  shcore::on_leave_scope profile_startup_stage(const char *note);
+
+  /**
+   * Prints the time spent in each of the initialization stages, if
+   * --startup-profile was given.
+   */
+  void print_startup_profile() const;
+
  protected:
   static void set_sql_safe_for_logging(const std::string &patterns);
 
@@ -153,6 +187,27 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   virtual void toggle_print() {}
 
+  struct Lazy_plugin {
+    shcore::IShell_core::Mode mode;
+    shcore::Plugin_definition plugin;
+    std::vector<std::string> globals;
+    bool loaded = false;
+  };
+
+  bool load_plugin(shcore::IShell_core::Mode mode,
+                   const shcore::Plugin_definition &plugin,
+                   Plugin_manifest *manifest);
+
+  void register_lazy_plugin(shcore::IShell_core::Mode mode,
+                            const shcore::Plugin_definition &plugin,
+                            const Plugin_manifest::Plugin &entry);
+
+  void load_lazy_plugins(std::size_t last);
+
+  std::unique_ptr<mysqlshdk::utils::Profile_timer> m_startup_profile;
+  // plugins which were not loaded yet, in the order in which they were found
+  std::vector<Lazy_plugin> m_lazy_plugins;
+
 #ifdef FRIEND_TEST
   FRIEND_TEST(Cmdline_shell, check_password_history_linenoise);
   FRIEND_TEST(Cmdline_shell, check_history_overflow_del);
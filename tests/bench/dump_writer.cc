@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "modules/util/dump/text_dump_writer.h"
+
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using mysqlsh::dump::Dump_writer;
+using mysqlsh::import_table::Dialect;
+using mysqlshdk::db::Column;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+namespace {
+
+// rows are written in batches, output file is cleared after each batch
+constexpr std::size_t k_batch_size = 1000;
+
+/**
+ * Caches the raw data, so that benchmark measures the writers and not the
+ * conversion of values to strings.
+ */
+class Raw_row : public Mutable_row {
+ public:
+  explicit Raw_row(const std::vector<Type> &types) : Mutable_row(types) {}
+
+  void cache_raw_data() {
+    for (uint32_t i = 0; i < num_fields(); ++i) {
+      const char *data = nullptr;
+      std::size_t length = 0;
+      Mutable_row::get_raw_data(i, &data, &length);
+      m_raw_data.emplace_back(data, length);
+    }
+  }
+
+  void get_raw_data(uint32_t index, const char **out_data,
+                    size_t *out_size) const override {
+    *out_data = m_raw_data[index].data();
+    *out_size = m_raw_data[index].length();
+  }
+
+ private:
+  std::vector<std::string> m_raw_data;
+};
+
+struct Table {
+  std::string name;
+  std::vector<Column> columns;
+  std::vector<std::unique_ptr<Raw_row>> rows;
+};
+
+Table generate_table(const std::string &name, std::size_t num_columns) {
+  const Type types[] = {Type::Integer, Type::String, Type::Double,
+                        Type::String};
+  Table table;
+  table.name = name;
+
+  std::vector<Type> row_types;
+
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    const auto type = types[i % shcore::array_size(types)];
+    const auto column_name = "c" + std::to_string(i);
+
+    row_types.emplace_back(type);
+    table.columns.emplace_back("def", "schema", name, name, column_name,
+                               column_name, 0, 0, type, 63, false, false,
+                               false);
+  }
+
+  for (std::size_t r = 0; r < k_batch_size; ++r) {
+    auto row = std::make_unique<Raw_row>(row_types);
+
+    for (std::size_t i = 0; i < num_columns; ++i) {
+      switch (row_types[i]) {
+        case Type::Integer:
+          row->set_field(i, static_cast<int64_t>(r * num_columns + i));
+          break;
+
+        case Type::Double:
+          row->set_field(i, r / 7.0);
+          break;
+
+        default:
+          // every tenth value contains characters which need to be escaped
+          row->set_field(i, std::string("some text value of row ") +
+                                std::to_string(r) +
+                                (0 == r % 10 ? ", \"quoted\"\ttab\n" : ""));
+          break;
+      }
+    }
+
+    row->cache_raw_data();
+    table.rows.emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+void bench(const std::string &name, const Table &table, std::size_t batches,
+           const std::function<std::unique_ptr<Dump_writer>()> &create) {
+  mysqlshdk::storage::backend::Memory_file file{"bench"};
+  file.open(mysqlshdk::storage::Mode::WRITE);
+
+  const auto writer = create();
+  writer->set_output_file(&file);
+  writer->open();
+  writer->write_preamble(table.columns);
+
+  std::size_t bytes = 0;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (std::size_t b = 0; b < batches; ++b) {
+    for (const auto &row : table.rows) {
+      bytes += writer->write_row(row.get()).bytes_written();
+    }
+
+    file.set_content({});
+    file.seek(0);
+  }
+
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto t_int_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start)
+          .count();
+
+  writer->write_postamble();
+  writer->close();
+
+  std::cout << "# " << table.name << ", " << name << ": "
+            << batches * k_batch_size << " rows, " << bytes << " bytes @ "
+            << t_int_us / 1000.0 << "ms, "
+            << (t_int_us ? bytes / static_cast<double>(t_int_us) : 0)
+            << " Mbytes/s\n";
+}
+
+void bench(const std::string &name, const Dialect &dialect,
+           const std::function<std::unique_ptr<Dump_writer>()> &predefined,
+           const std::vector<const Table *> &tables, std::size_t batches) {
+  for (const auto table : tables) {
+    bench(name + " generic", *table, batches, [&dialect]() {
+      return std::make_unique<mysqlsh::dump::Text_dump_writer>(dialect);
+    });
+
+    bench(name + " specialized", *table, batches, [&dialect]() {
+      return mysqlsh::dump::create_custom_dialect_dump_writer(dialect);
+    });
+
+    if (predefined) {
+      bench(name + " predefined", *table, batches, predefined);
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  // number of batches written to the output, each batch holds 1000 rows
+  const std::size_t batches = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+  const auto narrow = generate_table("narrow", 4);
+  const auto wide = generate_table("wide", 64);
+  const std::vector<const Table *> tables = {&narrow, &wide};
+
+  bench("default", Dialect::default_(),
+        []() { return std::make_unique<mysqlsh::dump::Default_dump_writer>(); },
+        tables, batches);
+  bench("csv", Dialect::csv(),
+        []() { return std::make_unique<mysqlsh::dump::Csv_dump_writer>(); },
+        tables, batches);
+
+  Dialect pipe;
+  pipe.fields_terminated_by = "|";
+  pipe.fields_enclosed_by = "'";
+  pipe.fields_optionally_enclosed = true;
+  bench("custom (|, enclosed by ', escaped by \\)", pipe, {}, tables,
+        batches);
+
+  Dialect no_escape;
+  no_escape.fields_terminated_by = ";";
+  no_escape.fields_escaped_by = "";
+  no_escape.lines_terminated_by = "\r\n";
+  bench("custom (;, not escaped)", no_escape, {}, tables, batches);
+}
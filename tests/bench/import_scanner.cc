@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/character_set.h"
+#include "modules/util/import_table/scanner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using mysqlsh::import_table::Character_set;
+using mysqlsh::import_table::Dialect;
+using mysqlsh::import_table::Scanner;
+
+namespace {
+
+constexpr std::size_t k_block_size = 64 * 1024;
+
+std::string generate_data(std::size_t size, const Dialect &dialect) {
+  const auto &ft = dialect.fields_terminated_by;
+  const auto &enc = dialect.fields_enclosed_by;
+  const auto row = "12345" + ft + enc + "some longer text value" + enc + ft +
+                   "2023-01-01 12:00:00" + ft + enc + "escaped \\" + enc +
+                   " value" + enc + ft + "3.14159" +
+                   dialect.lines_terminated_by;
+  std::string data;
+
+  data.reserve(size + row.length());
+
+  while (data.length() < size) {
+    data += row;
+  }
+
+  return data;
+}
+
+template <typename F>
+void measure(const std::string &name, const std::string &data, F &&f) {
+  const auto t_start = std::chrono::steady_clock::now();
+  const auto result = f();
+  const auto t_end = std::chrono::steady_clock::now();
+  const auto t_int_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start)
+          .count();
+
+  std::cout << "# " << name << ": " << data.length() << " bytes @ "
+            << t_int_us / 1000.0 << "ms, "
+            << (t_int_us ? data.length() / static_cast<double>(t_int_us) : 0)
+            << " Mbytes/s (" << result << ")\n";
+}
+
+void bench(const std::string &name, const Dialect &dialect, std::size_t size) {
+  const auto data = generate_data(size, dialect);
+
+  measure(name + " scanner", data, [&]() {
+    Scanner scanner{dialect, 0};
+    std::size_t rows = 0;
+
+    for (std::size_t offset = 0; offset < data.length();
+         offset += k_block_size) {
+      rows += scanner.scan(data.c_str() + offset,
+                           std::min(k_block_size, data.length() - offset)) >= 0;
+    }
+
+    return rows;
+  });
+
+  const Character_set chars{dialect.fields_escaped_by +
+                            dialect.fields_enclosed_by +
+                            dialect.fields_terminated_by.substr(0, 1) +
+                            dialect.lines_terminated_by.substr(0, 1)};
+
+  const auto count = [&](auto find) {
+    std::size_t found = 0;
+    std::size_t offset = 0;
+
+    while (offset < data.length()) {
+      offset += (chars.*find)(data.c_str() + offset, data.length() - offset);
+      offset += 1;
+      ++found;
+    }
+
+    return found;
+  };
+
+  measure(name + " find_first_of", data,
+          [&]() { return count(&Character_set::find_first_of); });
+  measure(name + " find_first_of_scalar", data,
+          [&]() { return count(&Character_set::find_first_of_scalar); });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  // size of the generated data in MB
+  const std::size_t size = (argc > 1 ? std::atoi(argv[1]) : 256) * 1024 * 1024;
+
+  bench("default", Dialect::default_(), size);
+  bench("csv", Dialect::csv(), size);
+  bench("tsv", Dialect::tsv(), size);
+  bench("csv-unix", Dialect::csv_unix(), size);
+}
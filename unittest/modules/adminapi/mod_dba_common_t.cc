@@ -1958,4 +1958,121 @@ TEST_F(Dba_common_test, set_wait_recovery) {
   EXPECT_EQ(options.get_wait_recovery(),
             mysqlsh::dba::Recovery_progress_style::PROGRESSBAR);
 }
+
+TEST_F(Dba_common_test, instance_query_batch_fallback) {
+  using mysqlshdk::db::Type;
+
+  // sessions which are not connected through the classic protocol execute
+  // the queries one by one
+  std::shared_ptr<Mock_session> mock_session = std::make_shared<Mock_session>();
+  mysqlsh::dba::Instance instance{mock_session};
+
+  mock_session->expect_query("SELECT 1")
+      .then_return({{"", {"a"}, {Type::Integer}, {{"1"}}}});
+  mock_session->expect_query("SELECT 2")
+      .then_return({{"", {"b"}, {Type::Integer}, {{"2"}}}});
+
+  std::vector<std::string> values;
+
+  instance.query_batch({"SELECT 1", "SELECT 2"},
+                       [&values](std::size_t index,
+                                 mysqlshdk::db::IResult *result) {
+                         auto row = result->fetch_one();
+                         ASSERT_NE(nullptr, row);
+                         values.emplace_back(std::to_string(index) + ":" +
+                                             row->get_as_string(0));
+                       });
+
+  EXPECT_EQ((std::vector<std::string>{"0:1", "1:2"}), values);
+
+  mock_session->expect_query("SELECT 3")
+      .then_return({{"", {"c"}, {Type::Integer}, {{"3"}}}});
+
+  auto result = instance.query_prepared("SELECT 3");
+  auto row = result->fetch_one();
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ("3", row->get_as_string(0));
+}
+
+TEST_F(Dba_common_test, instance_query_batch) {
+  testutil->deploy_sandbox(_mysql_sandbox_ports[0], "root");
+  auto instance = create_session(_mysql_sandbox_ports[0]);
+
+  std::vector<std::string> warnings;
+  instance->register_warnings_callback(
+      [&warnings](const std::string &sql, int code, const std::string &level,
+                  const std::string &) {
+        warnings.emplace_back(sql + ":" + std::to_string(code) + ":" + level);
+      });
+
+  std::vector<std::string> values;
+  const auto handler = [&values](std::size_t index,
+                                 mysqlshdk::db::IResult *result) {
+    auto row = result->fetch_one();
+    ASSERT_NE(nullptr, row);
+    values.emplace_back(std::to_string(index) + ":" + row->get_as_string(0));
+  };
+
+  // results are returned in order, warnings of all the queries are reported
+  instance->query_batch({"SELECT CAST('1a' AS SIGNED)", "SELECT 2",
+                         "SELECT CAST('3b' AS SIGNED)"},
+                        handler);
+
+  EXPECT_EQ((std::vector<std::string>{"0:1", "1:2", "2:3"}), values);
+  EXPECT_EQ((std::vector<std::string>{
+                "SELECT CAST('3b' AS SIGNED):1292:WARNING",
+                "SELECT CAST('1a' AS SIGNED):1292:WARNING"}),
+            warnings);
+
+  // multi-statements are disabled once the batch is done
+  EXPECT_THROW(instance->query("SELECT 1; SELECT 2"), mysqlshdk::db::Error);
+  EXPECT_EQ(1, instance->queryf_one_int(0, 0, "SELECT 1"));
+
+  // error in the batch does not leave multi-statements enabled
+  values.clear();
+  EXPECT_THROW(
+      instance->query_batch({"SELECT 1", "SELECT * FROM invalid.invalid"},
+                            handler),
+      mysqlshdk::db::Error);
+  EXPECT_EQ((std::vector<std::string>{"0:1"}), values);
+  EXPECT_THROW(instance->query("SELECT 1; SELECT 2"), mysqlshdk::db::Error);
+
+  // exception thrown by the handler discards the remaining results
+  EXPECT_THROW(instance->query_batch(
+                   {"SELECT 1", "SELECT 2", "SELECT 3"},
+                   [](std::size_t, mysqlshdk::db::IResult *) {
+                     throw std::runtime_error("handler failed");
+                   }),
+               std::runtime_error);
+  EXPECT_EQ(1, instance->queryf_one_int(0, 0, "SELECT 1"));
+  EXPECT_THROW(instance->query("SELECT 1; SELECT 2"), mysqlshdk::db::Error);
+
+  // statement is prepared once and executed many times
+  const auto prepared = [&instance]() {
+    return std::stoll(instance->queryf_one_string(
+        1, "", "SHOW SESSION STATUS LIKE 'Com_prepare_sql'"));
+  };
+  const auto before = prepared();
+
+  for (int i = 0; i < 3; ++i) {
+    auto result = instance->query_prepared("SELECT 4");
+    auto row = result->fetch_one();
+    ASSERT_NE(nullptr, row);
+    EXPECT_EQ("4", row->get_as_string(0));
+  }
+
+  EXPECT_EQ(before + 1, prepared());
+
+  // statements deallocated by the server are prepared again
+  instance->execute("DEALLOCATE PREPARE mysqlsh_stmt_1");
+  {
+    auto result = instance->query_prepared("SELECT 4");
+    auto row = result->fetch_one();
+    ASSERT_NE(nullptr, row);
+    EXPECT_EQ("4", row->get_as_string(0));
+  }
+
+  instance.reset();
+  testutil->destroy_sandbox(_mysql_sandbox_ports[0]);
+}
 }  // namespace testing
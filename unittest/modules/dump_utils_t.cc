@@ -114,6 +114,17 @@ TEST(Dump_utils, encode_table_data_filename_chunks) {
                                     "csv", 4, true));
 }
 
+TEST(Dump_utils, ddl_filename) {
+  EXPECT_EQ("@.ddl.0123456789abcdef.sql",
+            get_ddl_filename("0123456789abcdef"));
+
+  EXPECT_TRUE(is_ddl_filename(get_ddl_filename("0123456789abcdef")));
+  EXPECT_FALSE(is_ddl_filename("@.sql"));
+  EXPECT_FALSE(is_ddl_filename("@.users.sql"));
+  EXPECT_FALSE(
+      is_ddl_filename(get_table_filename(encode_table_basename("ddl", "t"))));
+}
+
 }  // namespace common
 }  // namespace dump
 
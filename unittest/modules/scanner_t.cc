@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -60,7 +61,7 @@ void test_scanner(const std::string &data,
   for (auto skip : skip_rows) {
     SCOPED_TRACE("skip: " + std::to_string(skip));
 
-    for (std::size_t length = 1; length < 5; ++length) {
+    for (const std::size_t length : {1, 2, 3, 4, 16, 17, 64}) {
       SCOPED_TRACE("length: " + std::to_string(length));
 
       Scanner s{dialect, skip};
@@ -196,6 +197,61 @@ TEST(Scanner, rows) {
   }
 }
 
+TEST(Scanner, long_fields) {
+  const std::string text(40, 'x');
+  const std::string row = "'" + text + "',\\" + text + ",'" + text + "\r\n" +
+                          text + "'," + text + "'\r\n";
+
+  Dialect dialect;
+  dialect.fields_enclosed_by = "'";
+  dialect.fields_escaped_by = "\\";
+  dialect.fields_terminated_by = ",";
+  dialect.lines_terminated_by = "\r\n";
+
+  // rows contain enclosed LINES TERMINATED BY sequences, these are not handled
+  // when skipping rows
+  test_scanner(row + row + row, {row.length(), row.length(), row.length()},
+               dialect, {0});
+}
+
+TEST(Character_set, find_first_of) {
+  EXPECT_THROW(Character_set("abcde"), std::invalid_argument);
+  EXPECT_NO_THROW(Character_set("abcdabcd"));
+
+  const std::string data = std::string(100, 'x') + "\t" + std::string(20, 'y') +
+                           "\\" + std::string(3, 'z') + "\xff";
+
+  {
+    Character_set chars{""};
+    EXPECT_FALSE(chars.contains('x'));
+    EXPECT_EQ(data.length(), chars.find_first_of(data.c_str(), data.length()));
+  }
+
+  for (const auto &set : {"\t", "\\\t", "\t\n\\\""}) {
+    SCOPED_TRACE(set);
+    Character_set chars{set};
+
+    EXPECT_TRUE(chars.contains('\t'));
+    EXPECT_FALSE(chars.contains('x'));
+
+    for (std::size_t offset = 0; offset <= data.length(); ++offset) {
+      const auto ptr = data.c_str() + offset;
+      const auto length = data.length() - offset;
+      const auto expected =
+          std::min(data.find_first_of(set, offset), data.length()) - offset;
+
+      EXPECT_EQ(expected, chars.find_first_of(ptr, length));
+      EXPECT_EQ(expected, chars.find_first_of_scalar(ptr, length));
+    }
+  }
+
+  {
+    Character_set chars{"\xff"};
+    EXPECT_EQ(data.length() - 1,
+              chars.find_first_of(data.c_str(), data.length()));
+  }
+}
+
 }  // namespace
 }  // namespace import_table
 }  // namespace mysqlsh
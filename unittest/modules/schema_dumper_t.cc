@@ -392,6 +392,36 @@ DELIMITER ;
   wipe_all();
 }
 
+TEST_F(Schema_dumper_test, restore_session_state) {
+  const auto character_set_results = [this]() {
+    return session->query("SELECT @@character_set_results")
+        ->fetch_one()
+        ->get_string(0);
+  };
+
+  session->execute("SET SESSION character_set_results = utf8mb4");
+
+  {
+    Schema_dumper sd(session);
+
+    // the same dumper can be used to dump multiple objects
+    EXPECT_NO_THROW(sd.dump_table_ddl(file.get(), db_name, "at1"));
+    EXPECT_NO_THROW(sd.dump_triggers_for_table_ddl(file.get(), db_name, "t1"));
+    EXPECT_NO_THROW(sd.dump_table_ddl(file.get(), db_name, "t1"));
+    EXPECT_TRUE(output_handler.std_err.empty());
+
+    sd.restore_session_state();
+    EXPECT_EQ("utf8mb4", character_set_results());
+
+    EXPECT_NO_THROW(sd.dump_table_ddl(file.get(), db_name, "at1"));
+  }
+
+  // state is also restored when dumper is destroyed
+  EXPECT_EQ("utf8mb4", character_set_results());
+
+  wipe_all();
+}
+
 TEST_F(Schema_dumper_test, dump_schema) {
   Schema_dumper sd(session);
   sd.opt_mysqlaas = true;
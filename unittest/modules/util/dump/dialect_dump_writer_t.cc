@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dialect_dump_writer.h"
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+#include "modules/util/dump/text_dump_writer.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+using mysqlshdk::db::Column;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+using Encoding_type = Dump_writer::Encoding_type;
+
+Column column(const std::string &name, Type type) {
+  return Column("def", "schema", "table", "table", name, name, 0, 0, type, 63,
+                false, false, Type::Bytes == type);
+}
+
+class Dialect_dump_writer_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const std::vector<Type> types = {Type::Integer, Type::String, Type::Bytes,
+                                     Type::Bytes, Type::Double};
+
+    for (const auto type : types) {
+      m_columns.emplace_back(column("c" + std::to_string(m_columns.size()),
+                                    type));
+    }
+
+    m_encoding = {Encoding_type::NONE, Encoding_type::NONE,
+                  Encoding_type::BASE64, Encoding_type::HEX,
+                  Encoding_type::NONE};
+
+    const char k_special[] = "a,b\t\"c\n\r\\d$e\0f\x1Ag|n||ab>>";
+    const std::string special{k_special, sizeof(k_special) - 1};
+
+    m_rows.emplace_back(
+        std::make_unique<Mutable_row>(types, -1, "text", "binary", "hex", 1.5));
+    m_rows.emplace_back(std::make_unique<Mutable_row>(types, 12345, special,
+                                                      special, special, 0.25));
+    m_rows.emplace_back(
+        std::make_unique<Mutable_row>(types, 0, "", "", "", -2.0));
+    m_rows.emplace_back(std::make_unique<Mutable_row>(types));
+    m_rows.back()->set_row_values(nullptr, nullptr, nullptr, nullptr,
+                                  std::numeric_limits<double>::infinity());
+  }
+
+  std::string write(Dump_writer *writer) const {
+    mysqlshdk::storage::backend::Memory_file file{"test"};
+    file.open(mysqlshdk::storage::Mode::WRITE);
+
+    writer->set_output_file(&file);
+    writer->open();
+    writer->write_preamble(m_columns, m_encoding);
+
+    for (const auto &row : m_rows) {
+      writer->write_row(row.get());
+    }
+
+    writer->write_postamble();
+    writer->close();
+
+    return file.content();
+  }
+
+  std::vector<Column> m_columns;
+  std::vector<Encoding_type> m_encoding;
+  std::vector<std::unique_ptr<Mutable_row>> m_rows;
+};
+
+}  // namespace
+
+TEST_F(Dialect_dump_writer_test, predefined_dialects) {
+  const auto test = [this](auto writer, const import_table::Dialect &dialect) {
+    SCOPED_TRACE(dialect.build_sql());
+
+    Text_dump_writer expected{dialect};
+    EXPECT_EQ(write(&expected), write(&writer));
+
+    const auto custom = create_custom_dialect_dump_writer(dialect);
+    EXPECT_EQ(write(&expected), write(custom.get()));
+  };
+
+  test(Default_dump_writer{}, import_table::Dialect::default_());
+  test(Json_dump_writer{}, import_table::Dialect::json());
+  test(Csv_dump_writer{}, import_table::Dialect::csv());
+  test(Tsv_dump_writer{}, import_table::Dialect::tsv());
+  test(Csv_unix_dump_writer{}, import_table::Dialect::csv_unix());
+}
+
+TEST_F(Dialect_dump_writer_test, custom_dialects) {
+  import_table::Dialect dialect;
+
+  for (const auto fields_terminated_by : {",", "\t", "||"}) {
+    dialect.fields_terminated_by = fields_terminated_by;
+
+    for (const auto lines_terminated_by : {"\n", "\r\n", "ab", ""}) {
+      dialect.lines_terminated_by = lines_terminated_by;
+
+      for (const auto fields_escaped_by : {"", "\\", "$"}) {
+        dialect.fields_escaped_by = fields_escaped_by;
+
+        for (const auto fields_enclosed_by : {"", "\"", "n", "|"}) {
+          dialect.fields_enclosed_by = fields_enclosed_by;
+
+          for (const auto optionally_enclosed : {false, true}) {
+            dialect.fields_optionally_enclosed = optionally_enclosed;
+
+            for (const auto lines_starting_by : {"", ">>"}) {
+              dialect.lines_starting_by = lines_starting_by;
+
+              SCOPED_TRACE(dialect.build_sql());
+
+              Text_dump_writer expected{dialect};
+              const auto actual = create_custom_dialect_dump_writer(dialect);
+
+              EXPECT_EQ(write(&expected), write(actual.get()));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(Dialect_dump_writer_test, custom_dialect_output) {
+  import_table::Dialect dialect;
+  dialect.fields_terminated_by = ";";
+  dialect.lines_terminated_by = "|\n";
+  dialect.fields_escaped_by = "$";
+  dialect.fields_enclosed_by = "'";
+  dialect.fields_optionally_enclosed = true;
+
+  const auto writer = create_custom_dialect_dump_writer(dialect);
+
+  EXPECT_EQ(
+      "-1;'text';'YmluYXJ5';'686578';1.500000|\n"
+      "12345;'a,b$t\"c$n$r\\d$$e$0f$Zg$|n$|$|ab>>';"
+      "'YSxiCSJjCg1cZCRlAGYaZ3xufHxhYj4+';"
+      "'612C620922630A0D5C64246500661A677C6E7C7C61623E3E';0.250000|\n"
+      "0;'';'';'';-2.000000|\n"
+      "$N;$N;$N;$N;$N|\n",
+      write(writer.get()));
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/dumper.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+std::vector<std::size_t> indexes(const std::vector<Table_task_order> &order) {
+  std::vector<std::size_t> result;
+
+  for (const auto &entry : order) {
+    result.emplace_back(entry.index);
+  }
+
+  return result;
+}
+
+std::vector<bool> long_poles(const std::vector<Table_task_order> &order) {
+  std::vector<bool> result;
+
+  for (const auto &entry : order) {
+    result.emplace_back(entry.long_pole);
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Dumper_test, order_table_tasks_largest_first) {
+  const auto order = order_table_tasks({10, 300, 0, 20, 300, 5}, 8);
+
+  // tables of the same size keep their original order
+  EXPECT_EQ((std::vector<std::size_t>{1, 4, 3, 0, 5, 2}), indexes(order));
+
+  std::vector<uint64_t> sizes;
+
+  for (const auto &entry : order) {
+    sizes.emplace_back(entry.size);
+  }
+
+  EXPECT_EQ((std::vector<uint64_t>{300, 300, 20, 10, 5, 0}), sizes);
+}
+
+TEST(Dumper_test, order_table_tasks_long_poles) {
+  // total: 1000, fair share of 4 threads: 250
+  EXPECT_EQ((std::vector<bool>{true, true, false, false}),
+            long_poles(order_table_tasks({100, 250, 150, 500}, 4)));
+
+  // total: 1000, fair share of 2 threads: 500
+  EXPECT_EQ((std::vector<bool>{true, false, false, false}),
+            long_poles(order_table_tasks({100, 250, 150, 500}, 2)));
+
+  // a single thread dumps everything, there are no long poles
+  EXPECT_EQ((std::vector<bool>{false, false, false, false}),
+            long_poles(order_table_tasks({100, 250, 150, 500}, 1)));
+
+  // tables without data are never long poles
+  EXPECT_EQ((std::vector<bool>{false, false}),
+            long_poles(order_table_tasks({0, 0}, 4)));
+
+  EXPECT_TRUE(order_table_tasks({}, 4).empty());
+}
+
+TEST(Dumper_test, table_task_priorities) {
+  // long poles are started ahead of everything else, including the DDL,
+  // which uses the HIGH priority
+  EXPECT_EQ(shcore::Queue_priority::HIGHEST, chunking_task_priority(true));
+  EXPECT_EQ(shcore::Queue_priority::HIGHEST, data_task_priority(true));
+
+  // chunking of the remaining tables is done before their data is dumped
+  EXPECT_EQ(shcore::Queue_priority::MEDIUM, chunking_task_priority(false));
+  EXPECT_EQ(shcore::Queue_priority::LOW, data_task_priority(false));
+}
+
+TEST(Dumper_test, priority_queue_order) {
+  // tasks are popped in order of priority, long poles first, in the order in
+  // which they were scheduled
+  shcore::Synchronized_queue<std::size_t> queue;
+  const auto order = order_table_tasks({10, 300, 20, 400}, 4);
+
+  queue.push(100, shcore::Queue_priority::HIGH);
+
+  for (const auto &entry : order) {
+    queue.push(entry.index, data_task_priority(entry.long_pole));
+  }
+
+  std::vector<std::size_t> popped;
+
+  for (std::size_t i = 0; i <= order.size(); ++i) {
+    popped.emplace_back(queue.pop());
+  }
+
+  EXPECT_EQ((std::vector<std::size_t>{3, 1, 100, 2, 0}), popped);
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
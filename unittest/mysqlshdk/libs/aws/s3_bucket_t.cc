@@ -148,6 +148,57 @@ TEST_P(Bucket_test, list_objects) {
   clean_bucket(bucket);
 }
 
+TEST_P(Bucket_test, list_objects_range) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  S3_bucket bucket(get_config());
+
+  create_objects(bucket);
+
+  ASSERT_TRUE(bucket.has_list_objects_range());
+
+  // FULL RANGE: lists all objects
+  auto objects = bucket.list_objects_range("", "", "");
+  ASSERT_EQ(11, objects.size());
+
+  for (size_t index = 0; index < m_objects.size(); index++) {
+    EXPECT_STREQ(m_objects[index].c_str(), objects[index].name.c_str());
+  }
+
+  // CLOSED RANGE: start is exclusive, end is inclusive
+  objects = bucket.list_objects_range("", "sakila/actor_metadata.txt",
+                                      "sakila_metadata.txt");
+  ASSERT_EQ(5, objects.size());
+
+  for (size_t index = 0; index < objects.size(); index++) {
+    EXPECT_STREQ(m_objects[index + 3].c_str(), objects[index].name.c_str());
+  }
+
+  // OPEN RANGE: start does not have to be a name of an existing object
+  objects = bucket.list_objects_range("", "sakila/address", "");
+  ASSERT_EQ(8, objects.size());
+
+  for (size_t index = 0; index < objects.size(); index++) {
+    EXPECT_STREQ(m_objects[index + 3].c_str(), objects[index].name.c_str());
+  }
+
+  // PREFIX FILTER
+  objects = bucket.list_objects_range("sakila/", "sakila/address.csv",
+                                      "sakila/category.csv");
+  ASSERT_EQ(2, objects.size());
+  EXPECT_STREQ("sakila/address_metadata.txt", objects[0].name.c_str());
+  EXPECT_STREQ("sakila/category.csv", objects[1].name.c_str());
+
+  // NOT RECURSIVE
+  objects = bucket.list_objects_range("", "sakila.sql", "sakila_tables.txt",
+                                      false);
+  ASSERT_EQ(2, objects.size());
+  EXPECT_STREQ("sakila_metadata.txt", objects[0].name.c_str());
+  EXPECT_STREQ("sakila_tables.txt", objects[1].name.c_str());
+
+  clean_bucket(bucket);
+}
+
 TEST_P(Bucket_test, multipart_uploads) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
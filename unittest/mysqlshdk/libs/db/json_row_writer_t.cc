@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/utils/json_row_writer.h"
+
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/utils/utils_json.h"
+
+namespace mysqlshdk {
+namespace db {
+
+TEST(Json_row_writer_test, write_string) {
+  const auto escaped = [](const std::string &s) {
+    std::string out;
+    Json_row_writer::write_string(s, &out);
+    return out;
+  };
+
+  const auto expected = [](const std::string &s) {
+    shcore::JSON_dumper dumper;
+    dumper.append_string(s.c_str(), s.length());
+    return dumper.str();
+  };
+
+  for (const auto &s : std::vector<std::string>{
+           "", "plain", "quote\"backslash\\slash/", "\b\f\n\r\t",
+           std::string("\x01\x1f\0end", 6), "\xc5\xbc\xc3\xb3\xc5\x82w"}) {
+    SCOPED_TRACE(s);
+    EXPECT_EQ(expected(s), escaped(s));
+  }
+
+  EXPECT_EQ("\"\\u001F\"", escaped("\x1f"));
+}
+
+TEST(Json_row_writer_test, write) {
+  Mutable_result result{std::vector<Column>{
+      Mutable_result::make_column("s", Type::String),
+      Mutable_result::make_column("\"q\"", Type::String),
+      Mutable_result::make_column("i", Type::Integer),
+      Mutable_result::make_column("u", Type::UInteger),
+      Mutable_result::make_column("f", Type::Float),
+      Mutable_result::make_column("d", Type::Double),
+      Mutable_result::make_column("b", Type::Bytes),
+      Mutable_result::make_column("j", Type::Json),
+      Mutable_result::make_column("dt", Type::DateTime),
+  }};
+
+  result.append("a\nb", nullptr, -1234567890123, 18446744073709551615ull, 1.5f,
+                0.25, "abcd", "{ \"a\" : [1, 2.5, \"x\"] }",
+                "2023-01-02 03:04:05");
+  result.append("", "x", 0, 0, -2.0f, 1e100, "", "null", nullptr);
+
+  const Json_row_writer writer{result.get_metadata(), 0};
+  std::string out;
+
+  writer.write(*result.fetch_one(), &out);
+  EXPECT_EQ(
+      "{\"s\":\"a\\nb\",\"\\\"q\\\"\":null,\"i\":-1234567890123,"
+      "\"u\":18446744073709551615,\"f\":1.5,\"d\":0.25,\"b\":\"YWJjZA==\","
+      "\"j\":{\"a\":[1,2.5,\"x\"]},\"dt\":\"2023-01-02 03:04:05\"}",
+      out);
+
+  out.clear();
+  writer.write(*result.fetch_one(), &out);
+  EXPECT_EQ(
+      "{\"s\":\"\",\"\\\"q\\\"\":\"x\",\"i\":0,\"u\":0,\"f\":-2,\"d\":1e100,"
+      "\"b\":\"\",\"j\":null,\"dt\":null}",
+      out);
+}
+
+TEST(Json_row_writer_test, binary_limit) {
+  Mutable_result result{
+      std::vector<Column>{Mutable_result::make_column("b", Type::Bytes)}};
+  result.append("abcdef");
+
+  const auto row = result.fetch_one();
+  std::string out;
+
+  Json_row_writer{result.get_metadata(), 2}.write(*row, &out);
+  // binary_limit + 1 bytes are written
+  EXPECT_EQ("{\"b\":\"YWJj\"}", out);
+
+  out.clear();
+  Json_row_writer{result.get_metadata(), 10}.write(*row, &out);
+  EXPECT_EQ("{\"b\":\"YWJjZGVm\"}", out);
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/replay/workload.h"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlshdk {
+namespace db {
+namespace replay {
+
+TEST(Workload_test, statement_digest) {
+  EXPECT_EQ("SELECT * FROM T WHERE A = ?",
+            statement_digest("select *  from t\nwhere a = 1"));
+  EXPECT_EQ("SELECT * FROM T WHERE A = ?",
+            statement_digest("SELECT * FROM t WHERE a = 'x''y\\'z'"));
+  EXPECT_EQ("SELECT * FROM `My Table` WHERE `a` = ?",
+            statement_digest("select * from `My Table` where `a` = \"abc\""));
+  EXPECT_EQ("SELECT ? FROM T",
+            statement_digest("/* comment */ SELECT -- comment\n 0x1F FROM t"));
+  EXPECT_EQ("SELECT T.C1 FROM T", statement_digest("SELECT t.c1 FROM t # x"));
+  EXPECT_EQ("SELECT @@SESSION.SQL_MODE;",
+            statement_digest("select @@session.sql_mode;"));
+  EXPECT_EQ("SELECT * FROM T WHERE A IN (?)",
+            statement_digest("SELECT * FROM t WHERE a IN (1, 2.5, 3e-2, 'x')"));
+  EXPECT_EQ("INSERT INTO T VALUES (?)",
+            statement_digest("INSERT INTO t VALUES (1,'a'),(2,'b'), (3, 'c')"));
+  EXPECT_EQ("CALL P(@V, ?)", statement_digest("call p( @v , 7 )"));
+}
+
+TEST(Workload_test, latency_histogram) {
+  Latency_histogram histogram;
+
+  EXPECT_EQ(0u, histogram.count());
+  EXPECT_EQ(0u, histogram.min());
+  EXPECT_EQ(0u, histogram.percentile(50));
+
+  for (uint64_t i = 1; i <= 100; ++i) {
+    histogram.add(i);
+  }
+
+  EXPECT_EQ(100u, histogram.count());
+  EXPECT_EQ(5050u, histogram.total());
+  EXPECT_EQ(1u, histogram.min());
+  EXPECT_EQ(100u, histogram.max());
+  EXPECT_EQ(50u, histogram.average());
+  // 50th value falls into [32, 64) bucket
+  EXPECT_EQ(63u, histogram.percentile(50));
+  // upper bound of the last bucket is limited by the maximum
+  EXPECT_EQ(100u, histogram.percentile(99));
+  EXPECT_EQ(1u, histogram.percentile(0));
+
+  Latency_histogram other;
+  other.add(0);
+  other.add(1000);
+
+  histogram.merge(other);
+
+  EXPECT_EQ(102u, histogram.count());
+  EXPECT_EQ(6050u, histogram.total());
+  EXPECT_EQ(0u, histogram.min());
+  EXPECT_EQ(1000u, histogram.max());
+  EXPECT_EQ(1000u, histogram.percentile(100));
+}
+
+TEST(Workload_test, write_and_read) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "workload_test.json");
+
+  {
+    Workload_writer writer{path};
+
+    EXPECT_EQ(path, writer.path());
+    EXPECT_EQ(1u, writer.new_session());
+    EXPECT_EQ(2u, writer.new_session());
+
+    Workload_event event;
+    event.type = Workload_event::Type::QUERY;
+    event.session = 2;
+    event.start = 20;
+    event.duration = 5;
+    event.sql = "SELECT \"a\"\n";
+    event.error = 1146;
+    writer.write(event);
+
+    event.type = Workload_event::Type::CONNECT;
+    event.session = 1;
+    event.start = 10;
+    event.sql = "db";
+    writer.write(event);
+  }
+
+  const auto events = read_workload(path);
+
+  ASSERT_EQ(2u, events.size());
+
+  EXPECT_EQ(Workload_event::Type::CONNECT, events[0].type);
+  EXPECT_EQ(1u, events[0].session);
+  EXPECT_EQ(10u, events[0].start);
+  EXPECT_EQ("db", events[0].sql);
+
+  EXPECT_EQ(Workload_event::Type::QUERY, events[1].type);
+  EXPECT_EQ(2u, events[1].session);
+  EXPECT_EQ(20u, events[1].start);
+  EXPECT_EQ(5u, events[1].duration);
+  EXPECT_EQ("SELECT \"a\"\n", events[1].sql);
+  EXPECT_EQ(1146u, events[1].error);
+
+  {
+    std::ofstream out(path, std::ios::app);
+    out << "{\"session\":1}\n";
+  }
+
+  EXPECT_THROW(read_workload(path), std::runtime_error);
+
+  {
+    std::ofstream out(path, std::ios::trunc);
+    out << "{\"not\":\"a workload\"}\n";
+  }
+
+  EXPECT_THROW(read_workload(path), std::runtime_error);
+
+  shcore::delete_file(path);
+
+  EXPECT_THROW(read_workload(path), std::runtime_error);
+}
+
+TEST(Workload_test, write_filtered) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "workload_test.json");
+
+  {
+    std::ofstream out(path, std::ios::trunc);
+    out << "stale contents\n";
+  }
+
+  {
+    Workload_writer writer{path, {"*IDENTIFIED*", "*PASSWORD*"}};
+
+    EXPECT_TRUE(writer.is_filtered("CREATE USER u IDENTIFIED BY 'pass'"));
+    EXPECT_TRUE(writer.is_filtered("set password = 'pass'"));
+    EXPECT_FALSE(writer.is_filtered("SELECT 1"));
+
+    Workload_event event;
+    event.type = Workload_event::Type::QUERY;
+    event.session = 1;
+    event.start = 10;
+    event.filtered = true;
+    writer.write(event);
+  }
+
+#ifndef _WIN32
+  struct stat st;
+  ASSERT_EQ(0, stat(path.c_str(), &st));
+  EXPECT_EQ(S_IRUSR | S_IWUSR, st.st_mode & S_IRWXU);
+  EXPECT_EQ(0, st.st_mode & S_IRWXG);
+  EXPECT_EQ(0, st.st_mode & S_IRWXO);
+#endif
+
+  const auto contents = shcore::get_text_file(path);
+  EXPECT_EQ(std::string::npos, contents.find("stale"));
+  EXPECT_EQ(std::string::npos, contents.find("pass"));
+
+  const auto events = read_workload(path);
+
+  ASSERT_EQ(1u, events.size());
+  EXPECT_EQ(Workload_event::Type::QUERY, events[0].type);
+  EXPECT_TRUE(events[0].filtered);
+  EXPECT_EQ("", events[0].sql);
+
+  shcore::delete_file(path);
+}
+
+TEST(Workload_test, replayer_options) {
+  Workload_replay_options options;
+
+  EXPECT_THROW(Workload_replayer({}, options), std::invalid_argument);
+
+  options.connect = []() -> std::shared_ptr<ISession> { return nullptr; };
+  options.threads = 0;
+
+  EXPECT_THROW(Workload_replayer({}, options), std::invalid_argument);
+
+  options.threads = 1;
+  options.speed_up = -1;
+
+  EXPECT_THROW(Workload_replayer({}, options), std::invalid_argument);
+
+  options.speed_up = 0;
+  Workload_replayer replayer{{}, options};
+  const auto result = replayer.run();
+
+  EXPECT_EQ(0u, result.sessions);
+  EXPECT_EQ(0u, result.executed);
+  EXPECT_TRUE(result.statements.empty());
+}
+
+}  // namespace replay
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/binlog_reader.h"
+
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+namespace {
+
+void append_uint(uint64_t value, std::size_t size, std::string *out) {
+  for (std::size_t i = 0; i < size; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+std::string make_event(Binlog_event_type type, const std::string &body,
+                       uint32_t checksum_size = 0, uint16_t flags = 0) {
+  const auto size = Binlog_event_header::k_size + body.size() + checksum_size;
+  std::string event;
+
+  append_uint(1700000000, 4, &event);
+  append_uint(static_cast<uint8_t>(type), 1, &event);
+  append_uint(1, 4, &event);
+  append_uint(size, 4, &event);
+  append_uint(1234, 4, &event);
+  append_uint(flags, 2, &event);
+  event += body;
+  event.append(checksum_size, '\xAB');
+
+  return event;
+}
+
+std::string make_fde(bool crc32) {
+  // binlog version, server version, timestamp, header length, some post-header
+  // lengths
+  std::string body;
+  append_uint(4, 2, &body);
+  body += std::string(50, '\0');
+  append_uint(0, 4, &body);
+  append_uint(Binlog_event_header::k_size, 1, &body);
+  body += std::string(10, '\0');
+  // checksum algorithm, checksum value is always present
+  append_uint(crc32 ? 1 : 0, 1, &body);
+
+  return make_event(Binlog_event_type::FORMAT_DESCRIPTION, body, 4);
+}
+
+std::string make_query(const std::string &schema, const std::string &query,
+                       uint32_t checksum_size) {
+  const std::string status_vars = "\x01\x02\x03";
+  std::string body;
+
+  append_uint(7, 4, &body);  // thread ID
+  append_uint(0, 4, &body);  // execution time
+  append_uint(schema.length(), 1, &body);
+  append_uint(0, 2, &body);  // error code
+  append_uint(status_vars.length(), 2, &body);
+  body += status_vars;
+  body += schema;
+  body += '\0';
+  body += query;
+
+  return make_event(Binlog_event_type::QUERY, body, checksum_size);
+}
+
+std::string make_rows(Binlog_event_type type, bool end_of_statement,
+                      uint32_t checksum_size) {
+  std::string body;
+
+  append_uint(42, 6, &body);  // table ID
+  append_uint(end_of_statement ? 1 : 0, 2, &body);
+  body += "row data";
+
+  return make_event(type, body, checksum_size);
+}
+
+std::string make_table_map(const std::string &schema, const std::string &table,
+                           uint32_t checksum_size) {
+  std::string body;
+
+  append_uint(42, 6, &body);  // table ID
+  append_uint(0, 2, &body);   // flags
+  append_uint(schema.length(), 1, &body);
+  body += schema;
+  body += '\0';
+  append_uint(table.length(), 1, &body);
+  body += table;
+  body += '\0';
+  body += "column data";
+
+  return make_event(Binlog_event_type::TABLE_MAP, body, checksum_size);
+}
+
+std::string encode(const std::string &event) {
+  std::string result;
+  shcore::encode_base64(reinterpret_cast<const unsigned char *>(event.data()),
+                        static_cast<int>(event.size()), &result);
+  return result;
+}
+
+}  // namespace
+
+TEST(Binlog_reader_test, parse_header) {
+  const auto event = make_event(Binlog_event_type::XID, "12345678", 4, 0x20);
+  const auto header = parse_binlog_event_header(event);
+
+  EXPECT_EQ(1700000000u, header.timestamp);
+  EXPECT_EQ(Binlog_event_type::XID, header.type);
+  EXPECT_EQ(1u, header.server_id);
+  EXPECT_EQ(event.size(), header.event_size);
+  EXPECT_EQ(1234u, header.log_pos);
+  EXPECT_EQ(Binlog_event_header::k_artificial_flag, header.flags);
+
+  EXPECT_THROW(parse_binlog_event_header(event.substr(0, 10)),
+               std::runtime_error);
+  EXPECT_THROW(parse_binlog_event_header(event.substr(0, event.size() - 1)),
+               std::runtime_error);
+}
+
+TEST(Binlog_reader_test, checksum_size) {
+  EXPECT_EQ(4u, binlog_checksum_size(make_fde(true)));
+  EXPECT_EQ(0u, binlog_checksum_size(make_fde(false)));
+}
+
+TEST(Binlog_reader_test, parse_query) {
+  for (const uint32_t checksum : {0u, 4u}) {
+    SCOPED_TRACE(checksum);
+
+    const auto event = make_query("test", "CREATE TABLE t (a int)", checksum);
+    const auto query = parse_binlog_query_event(event, checksum);
+
+    EXPECT_EQ("test", query.schema);
+    EXPECT_EQ("CREATE TABLE t (a int)", query.query);
+  }
+
+  {
+    const auto event = make_query("", "BEGIN", 0);
+    const auto query = parse_binlog_query_event(event, 0);
+
+    EXPECT_EQ("", query.schema);
+    EXPECT_EQ("BEGIN", query.query);
+  }
+}
+
+TEST(Binlog_reader_test, rows_event) {
+  EXPECT_TRUE(is_binlog_rows_event(Binlog_event_type::WRITE_ROWS));
+  EXPECT_TRUE(is_binlog_rows_event(Binlog_event_type::PARTIAL_UPDATE_ROWS));
+  EXPECT_FALSE(is_binlog_rows_event(Binlog_event_type::TABLE_MAP));
+
+  EXPECT_TRUE(binlog_rows_event_ends_statement(
+      make_rows(Binlog_event_type::WRITE_ROWS, true, 4)));
+  EXPECT_FALSE(binlog_rows_event_ends_statement(
+      make_rows(Binlog_event_type::DELETE_ROWS, false, 4)));
+}
+
+TEST(Binlog_reader_test, event_support) {
+  EXPECT_EQ(Binlog_event_support::APPLIED,
+            binlog_event_support(Binlog_event_type::UPDATE_ROWS));
+  EXPECT_EQ(Binlog_event_support::APPLIED,
+            binlog_event_support(Binlog_event_type::XID));
+  EXPECT_EQ(Binlog_event_support::IGNORED,
+            binlog_event_support(Binlog_event_type::ROTATE));
+  EXPECT_EQ(Binlog_event_support::IGNORED,
+            binlog_event_support(static_cast<Binlog_event_type>(33)));
+  EXPECT_EQ(Binlog_event_support::UNSUPPORTED,
+            binlog_event_support(Binlog_event_type::TRANSACTION_PAYLOAD));
+  EXPECT_EQ(Binlog_event_support::UNSUPPORTED,
+            binlog_event_support(Binlog_event_type::USER_VAR));
+}
+
+TEST(Binlog_reader_test, statement_builder) {
+  std::vector<std::string> statements;
+  Binlog_statement_builder builder{
+      [&statements](const std::string &sql) { statements.emplace_back(sql); }};
+
+  const auto fde = make_fde(true);
+  const auto table_map = make_event(Binlog_event_type::TABLE_MAP, "map", 4);
+  const auto rows1 = make_rows(Binlog_event_type::WRITE_ROWS, false, 4);
+  const auto rows2 = make_rows(Binlog_event_type::UPDATE_ROWS, true, 4);
+
+  std::string events;
+  events += fde;
+  events += make_event(static_cast<Binlog_event_type>(33), "gtid", 4);
+  events += make_query("", "BEGIN", 4);
+  events += table_map;
+  events += rows1;
+  events += rows2;
+  events += make_event(Binlog_event_type::XID, "12345678", 4);
+  events += make_query("db", "DROP TABLE t", 4);
+  events += make_query("db", "DROP TABLE u", 4);
+
+  EXPECT_EQ(3u, builder.push_all(events));
+  EXPECT_EQ(3u, builder.transactions());
+
+  const std::vector<std::string> expected = {
+      "BINLOG '" + encode(fde) + "'",
+      "BEGIN",
+      "BINLOG '" + encode(table_map) + "\n" + encode(rows1) + "\n" +
+          encode(rows2) + "'",
+      "COMMIT",
+      "USE `db`",
+      "DROP TABLE t",
+      "DROP TABLE u",
+  };
+
+  EXPECT_EQ(expected, statements);
+
+  EXPECT_THROW(
+      builder.push(make_event(Binlog_event_type::TRANSACTION_PAYLOAD, "x", 4)),
+      std::runtime_error);
+}
+
+TEST(Binlog_reader_test, parse_table_map) {
+  for (const uint32_t checksum : {0u, 4u}) {
+    SCOPED_TRACE(checksum);
+
+    const auto event = make_table_map("db", "tbl", checksum);
+    const auto table_map = parse_binlog_table_map_event(event);
+
+    EXPECT_EQ("db", table_map.schema);
+    EXPECT_EQ("tbl", table_map.table);
+  }
+
+  EXPECT_THROW(
+      parse_binlog_table_map_event(
+          make_event(Binlog_event_type::TABLE_MAP, "too short", 4)),
+      std::runtime_error);
+}
+
+TEST(Binlog_reader_test, dml_statement) {
+  EXPECT_TRUE(is_binlog_dml_statement("INSERT INTO t VALUES (1)"));
+  EXPECT_TRUE(is_binlog_dml_statement("  update t SET a = 1"));
+  EXPECT_TRUE(is_binlog_dml_statement("/* comment */ DELETE FROM t"));
+  EXPECT_TRUE(is_binlog_dml_statement("REPLACE INTO t VALUES (1)"));
+  EXPECT_TRUE(is_binlog_dml_statement("LOAD DATA INFILE 'x' INTO TABLE t"));
+
+  EXPECT_FALSE(is_binlog_dml_statement("CREATE TABLE t (a int)"));
+  EXPECT_FALSE(is_binlog_dml_statement("SAVEPOINT `a`"));
+  EXPECT_FALSE(is_binlog_dml_statement("GRANT SELECT ON *.* TO u"));
+}
+
+TEST(Binlog_reader_test, statement_target) {
+  using Type = Binlog_statement_target::Type;
+
+  const auto EXPECT_TARGET = [](std::string_view query, Type type,
+                                const std::string &schema,
+                                const std::string &name) {
+    SCOPED_TRACE(query);
+
+    const auto target = binlog_statement_target(query, "def");
+
+    EXPECT_EQ(type, target.type);
+    EXPECT_EQ(schema, target.schema);
+    EXPECT_EQ(name, target.name);
+  };
+
+  EXPECT_TARGET("CREATE TABLE t (a int)", Type::TABLE, "def", "t");
+  EXPECT_TARGET("CREATE TABLE IF NOT EXISTS `s`.`t`(a int)", Type::TABLE, "s",
+                "t");
+  EXPECT_TARGET("CREATE TEMPORARY TABLE s.t LIKE u", Type::TABLE, "s", "t");
+  EXPECT_TARGET("DROP TABLE `t` /* generated by server */", Type::TABLE, "def",
+                "t");
+  EXPECT_TARGET("ALTER TABLE `s`.`t` ADD COLUMN b int", Type::TABLE, "s", "t");
+  EXPECT_TARGET("RENAME TABLE a TO b", Type::TABLE, "def", "a");
+  EXPECT_TARGET("TRUNCATE TABLE s.t", Type::TABLE, "s", "t");
+  EXPECT_TARGET("TRUNCATE t", Type::TABLE, "def", "t");
+  EXPECT_TARGET("ANALYZE NO_WRITE_TO_BINLOG TABLE t", Type::TABLE, "def", "t");
+  EXPECT_TARGET("CREATE UNIQUE INDEX i ON s.t (a)", Type::TABLE, "s", "t");
+  EXPECT_TARGET("CREATE ALGORITHM=UNDEFINED DEFINER=`root`@`localhost` SQL "
+                "SECURITY DEFINER VIEW `v` AS select 1",
+                Type::TABLE, "def", "v");
+  EXPECT_TARGET("CREATE DEFINER=`root`@`%` PROCEDURE `s`.`p`() BEGIN END",
+                Type::ROUTINE, "s", "p");
+  EXPECT_TARGET("DROP FUNCTION IF EXISTS f", Type::ROUTINE, "def", "f");
+  EXPECT_TARGET("CREATE EVENT e ON SCHEDULE EVERY 1 DAY DO SELECT 1",
+                Type::EVENT, "def", "e");
+  EXPECT_TARGET("CREATE TRIGGER s.tr BEFORE INSERT ON t FOR EACH ROW SET @a=1",
+                Type::SCHEMA, "s", "");
+  EXPECT_TARGET("CREATE DATABASE `s`", Type::SCHEMA, "s", "");
+  EXPECT_TARGET("DROP SCHEMA IF EXISTS s", Type::SCHEMA, "s", "");
+
+  EXPECT_TARGET("CREATE USER 'u'@'%' IDENTIFIED BY 'p'", Type::NONE, "", "");
+  EXPECT_TARGET("DROP ROLE r", Type::NONE, "", "");
+  EXPECT_TARGET("GRANT SELECT ON s.* TO u", Type::NONE, "", "");
+  EXPECT_TARGET("RENAME USER a TO b", Type::NONE, "", "");
+  EXPECT_TARGET("FLUSH PRIVILEGES", Type::NONE, "", "");
+}
+
+TEST(Binlog_reader_test, statement_builder_filter) {
+  std::vector<std::string> statements;
+  std::vector<Binlog_statement_target> targets;
+  Binlog_statement_builder builder{
+      [&statements](const std::string &sql) { statements.emplace_back(sql); },
+      [&targets](const Binlog_statement_target &target) {
+        targets.emplace_back(target);
+        return Binlog_statement_target::Type::NONE != target.type &&
+               "excluded" != target.schema;
+      }};
+
+  const auto fde = make_fde(true);
+  const auto included_map = make_table_map("db", "t", 4);
+  const auto excluded_map = make_table_map("excluded", "t", 4);
+  const auto rows = make_rows(Binlog_event_type::WRITE_ROWS, true, 4);
+
+  builder.push(fde);
+  builder.push(make_query("", "BEGIN", 4));
+  builder.push(excluded_map);
+  builder.push(rows);
+  builder.push(included_map);
+  builder.push(rows);
+  builder.push(make_query("", "SAVEPOINT `a`", 4));
+  builder.push(make_event(Binlog_event_type::XID, "12345678", 4));
+  builder.push(make_query("excluded", "CREATE TABLE t (a int)", 4));
+  builder.push(make_query("db", "CREATE TABLE excluded.t (a int)", 4));
+  builder.push(make_query("other", "CREATE TABLE db.u (a int)", 4));
+  builder.push(make_query("", "CREATE USER u", 4));
+
+  EXPECT_EQ(5u, builder.transactions());
+  EXPECT_FALSE(builder.in_transaction());
+
+  const std::vector<std::string> expected = {
+      "BINLOG '" + encode(fde) + "'",
+      "BEGIN",
+      "BINLOG '" + encode(included_map) + "\n" + encode(rows) + "'",
+      "SAVEPOINT `a`",
+      "COMMIT",
+      "USE `other`",
+      "CREATE TABLE db.u (a int)",
+  };
+
+  EXPECT_EQ(expected, statements);
+
+  ASSERT_EQ(6u, targets.size());
+  EXPECT_EQ(Binlog_statement_target::Type::TABLE, targets[0].type);
+  EXPECT_EQ("excluded", targets[0].schema);
+  EXPECT_EQ("t", targets[0].name);
+  EXPECT_EQ(Binlog_statement_target::Type::NONE, targets[5].type);
+
+  // statement-based DML is rejected
+  EXPECT_THROW(builder.push(make_query("db", "INSERT INTO t VALUES (1)", 4)),
+               std::runtime_error);
+
+  // a statement cannot modify both included and excluded tables
+  builder.push(make_query("", "BEGIN", 4));
+  builder.push(included_map);
+  EXPECT_THROW(builder.push(excluded_map), std::runtime_error);
+}
+
+TEST(Binlog_reader_test, file_reader) {
+  std::vector<std::string> events;
+  events.emplace_back(make_fde(true));
+  events.emplace_back(make_query("", "BEGIN", 4));
+  events.emplace_back(make_table_map("db", "t", 4));
+  events.emplace_back(make_rows(Binlog_event_type::WRITE_ROWS, true, 4));
+  events.emplace_back(make_event(Binlog_event_type::XID, "12345678", 4));
+  events.emplace_back(
+      make_query("db", "CREATE TABLE t (a text)" + std::string(3000, ' '), 4));
+
+  std::string contents;
+
+  for (const auto &event : events) {
+    contents += event;
+  }
+
+  for (const std::size_t buffer_size : {1, 20, 64, 1024 * 1024}) {
+    SCOPED_TRACE(buffer_size);
+
+    storage::backend::Memory_file file{"file"};
+    file.set_content(contents);
+    file.open(storage::Mode::READ);
+
+    Binlog_file_reader reader{&file, buffer_size};
+    uint64_t position = 0;
+
+    for (const auto &event : events) {
+      EXPECT_EQ(event, reader.next());
+
+      position += event.size();
+      EXPECT_EQ(position, reader.position());
+    }
+
+    EXPECT_TRUE(reader.next().empty());
+    EXPECT_TRUE(reader.next().empty());
+    EXPECT_EQ(contents.size(), reader.position());
+  }
+
+  for (const std::size_t size : {std::size_t{5}, contents.size() - 1}) {
+    SCOPED_TRACE(size);
+
+    storage::backend::Memory_file file{"file"};
+    file.set_content(contents.substr(0, size));
+    file.open(storage::Mode::READ);
+
+    Binlog_file_reader reader{&file, 64};
+
+    EXPECT_THROW(
+        {
+          while (!reader.next().empty()) {
+          }
+        },
+        std::runtime_error);
+  }
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
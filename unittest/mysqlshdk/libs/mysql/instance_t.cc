@@ -397,6 +397,102 @@ TEST_F(Instance_test, get_sysvar_invalid_qualifier) {
   _session->close();
 }
 
+TEST_F(Instance_test, sysvar_snapshot) {
+  EXPECT_CALL(session, do_connect(_connection_options));
+  EXPECT_CALL(session, is_open()).WillOnce(Return(false));
+  const mysqlshdk::db::Connection_options opts;
+  EXPECT_CALL(session, get_connection_options()).WillOnce(ReturnRef(opts));
+  _session->connect(_connection_options);
+  mysqlshdk::mysql::Instance instance(_session);
+
+  EXPECT_FALSE(instance.has_sysvar_snapshot());
+
+  {
+    // all variables are read using a single query
+    session
+        .expect_query(
+            "show GLOBAL variables where `variable_name` in "
+            "('server_id', 'gtid_mode', 'unexisting_variable')")
+        .then_return({{"show GLOBAL variables where `variable_name` in "
+                       "('server_id', 'gtid_mode', 'unexisting_variable')",
+                       {"Variable_name", "Value"},
+                       {Type::String, Type::String},
+                       {{"gtid_mode", "ON"}, {"server_id", "1"}}}});
+    mysqlshdk::mysql::Scoped_sysvar_snapshot snapshot{
+        instance, {"server_id", "GTID_MODE", "unexisting_variable"}};
+
+    EXPECT_TRUE(instance.has_sysvar_snapshot());
+
+    // values are served from the snapshot
+    EXPECT_EQ(1, *instance.get_sysvar_int("server_id"));
+    EXPECT_EQ("ON", *instance.get_sysvar_string("gtid_mode"));
+    EXPECT_FALSE(instance.get_sysvar_string("unexisting_variable"));
+
+    {
+      // nested snapshot reads only the missing variables, and does not
+      // clear the outer one
+      session
+          .expect_query(
+              "show GLOBAL variables where `variable_name` in "
+              "('binlog_format')")
+          .then_return({{"show GLOBAL variables where `variable_name` in "
+                         "('binlog_format')",
+                         {"Variable_name", "Value"},
+                         {Type::String, Type::String},
+                         {{"binlog_format", "ROW"}}}});
+      mysqlshdk::mysql::Scoped_sysvar_snapshot nested{
+          instance, {"server_id", "binlog_format"}};
+
+      EXPECT_EQ("ROW", *instance.get_sysvar_string("binlog_format"));
+    }
+
+    EXPECT_TRUE(instance.has_sysvar_snapshot());
+    EXPECT_EQ("ROW", *instance.get_sysvar_string("binlog_format"));
+
+    // variables with a different scope are not in the snapshot
+    session
+        .expect_query(
+            "show SESSION variables where `variable_name` in ('server_id')")
+        .then_return({{"show SESSION variables "
+                       "where `variable_name` in ('server_id')",
+                       {"Variable_name", "Value"},
+                       {Type::String, Type::String},
+                       {{"server_id", "1"}}}});
+    EXPECT_EQ(1, *instance.get_sysvar_int(
+                      "server_id", mysqlshdk::mysql::Var_qualifier::SESSION));
+
+    // changing a variable removes it from the snapshot
+    session.expect_query("SET GLOBAL `gtid_mode` = 'OFF'").then({""});
+    instance.set_sysvar("gtid_mode", std::string{"OFF"});
+    session
+        .expect_query(
+            "show GLOBAL variables where `variable_name` in ('gtid_mode')")
+        .then_return({{"show GLOBAL variables "
+                       "where `variable_name` in ('gtid_mode')",
+                       {"Variable_name", "Value"},
+                       {Type::String, Type::String},
+                       {{"gtid_mode", "OFF"}}}});
+    EXPECT_EQ("OFF", *instance.get_sysvar_string("gtid_mode"));
+  }
+
+  EXPECT_FALSE(instance.has_sysvar_snapshot());
+
+  // snapshot is gone, variables are read from the server again
+  session
+      .expect_query(
+          "show GLOBAL variables where `variable_name` in ('server_id')")
+      .then_return({{"show GLOBAL variables "
+                     "where `variable_name` in ('server_id')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"server_id", "2"}}}});
+  EXPECT_EQ(2, *instance.get_sysvar_int("server_id"));
+
+  EXPECT_CALL(session, do_close());
+  EXPECT_CALL(session, is_open()).WillOnce(Return(false));
+  _session->close();
+}
+
 TEST_F(Instance_test, set_sysvar) {
   EXPECT_CALL(session, do_connect(_connection_options));
   EXPECT_CALL(session, is_open()).WillOnce(Return(false));
@@ -222,6 +222,108 @@ TEST(In_memory_allocator, threads) {
   }
 }
 
+TEST(In_memory_allocator, memory_usage) {
+  constexpr std::size_t block_size = 512;
+
+  Allocator a{4 * block_size, block_size};
+
+  EXPECT_EQ(0, a.memory_in_use());
+  EXPECT_EQ(0, a.peak_memory_in_use());
+
+  const auto blocks = a.allocate(3 * block_size);
+  EXPECT_EQ(3 * block_size, a.memory_in_use());
+
+  const auto more_blocks = a.allocate(4 * block_size + 1);
+  EXPECT_EQ(8 * block_size, a.memory_in_use());
+  EXPECT_EQ(8 * block_size, a.peak_memory_in_use());
+
+  a.free(blocks);
+  EXPECT_EQ(5 * block_size, a.memory_in_use());
+  EXPECT_EQ(8 * block_size, a.peak_memory_in_use());
+
+  a.free(more_blocks);
+  EXPECT_EQ(0, a.memory_in_use());
+  EXPECT_EQ(8 * block_size, a.peak_memory_in_use());
+}
+
+TEST(In_memory_allocator, memory_limit_throw) {
+  constexpr std::size_t block_size = 512;
+
+  Allocator a{4 * block_size, block_size};
+  a.set_memory_limit(2 * block_size + 1, false);
+
+  // limit is rounded up
+  EXPECT_EQ(3 * block_size, a.memory_limit());
+
+  const auto blocks = a.allocate(2 * block_size);
+  EXPECT_THROW(a.allocate(2 * block_size), std::runtime_error);
+  EXPECT_EQ(2 * block_size, a.memory_in_use());
+
+  const auto block = a.allocate_block();
+  EXPECT_EQ(3 * block_size, a.memory_in_use());
+
+  a.free(block);
+  a.free(blocks);
+
+  // the limit applies even if no memory is used
+  EXPECT_THROW(a.allocate(4 * block_size), std::runtime_error);
+
+  a.set_memory_limit(0, false);
+  a.free(a.allocate(4 * block_size));
+}
+
+TEST(In_memory_allocator, memory_limit_wait) {
+  constexpr std::size_t block_size = 512;
+
+  Allocator a{4 * block_size, block_size};
+  a.set_memory_limit(2 * block_size, true);
+
+  // allocation bigger than the limit succeeds if no memory is in use
+  a.free(a.allocate(4 * block_size));
+
+  auto blocks = a.allocate(2 * block_size);
+  std::atomic<bool> allocated = false;
+
+  std::thread t{[&a, &allocated]() {
+    const auto block = a.allocate_block();
+    allocated = true;
+    a.free(block);
+  }};
+
+  shcore::sleep_ms(100);
+  // memory is not available, thread is waiting
+  EXPECT_FALSE(allocated);
+  EXPECT_EQ(1, a.waiting_allocations());
+
+  a.free(blocks.back());
+  blocks.pop_back();
+
+  t.join();
+  EXPECT_TRUE(allocated);
+  EXPECT_EQ(0, a.waiting_allocations());
+
+  a.free(blocks);
+}
+
+TEST(In_memory_allocator, memory_limit_interrupt) {
+  constexpr std::size_t block_size = 512;
+
+  Allocator a{4 * block_size, block_size};
+  a.set_memory_limit(block_size, true);
+
+  const auto block = a.allocate_block();
+
+  std::thread t{[&a]() {
+    EXPECT_THROW(a.allocate_block(), std::runtime_error);
+  }};
+
+  shcore::sleep_ms(100);
+  a.interrupt();
+  t.join();
+
+  a.free(block);
+}
+
 }  // namespace in_memory
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -870,6 +870,54 @@ TEST(Virtual_fs, synchronized_file_io) {
   reader.join();
 }
 
+TEST(Virtual_fs, synchronized_file_multiple_writes) {
+  Virtual_fs fs{1024, 1024};
+  const auto dir = fs.create_directory("dir");
+
+  fs.set_uses_synchronized_io([](std::string_view name) {
+    return shcore::str_iendswith(name, ".blob");
+  });
+
+  dir->create_file("file.blob");
+
+  std::thread writer{[&dir]() {
+    const auto file = dir->file("file.blob");
+    SCOPED_TRACE("writer: " + file->name());
+
+    file->open(false);
+    // these two writes fit into a single read buffer
+    EXPECT_EQ(3, file->write("123", 3));
+    EXPECT_EQ(3, file->write("456", 3));
+    // this one does not fit, the first read returns the data written so far
+    EXPECT_EQ(5, file->write("7890A", 5));
+    EXPECT_EQ(11, file->size());
+    // data is flushed to the reader when the file is closed
+    file->close();
+  }};
+
+  std::thread reader{[&dir]() {
+    const auto file = dir->file("file.blob");
+    SCOPED_TRACE("reader: " + file->name());
+
+    std::string input(8, 'x');
+
+    file->open(true);
+
+    EXPECT_EQ(6, file->read(input.data(), input.length()));
+    EXPECT_EQ("123456", input.substr(0, 6));
+
+    EXPECT_EQ(5, file->read(input.data(), input.length()));
+    EXPECT_EQ("7890A", input.substr(0, 5));
+
+    EXPECT_EQ(0, file->read(input.data(), input.length()));
+
+    file->close();
+  }};
+
+  writer.join();
+  reader.join();
+}
+
 }  // namespace in_memory
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+namespace {
+
+std::string base64(std::string_view data) {
+  std::string result;
+  result.resize(base64_encoded_length(data.length()));
+  const auto end = encode_base64(data, result.data());
+  EXPECT_EQ(result.data() + result.length(), end);
+  return result;
+}
+
+std::string hex(std::string_view data) {
+  std::string result;
+  result.resize(2 * data.length());
+  const auto end = encode_hex(data, result.data());
+  EXPECT_EQ(result.data() + result.length(), end);
+  return result;
+}
+
+}  // namespace
+
+TEST(Utils_encoding, encode_base64) {
+  EXPECT_EQ("", base64(""));
+  EXPECT_EQ("Zg==", base64("f"));
+  EXPECT_EQ("Zm8=", base64("fo"));
+  EXPECT_EQ("Zm9v", base64("foo"));
+  EXPECT_EQ("Zm9vYg==", base64("foob"));
+  EXPECT_EQ("Zm9vYmE=", base64("fooba"));
+  EXPECT_EQ("Zm9vYmFy", base64("foobar"));
+  EXPECT_EQ("AP8=", base64(std::string_view{"\0\xff", 2}));
+
+  // results should match the line-wrapping encoder once line breaks are removed
+  std::string data;
+
+  for (int i = 0; i < 1000; ++i) {
+    data.push_back(static_cast<char>((i * 37) & 0xFF));
+  }
+
+  std::string expected;
+  ASSERT_TRUE(encode_base64(reinterpret_cast<const unsigned char *>(data.data()),
+                            static_cast<int>(data.length()), &expected));
+  std::erase(expected, '\n');
+
+  EXPECT_EQ(expected, base64(data));
+}
+
+TEST(Utils_encoding, encode_hex) {
+  EXPECT_EQ("", hex(""));
+  EXPECT_EQ("00", hex(std::string_view{"\0", 1}));
+  EXPECT_EQ("0AFF7F", hex("\x0a\xff\x7f"));
+  EXPECT_EQ("666F6F", hex("foo"));
+}
+
+}  // namespace shcore
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/xxhash.h"
+
+#include <string>
+#include <string_view>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+uint64_t hash(std::string_view data) {
+  return Xxhash64::hash(data.data(), data.length());
+}
+
+}  // namespace
+
+TEST(Xxhash64_test, known_values) {
+  EXPECT_EQ(0xEF46DB3751D8E999ULL, hash(""));
+  EXPECT_EQ(0xD24EC4F1A98C6E5BULL, hash("a"));
+  EXPECT_EQ(0x44BC2CF5AD770999ULL, hash("abc"));
+  EXPECT_EQ(0xFBCEA83C8A378BF1ULL,
+            hash("Nobody inspects the spammish repetition"));
+
+  Xxhash64 h;
+  EXPECT_EQ("EF46DB3751D8E999", h.hex_digest());
+}
+
+TEST(Xxhash64_test, streaming) {
+  std::string data;
+
+  for (int i = 0; i < 1000; ++i) {
+    data.push_back(static_cast<char>((i * 131) & 0xFF));
+  }
+
+  for (std::size_t length : {0, 1, 7, 31, 32, 33, 100, 1000}) {
+    SCOPED_TRACE(length);
+
+    const std::string_view input{data.data(), length};
+    const auto expected = hash(input);
+
+    for (std::size_t piece : {1, 3, 8, 31, 32, 64}) {
+      SCOPED_TRACE(piece);
+
+      Xxhash64 h;
+
+      for (std::size_t offset = 0; offset < length; offset += piece) {
+        const auto sv = input.substr(offset, piece);
+        h.update(sv.data(), sv.length());
+      }
+
+      EXPECT_EQ(expected, h.digest());
+    }
+  }
+
+  Xxhash64 h;
+  h.update("abc", 3);
+  h.reset();
+  EXPECT_EQ(hash(""), h.digest());
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
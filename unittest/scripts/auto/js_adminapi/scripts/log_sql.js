@@ -9,13 +9,13 @@ var check_instance_sql = [
     "SELECT `major`, `minor`, `patch` FROM `mysql_innodb_cluster_metadata`.`schema_version`",
     "SELECT PRIVILEGE_TYPE FROM INFORMATION_SCHEMA.USER_PRIVILEGES WHERE GRANTEE=",
     "show GLOBAL variables where `variable_name` in ('server_id')",
-    "show GLOBAL variables where `variable_name` in ('gtid_mode')"
+    "show GLOBAL variables where `variable_name` in (*'gtid_mode'*)"
 ];
 
 var configure_instance_sql = [
     "select @@port, @@datadir",
     "SELECT DISTINCT grantee FROM information_schema.user_privileges WHERE grantee like",
-    "show GLOBAL variables where `variable_name` in ('binlog_format')",
+    "show GLOBAL variables where `variable_name` in (*'binlog_format'*)",
 ];
 
 var create_cluster_sql = [
@@ -34,7 +34,7 @@ var create_cluster_adopt_sql = [
 
 var add_instance_sql = [
     "select cluster_type, instance_type from `mysql_innodb_cluster_metadata`.v2_this_instance",
-    "show GLOBAL variables where `variable_name` in ('group_replication_ssl_mode')",
+    "show GLOBAL variables where `variable_name` in (*'group_replication_ssl_mode'*)",
     "show GLOBAL variables where `variable_name` in ('server_id')",
     "CREATE USER IF NOT EXISTS '*'@'%' IDENTIFIED BY **** PASSWORD EXPIRE NEVER",
     "SET * `group_replication_single_primary_mode` = 'ON'",
@@ -59,7 +59,7 @@ var get_cluster_sql = [
 var status_sql = [
     "select count(*) from performance_schema.replication_group_members where MEMBER_ID = @@server_uuid AND MEMBER_STATE NOT IN ('OFFLINE', 'UNREACHABLE')",
     "SELECT ",
-    "show GLOBAL variables where `variable_name` in ('super_read_only')",
+    "show GLOBAL variables where `variable_name` in (*'super_read_only'*)",
     "INSERT *"
 ];
 
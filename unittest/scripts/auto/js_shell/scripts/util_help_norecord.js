@@ -87,3 +87,9 @@ util.help('loadDump');
 
 //@ util loadDump help, \? [USE:util loadDump help]
 \? loadDump
+
+//@ util replayWorkload help
+util.help('replayWorkload');
+
+//@ util replayWorkload help, \? [USE:util replayWorkload help]
+\? replayWorkload
@@ -108,6 +108,12 @@ The following operations are available at 'util':
    load-dump
       Loads database dumps created by MySQL Shell.
 
+   replay-workload
+      Replays the workload captured using the --capture-workload command line
+      option and reports the statistics of the executed statements. Requires an
+      open global Shell session to the target instance, if there is none, an
+      exception is raised.
+
 //@<OUT> CLI --help Unexisting Objects
 ERROR: There is no object registered under name 'test'
 ERROR: There is no object registered under name 'test.wex'
@@ -1001,6 +1007,11 @@ OPTIONS
             accounts with the given user name are included. By default, all
             users are included. Default: not set.
 
+--incrementalFrom=<str>
+            Location of a complete dump of this instance. If set, an
+            incremental dump is created, which holds only the changes recorded
+            in the binary log since that dump was created. Default: not set.
+
 //@<OUT> CLI util dump-schemas --help
 NAME
       dump-schemas - Dumps the specified schemas to the files in the output
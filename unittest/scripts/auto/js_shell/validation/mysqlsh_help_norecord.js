@@ -261,6 +261,24 @@ Usage: mysqlsh [OPTIONS] [URI]
                                    value of 2 will prevent printing any
                                    information unless it is an error. If no
                                    value is specified uses 1 as default.
+  --capture-workload=<path>        Captures SQL statements executed by all
+                                   sessions opened by the shell, together with
+                                   their timing, and writes them to the given
+                                   file. The file can be replayed using
+                                   util.replayWorkload(). Text of statements
+                                   matching the logSql.ignorePatternUnsafe
+                                   option is not written.
+  --daemon=<path>                  Runs the shell as a daemon, which listens
+                                   for requests on the given UNIX socket.
+                                   Interpreters, plugins and sessions are kept
+                                   open between the requests.
+  --use-daemon=<path>              Forwards the code given with --execute or
+                                   read from the standard input, or the command
+                                   line operation, to the daemon listening on
+                                   the given UNIX socket, and prints its
+                                   output.
+  --startup-profile                Prints the time spent in each of the
+                                   initialization stages of the shell.
   --credential-store-helper=<h>    Specifies the helper which is going to be
                                    used to store/retrieve the passwords.
   --save-passwords=<value>         Controls automatic storage of passwords.
@@ -196,7 +196,7 @@ DESCRIPTION
       - ssh.configFile string path default empty, custom path for SSH
         configuration. If not defined the standard SSH paths will be used
         (~/.ssh/config).
-      - ssh.bufferSize integer default 10240 bytes, used for tunnel data
+      - ssh.bufferSize integer default 65536 bytes, used for tunnel data
         transfer
 
       The resultFormat option supports the following values to modify the
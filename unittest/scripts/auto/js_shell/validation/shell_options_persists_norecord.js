@@ -334,7 +334,7 @@
  sandboxDir                      <<<_defaultSandboxDir>>>
  showColumnTypeInfo              false
  showWarnings                    true
- ssh.bufferSize                  10240
+ ssh.bufferSize                  65536
  ssh.configFile                  ""
  useWizards                      true
  verbose                         0
@@ -374,7 +374,7 @@
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showColumnTypeInfo              false (Compiled default)
  showWarnings                    true (Compiled default)
- ssh.bufferSize                  10240 (Compiled default)
+ ssh.bufferSize                  65536 (Compiled default)
  ssh.configFile                  "" (Compiled default)
  useWizards                      true (Compiled default)
  verbose                         0 (Compiled default)
@@ -495,7 +495,7 @@
  sandboxDir                      <<<_defaultSandboxDir>>>
  showColumnTypeInfo              false
  showWarnings                    true
- ssh.bufferSize                  10240
+ ssh.bufferSize                  65536
  ssh.configFile                  ""
  useWizards                      true
  verbose                         0
@@ -536,7 +536,7 @@ Switching to SQL mode... Commands end with ;
  sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
  showColumnTypeInfo              false (Compiled default)
  showWarnings                    true (Compiled default)
- ssh.bufferSize                  10240 (Compiled default)
+ ssh.bufferSize                  65536 (Compiled default)
  ssh.configFile                  "" (Compiled default)
  useWizards                      true (Compiled default)
  verbose                         0 (Compiled default)
@@ -549,7 +549,7 @@ Switching to SQL mode... Commands end with ;
     "ssh.bufferSize": "10250"
 }
 
-10240
+65536
 
 //@<OUT> Verify options persistence WL#14246 TSFR_10_6
 /path/config
@@ -559,4 +559,4 @@ Switching to SQL mode... Commands end with ;
     "ssh.bufferSize": "10250"
 }
 
-10240
+65536
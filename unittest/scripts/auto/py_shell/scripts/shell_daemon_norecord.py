@@ -0,0 +1,95 @@
+#@ {__os_type != "windows"}
+#@<> Initialization
+import os
+import socket
+import stat
+import tempfile
+import time
+
+socket_dir = tempfile.mkdtemp()
+socket_path = os.path.join(socket_dir, "daemon.sock")
+
+def start_daemon(additional_args = []):
+    pid = testutil.call_mysqlsh_async(["--quiet-start=2", "--py", "--daemon=" + socket_path] + additional_args, "", ["MYSQLSH_TERM_COLOR_MODE=nocolor"])
+    for i in range(300):
+        try:
+            with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as s:
+                s.connect(socket_path)
+            return pid
+        except OSError:
+            time.sleep(0.1)
+    testutil.wait_mysqlsh_async(pid, 0)
+    raise Exception("The daemon did not start")
+
+def stop_daemon(pid):
+    # daemon runs until it's interrupted
+    testutil.wait_mysqlsh_async(pid, 0)
+    if os.path.exists(socket_path):
+        os.remove(socket_path)
+
+def forward(code, additional_args = []):
+    WIPE_OUTPUT()
+    return testutil.call_mysqlsh(["--quiet-start=2", "--py", "--use-daemon=" + socket_path, "-e", code] + additional_args, "", ["MYSQLSH_TERM_COLOR_MODE=nocolor"])
+
+testutil.deploy_sandbox(__mysql_sandbox_port1, 'root')
+
+#@<> a path which is not a socket is not removed
+with open(socket_path, "w") as f:
+    f.write("data")
+
+WIPE_OUTPUT()
+EXPECT_NE(0, testutil.call_mysqlsh(["--quiet-start=2", "--py", "--daemon=" + socket_path], "", ["MYSQLSH_TERM_COLOR_MODE=nocolor"]))
+EXPECT_STDOUT_CONTAINS(f"The path '{socket_path}' already exists and it is not a UNIX socket.")
+
+with open(socket_path) as f:
+    EXPECT_EQ("data", f.read())
+
+os.remove(socket_path)
+
+#@<> socket is accessible only by its owner
+pid = start_daemon()
+
+EXPECT_TRUE(stat.S_ISSOCK(os.lstat(socket_path).st_mode))
+EXPECT_EQ(stat.S_IRUSR | stat.S_IWUSR, stat.S_IMODE(os.lstat(socket_path).st_mode))
+
+#@<> requests are forwarded to the daemon
+EXPECT_EQ(0, forward("print('value:', 6 * 7)"))
+EXPECT_STDOUT_CONTAINS("value: 42")
+
+EXPECT_EQ(0, forward("print('port:', session.run_sql('SELECT @@port').fetch_one()[0])", [__sandbox_uri1]))
+EXPECT_STDOUT_CONTAINS(f"port: {__mysql_sandbox_port1}")
+
+EXPECT_NE(0, forward("raise Exception('request failed')"))
+EXPECT_STDOUT_CONTAINS("request failed")
+
+#@<> session used by the previous request is not visible to the next one
+EXPECT_EQ(0, forward("print('session:', shell.get_session())", [__sandbox_uri1]))
+EXPECT_STDOUT_CONTAINS("session: <ClassicSession:root@localhost:")
+
+EXPECT_EQ(0, forward("print('session:', shell.get_session())"))
+EXPECT_STDOUT_CONTAINS("session: None")
+
+#@<> session opened by the previous request is not visible to the next one
+EXPECT_EQ(0, forward(f"shell.connect('{__sandbox_uri1}'); print('session:', shell.get_session())"))
+EXPECT_STDOUT_CONTAINS("session: <ClassicSession:root@localhost:")
+
+EXPECT_EQ(0, forward("print('session:', shell.get_session())"))
+EXPECT_STDOUT_CONTAINS("session: None")
+
+#@<> stop the daemon
+stop_daemon(pid)
+
+#@<> requests without a connection use the default session
+pid = start_daemon([__sandbox_uri1])
+
+EXPECT_EQ(0, forward(f"shell.set_session(shell.open_session('{__sandbox_uri1}/mysql')); print('schema:', shell.get_session().get_current_schema())"))
+EXPECT_STDOUT_CONTAINS("schema: <Schema:mysql>")
+
+EXPECT_EQ(0, forward("print('schema:', shell.get_session().get_current_schema())"))
+EXPECT_STDOUT_CONTAINS("schema: None")
+
+stop_daemon(pid)
+
+#@<> Cleanup
+testutil.rmdir(socket_dir, True)
+testutil.destroy_sandbox(__mysql_sandbox_port1)
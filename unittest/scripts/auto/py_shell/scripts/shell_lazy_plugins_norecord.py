@@ -0,0 +1,89 @@
+#@<> Initialization
+import os
+
+user_path = os.path.join(__tmp_dir, "lazy_plugins_home")
+plugins_path = os.path.join(user_path, "plugins")
+lazy_plugin_path = os.path.join(plugins_path, "lazy_tester")
+noisy_plugin_path = os.path.join(plugins_path, "noisy_tester")
+marker_path = os.path.join(user_path, "lazy_tester.loaded")
+
+testutil.mkdir(lazy_plugin_path, True)
+testutil.mkdir(noisy_plugin_path, True)
+
+def write_file(path, contents):
+    with open(path, "w") as f:
+        f.write(contents)
+
+def load_count():
+    if not os.path.exists(marker_path):
+        return 0
+    with open(marker_path) as f:
+        return len(f.readlines())
+
+def call_mysqlsh(code):
+    WIPE_OUTPUT()
+    return testutil.call_mysqlsh(["--quiet-start=2", "--py", "-e", code], "", ["MYSQLSH_TERM_COLOR_MODE=nocolor", "MYSQLSH_USER_CONFIG_HOME=" + user_path])
+
+write_file(os.path.join(lazy_plugin_path, "init.py"), f"""
+import os
+import sys
+
+sys.path.append(os.path.dirname(__file__))
+
+import lazy_tester_helper
+
+with open({repr(marker_path)}, "a") as f:
+    f.write("loaded\\n")
+
+obj = shell.create_extension_object()
+shell.add_extension_object_member(obj, "hello", lambda: "hello from " + lazy_tester_helper.name, {{ "brief": "Says hello." }})
+shell.register_global("lazy_tester", obj, {{ "brief": "Lazily loaded plugin." }})
+""")
+
+write_file(os.path.join(lazy_plugin_path, "lazy_tester_helper.py"), 'name = "lazy plugin"\n')
+
+write_file(os.path.join(noisy_plugin_path, "init.py"), """
+print("noisy plugin was loaded")
+
+obj = shell.create_extension_object()
+shell.add_extension_object_member(obj, "hello", lambda: "hello from noisy plugin", { "brief": "Says hello." })
+shell.register_global("noisy_tester", obj, { "brief": "Plugin with side effects." })
+""")
+
+#@<> plugins are loaded when the manifest does not exist
+EXPECT_EQ(0, call_mysqlsh("print('done')"))
+EXPECT_STDOUT_CONTAINS("noisy plugin was loaded")
+EXPECT_EQ(1, load_count())
+EXPECT_TRUE(os.path.isfile(os.path.join(user_path, "plugin_manifest.json")))
+
+#@<> plugin which only registers globals is not loaded until it is used
+EXPECT_EQ(0, call_mysqlsh("print('done')"))
+EXPECT_EQ(1, load_count())
+
+EXPECT_EQ(0, call_mysqlsh("print(lazy_tester.hello())"))
+EXPECT_STDOUT_CONTAINS("hello from lazy plugin")
+EXPECT_EQ(2, load_count())
+
+#@<> plugin which prints something is always loaded
+EXPECT_EQ(0, call_mysqlsh("print('done')"))
+EXPECT_STDOUT_CONTAINS("noisy plugin was loaded")
+
+EXPECT_EQ(0, call_mysqlsh("print(noisy_tester.hello())"))
+EXPECT_STDOUT_CONTAINS("noisy plugin was loaded")
+EXPECT_STDOUT_CONTAINS("hello from noisy plugin")
+
+#@<> modification of any file of a plugin invalidates the manifest
+write_file(os.path.join(lazy_plugin_path, "lazy_tester_helper.py"), 'name = "modified lazy plugin"\n')
+
+EXPECT_EQ(0, call_mysqlsh("print('done')"))
+EXPECT_EQ(3, load_count())
+
+EXPECT_EQ(0, call_mysqlsh("print('done')"))
+EXPECT_EQ(3, load_count())
+
+EXPECT_EQ(0, call_mysqlsh("print(lazy_tester.hello())"))
+EXPECT_STDOUT_CONTAINS("hello from modified lazy plugin")
+EXPECT_EQ(4, load_count())
+
+#@<> Cleanup
+testutil.rmdir(user_path, True)
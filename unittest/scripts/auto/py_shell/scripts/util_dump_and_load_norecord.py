@@ -2168,6 +2168,17 @@ for threads in [2, 4, 8]:
 
 testutil.dbug_set("")
 
+#@<> indexBuildMemory - invalid values {(not __dbug_off)}
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "indexBuildMemory": 1234 }), "TypeError: Util.load_dump: Argument #2: Option 'indexBuildMemory' is expected to be of type String, but is Integer")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "indexBuildMemory": "" }), "ValueError: Util.load_dump: Argument #2: The option 'indexBuildMemory' cannot be set to an empty string.")
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "indexBuildMemory": "1k" }), "ValueError: Util.load_dump: Argument #2: The value of 'indexBuildMemory' option must be greater than or equal to 65536 bytes.")
+
+#@<> indexBuildMemory - index builds limited by the memory budget {(not __dbug_off)}
+for memory in [ "64k", "1M", "1G" ]:
+    wipeout_server(session2)
+    EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "deferTableIndexes": "all", "indexBuildMemory": memory, "threads": 4, "loadUsers": False, "resetProgress": True, "showProgress": False }), f"load with indexBuildMemory: {memory}")
+    compare_servers(session1, session2, check_users=False)
+
 #@<> BUG#33592520 dump when --skip-grant-tables is active
 # prepare the server
 shell.connect(__sandbox_uri2)
@@ -3109,6 +3120,191 @@ EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "createInvisiblePKs": True i
 #@<> BUG#35860654 - cleanup
 session1.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
 
+#@<> disableRedoLog - setup {VER(>=8.0.21)}
+tested_schema = "tested_schema"
+tested_table = "tested_table"
+dump_dir = os.path.join(outdir, "disable_redo_log")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
+session.run_sql("CREATE SCHEMA !", [ tested_schema ])
+session.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY, data INT, KEY (data))", [ tested_schema, tested_table ])
+session.run_sql("INSERT INTO !.! VALUES (1, 1), (2, 2), (3, 3)", [ tested_schema, tested_table ])
+
+util.dump_schemas([ tested_schema ], dump_dir, { "showProgress": False })
+
+def redo_log_enabled(s):
+    return s.run_sql("SELECT VARIABLE_VALUE FROM performance_schema.global_status WHERE variable_name = 'Innodb_redo_log_enabled'").fetch_one()[0] == "ON"
+
+#@<> disableRedoLog - empty instance {VER(>=8.0.21)}
+shell.connect(__sandbox_uri2)
+wipeout_server(session2)
+WIPE_STDOUT()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "disableRedoLog": True, "deferTableIndexes": "all", "resetProgress": True, "showProgress": False }), "load should not throw")
+EXPECT_STDOUT_CONTAINS("The redo log is disabled while the dump is loaded")
+EXPECT_STDOUT_NOT_CONTAINS("The redo log is currently disabled")
+EXPECT_TRUE(redo_log_enabled(session2))
+compare_schema(session1, session2, tested_schema, check_rows=True)
+
+#@<> disableRedoLog - non-empty instance {VER(>=8.0.21)}
+session2.run_sql("DROP SCHEMA !", [ tested_schema ])
+session2.run_sql("CREATE SCHEMA existing_schema")
+WIPE_STDOUT()
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "disableRedoLog": True, "resetProgress": True, "showProgress": False }), "load should not throw")
+EXPECT_STDOUT_CONTAINS("NOTE: The redo log is not going to be disabled, the target instance is not empty, data is going to be loaded normally.")
+EXPECT_TRUE(redo_log_enabled(session2))
+
+#@<> disableRedoLog - cleanup {VER(>=8.0.21)}
+session1.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
+wipeout_server(session2)
+
+#@<> metadata snapshot - setup
+tested_schema = "tested_schema"
+tested_table = "tested_table"
+dump_dir = os.path.join(outdir, "metadata_snapshot")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
+session.run_sql("CREATE SCHEMA !", [ tested_schema ])
+session.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY, data INT)", [ tested_schema, tested_table ])
+session.run_sql("INSERT INTO !.! VALUES (1, 1), (2, 2), (3, 3)", [ tested_schema, tested_table ])
+
+util.dump_schemas([ tested_schema ], dump_dir, { "showProgress": False })
+
+#@<> metadata snapshot - contents
+snapshot_file = os.path.join(dump_dir, "@.metadata.json")
+EXPECT_TRUE(os.path.isfile(snapshot_file))
+
+with open(snapshot_file, encoding="utf-8") as f:
+    snapshot = json.load(f)["files"]
+
+EXPECT_EQ(sorted([ f"{tested_schema}.json", f"{tested_schema}@{tested_table}.json" ]), sorted(snapshot.keys()))
+
+for name, contents in snapshot.items():
+    with open(os.path.join(dump_dir, name), encoding="utf-8") as f:
+        EXPECT_EQ(json.load(f), json.loads(contents))
+
+#@<> metadata snapshot - individual metadata files are not read
+table_metadata_file = os.path.join(dump_dir, f"{tested_schema}@{tested_table}.json")
+
+with open(table_metadata_file, "w", encoding="utf-8") as f:
+    f.write("invalid")
+
+shell.connect(__sandbox_uri2)
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "resetProgress": True, "showProgress": False }), "load should not throw")
+EXPECT_SHELL_LOG_CONTAINS("Loaded metadata snapshot with 2 files")
+compare_schema(session1, session2, tested_schema, check_rows=True)
+
+#@<> metadata snapshot - fallback to individual metadata files
+os.remove(snapshot_file)
+wipeout_server(session2)
+
+EXPECT_THROWS(lambda: util.load_dump(dump_dir, { "resetProgress": True, "showProgress": False }), f"Could not parse metadata file {tested_schema}@{tested_table}.json")
+
+#@<> metadata snapshot - cleanup
+session1.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
+wipeout_server(session2)
+
+#@<> incremental dump - setup {VER(>=8.0.0)}
+tested_schema = "incremental_dump"
+tested_table = "data"
+excluded_table = "excluded"
+base_dir = os.path.join(outdir, "incremental_base")
+incremental_dir = os.path.join(outdir, "incremental_changes")
+invalid_dir = os.path.join(outdir, "incremental_invalid")
+
+session1.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
+session1.run_sql("CREATE SCHEMA !", [ tested_schema ])
+session1.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY, data TEXT)", [ tested_schema, tested_table ])
+session1.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY)", [ tested_schema, excluded_table ])
+session1.run_sql("INSERT INTO !.! VALUES (1, 'one'), (2, 'two')", [ tested_schema, tested_table ])
+
+shell.connect(__sandbox_uri1)
+EXPECT_NO_THROWS(lambda: util.dump_instance(base_dir, { "includeSchemas": [ tested_schema ], "users": False, "showProgress": False }), "base dump should not throw")
+
+#@<> incremental dump - dump the changes {VER(>=8.0.0)}
+session1.run_sql("INSERT INTO !.! VALUES (3, 'three')", [ tested_schema, tested_table ])
+session1.run_sql("UPDATE !.! SET data = 'TWO' WHERE id = 2", [ tested_schema, tested_table ])
+session1.run_sql("DELETE FROM !.! WHERE id = 1", [ tested_schema, tested_table ])
+session1.run_sql("ALTER TABLE !.! ADD COLUMN extra INT", [ tested_schema, tested_table ])
+session1.run_sql("INSERT INTO !.! VALUES (4, 'four', 4)", [ tested_schema, tested_table ])
+session1.run_sql("INSERT INTO !.! VALUES (1)", [ tested_schema, excluded_table ])
+
+EXPECT_NO_THROWS(lambda: util.dump_instance(incremental_dir, { "incrementalFrom": base_dir, "showProgress": False }), "incremental dump should not throw")
+EXPECT_TRUE(any(f.startswith("@.binlog.") for f in os.listdir(incremental_dir)))
+
+#@<> incremental dump - load the base and the changes {VER(>=8.0.0)}
+shell.connect(__sandbox_uri2)
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.load_dump(base_dir, { "showProgress": False }), "loading the base dump should not throw")
+EXPECT_NO_THROWS(lambda: util.load_dump(incremental_dir, { "excludeTables": [ f"{tested_schema}.{excluded_table}" ], "showProgress": False }), "loading the incremental dump should not throw")
+EXPECT_STDOUT_CONTAINS("Applying changes from")
+
+compare_query_results(session1, session2, "SELECT * FROM !.!", [ tested_schema, tested_table ])
+# changes to the excluded table are skipped
+EXPECT_EQ(0, session2.run_sql("SELECT COUNT(*) FROM !.!", [ tested_schema, excluded_table ]).fetch_one()[0])
+
+#@<> incremental dump - changes are not applied twice {VER(>=8.0.0)}
+WIPE_STDOUT()
+EXPECT_NO_THROWS(lambda: util.load_dump(incremental_dir, { "excludeTables": [ f"{tested_schema}.{excluded_table}" ], "showProgress": False }), "loading the incremental dump again should not throw")
+compare_query_results(session1, session2, "SELECT * FROM !.!", [ tested_schema, tested_table ])
+
+#@<> incremental dump - statement-based changes are rejected {VER(>=8.0.0)}
+session1.run_sql("SET SESSION binlog_format = 'STATEMENT'")
+session1.run_sql("INSERT INTO !.! VALUES (5, 'five', 5)", [ tested_schema, tested_table ])
+session1.run_sql("SET SESSION binlog_format = 'ROW'")
+
+shell.connect(__sandbox_uri1)
+EXPECT_THROWS(lambda: util.dump_instance(invalid_dir, { "incrementalFrom": incremental_dir, "showProgress": False }), "statement-based format")
+
+#@<> incremental dump - cleanup {VER(>=8.0.0)}
+session1.run_sql("DROP SCHEMA IF EXISTS !", [ tested_schema ])
+wipeout_server(session2)
+
+#@<> deduplicated DDL - setup
+tested_schemas = [ "tenant_1", "tenant_2", "tenant_3" ]
+tested_table = "orders"
+dump_dir = os.path.join(outdir, "deduplicated_ddl")
+
+for schema in tested_schemas:
+    session1.run_sql("DROP SCHEMA IF EXISTS !", [ schema ])
+    session1.run_sql("CREATE SCHEMA !", [ schema ])
+    session1.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY, customer VARCHAR(64), amount DECIMAL(10,2), KEY (customer))", [ schema, tested_table ])
+    session1.run_sql("INSERT INTO !.! VALUES (1, ?, 1.5), (2, ?, 2.5)", [ schema, tested_table, schema + "-one", schema + "-two" ])
+
+#@<> deduplicated DDL - dump
+shell.connect(__sandbox_uri1)
+EXPECT_NO_THROWS(lambda: util.dump_schemas(tested_schemas, dump_dir, { "deduplicateDdl": True, "showProgress": False }), "dump should not throw")
+
+# all tables share the same definition, it is written only once
+ddl_files = [ f for f in os.listdir(dump_dir) if f.startswith("@.ddl.") ]
+EXPECT_EQ(1, len(ddl_files), f"DDL files: {ddl_files}")
+EXPECT_TRUE(ddl_files[0].endswith(".sql"), f"DDL file: {ddl_files[0]}")
+
+for schema in tested_schemas:
+    EXPECT_FALSE(os.path.exists(os.path.join(dump_dir, encode_table_basename(schema, tested_table) + ".sql")), f"DDL of {schema}.{tested_table} should not be written")
+
+#@<> deduplicated DDL - load
+shell.connect(__sandbox_uri2)
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "showProgress": False }), "load should not throw")
+
+for schema in tested_schemas:
+    EXPECT_EQ(session1.run_sql("SHOW CREATE TABLE !.!", [ schema, tested_table ]).fetch_one()[1], session2.run_sql("SHOW CREATE TABLE !.!", [ schema, tested_table ]).fetch_one()[1], f"definition of {schema}.{tested_table}")
+    compare_query_results(session1, session2, "SELECT * FROM !.!", [ schema, tested_table ])
+
+#@<> deduplicated DDL - cleanup
+for schema in tested_schemas:
+    session1.run_sql("DROP SCHEMA IF EXISTS !", [ schema ])
+
+wipeout_server(session2)
+
 #@<> Cleanup
 testutil.destroy_sandbox(__mysql_sandbox_port1)
 testutil.destroy_sandbox(__mysql_sandbox_port2)
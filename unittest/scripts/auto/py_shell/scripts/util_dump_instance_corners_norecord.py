@@ -104,5 +104,48 @@ CHECK_OUTPUT_SANITY(dump_dir, min_chunk_size = row_length, min_chunks = rows)
 #@<> BUG#32955616 - cleanup
 session.run_sql("DROP SCHEMA !;", [ tested_schema ])
 
+#@<> small tables - setup
+tested_schema = "small_tables"
+chunk_size = 128 * 1024
+
+session.run_sql("CREATE SCHEMA !;", [ tested_schema ])
+
+# statistics are not updated automatically
+for table in [ "small", "stale" ]:
+    session.run_sql("CREATE TABLE !.! (id INT AUTO_INCREMENT PRIMARY KEY, data VARCHAR(100)) STATS_PERSISTENT=1 STATS_AUTO_RECALC=0", [ tested_schema, table ])
+    session.run_sql("INSERT INTO !.! (data) SELECT REPEAT('x', 100) FROM (WITH RECURSIVE s (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM s WHERE n < 10) SELECT n FROM s) AS r", [ tested_schema, table ])
+    session.run_sql("ANALYZE TABLE !.!;", [ tested_schema, table ])
+
+# table holds much more rows than its statistics say
+session.run_sql("SET @@cte_max_recursion_depth = 100000")
+session.run_sql("INSERT INTO !.! (data) SELECT REPEAT('x', 100) FROM (WITH RECURSIVE s (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM s WHERE n < 20000) SELECT n FROM s) AS r", [ tested_schema, "stale" ])
+session.run_sql("SET @@cte_max_recursion_depth = DEFAULT")
+
+EXPECT_EQ(10, session.run_sql("SELECT TABLE_ROWS FROM information_schema.tables WHERE TABLE_SCHEMA = ? AND TABLE_NAME = ?", [ tested_schema, "stale" ]).fetch_one()[0])
+
+def data_files(table):
+    basename = encode_table_basename(tested_schema, table) + "@"
+    return sorted([f for f in os.listdir(dump_dir) if f.startswith(basename) and f.endswith(".tsv")])
+
+#@<> small tables - test
+dump_dir = os.path.join(dumpdir, "small_tables")
+util.dump_schemas([ tested_schema ], dump_dir, { "bytesPerChunk": str(chunk_size), "compression": "none" })
+
+# small table is written as a single chunk
+EXPECT_EQ([ encode_table_basename(tested_schema, "small") + "@@0.tsv" ], data_files("small"))
+
+# stale statistics do not prevent the table from being chunked
+EXPECT_LT(1, len(data_files("stale")))
+
+#@<> small tables - load
+session.run_sql("DROP SCHEMA !;", [ tested_schema ])
+util.load_dump(dump_dir, { "showProgress": False })
+
+EXPECT_EQ(10, session.run_sql("SELECT COUNT(*) FROM !.!", [ tested_schema, "small" ]).fetch_one()[0])
+EXPECT_EQ(20010, session.run_sql("SELECT COUNT(*) FROM !.!", [ tested_schema, "stale" ]).fetch_one()[0])
+
+#@<> small tables - cleanup
+session.run_sql("DROP SCHEMA !;", [ tested_schema ])
+
 #@<> cleanup
 testutil.destroy_sandbox(__mysql_sandbox_port1)
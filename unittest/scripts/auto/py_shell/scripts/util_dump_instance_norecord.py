@@ -1186,6 +1186,16 @@ session.run_sql("UNLOCK TABLES")
 # WL13807-TSFR4_26
 EXPECT_SUCCESS([test_schema], test_output_absolute, { "ddlOnly": True, "showProgress": False })
 
+#@<> dry run reports the estimated critical path
+EXPECT_SUCCESS([test_schema], test_output_absolute, { "dryRun": True, "threads": 4, "showProgress": False })
+EXPECT_STDOUT_CONTAINS("Estimated size of data to be dumped: ")
+EXPECT_STDOUT_CONTAINS(", using 4 threads.")
+EXPECT_STDOUT_CONTAINS("Estimated critical path: ")
+
+#@<> dry run does not report the critical path if data is not dumped
+EXPECT_SUCCESS([test_schema], test_output_absolute, { "dryRun": True, "ddlOnly": True, "showProgress": False })
+EXPECT_STDOUT_NOT_CONTAINS("Estimated critical path: ")
+
 #@<> WL13807-FR4.10 - The `options` dictionary may contain a `users` key with a Boolean value, which specifies whether to include users, roles and grants in the DDL file.
 # WL13807-TSFR4_31
 TEST_BOOL_OPTION("users")
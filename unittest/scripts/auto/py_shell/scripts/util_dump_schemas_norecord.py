@@ -2743,6 +2743,28 @@ EXPECT_TRUE(test_table_unique_null in checksums["data"][schema_name])
 EXPECT_SUCCESS([ schema_name ], test_output_absolute, { "dryRun": True, "checksum": True, "includeTables": [ quote_identifier(schema_name, test_table_unique_null) ], "showProgress": False })
 EXPECT_STDOUT_CONTAINS("Checksumming enabled.")
 
+#@<> dataChecksum - option type
+TEST_BOOL_OPTION("dataChecksum")
+
+#@<> dataChecksum - checksums of data files are written and verified
+EXPECT_SUCCESS([ schema_name ], test_output_absolute, { "dataChecksum": True, "compression": "none", "includeTables": [ quote_identifier(schema_name, test_table_primary) ], "showProgress": False })
+EXPECT_STDOUT_NOT_CONTAINS("Checksum")
+EXPECT_FALSE(os.path.isfile(checksum_file))
+
+done = read_json(os.path.join(test_output_absolute, "@.done.json"))
+EXPECT_EQ("xxh64", done["chunkFileChecksumAlgorithm"])
+EXPECT_EQ(sorted(done["chunkFileBytes"].keys()), sorted(done["chunkFileChecksums"].keys()))
+
+TEST_LOAD(schema_name, test_table_primary)
+
+#@<> dataChecksum - corrupted data file is detected
+with open(os.path.join(test_output_absolute, sorted(done["chunkFileChecksums"].keys())[0]), "a") as f:
+    f.write("\n")
+
+recreate_verification_schema()
+EXPECT_THROWS(lambda: util.load_dump(test_output_absolute, { "showProgress": False, "loadUsers": False, "includeTables" : [ quote_identifier(schema_name, test_table_primary) ], "schema": verification_schema, "resetProgress": True }), "Error loading dump")
+EXPECT_STDOUT_CONTAINS("Checksum mismatch of data file")
+
 #@<> WL15947 - cleanup
 session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
 
@@ -1320,6 +1320,61 @@ TEST_LOAD(schema_name, test_view, { "where": "id > 12345" }, source_table = no_p
 #@<> WL15311 - cleanup
 session.run_sql("DROP SCHEMA !;", [schema_name])
 
+#@<> parallel export - setup
+parallel_schema = "parallel_export"
+parallel_table = "data"
+
+session.run_sql("DROP SCHEMA IF EXISTS !", [parallel_schema])
+session.run_sql("CREATE SCHEMA !", [parallel_schema])
+session.run_sql("CREATE TABLE !.! (`id` INT PRIMARY KEY, `data` VARCHAR(200), `info` JSON)", [parallel_schema, parallel_table])
+session.run_sql("INSERT INTO !.! VALUES " + ",".join([f"({i}, REPEAT(MD5({i}), 5), JSON_OBJECT('id', {i}))" for i in range(1, 1001)]), [parallel_schema, parallel_table])
+
+for i in range(7):
+    session.run_sql("INSERT INTO !.! SELECT `id` + (SELECT MAX(`id`) FROM !.! AS `m`), REVERSE(`data`), `info` FROM !.!", [parallel_schema, parallel_table, parallel_schema, parallel_table, parallel_schema, parallel_table])
+
+session.run_sql("CREATE TABLE !.! LIKE !.!", [parallel_schema, "no_index", parallel_schema, parallel_table])
+session.run_sql("ALTER TABLE !.! DROP PRIMARY KEY", [parallel_schema, "no_index"])
+session.run_sql("INSERT INTO !.! SELECT * FROM !.! WHERE `id` <= 1000", [parallel_schema, "no_index", parallel_schema, parallel_table])
+session.run_sql("CREATE TABLE !.! (`id` INT PRIMARY KEY, `data` VARCHAR(200), `info` JSON) PARTITION BY RANGE (`id`) (PARTITION p0 VALUES LESS THAN (32001), PARTITION p1 VALUES LESS THAN (64001), PARTITION p2 VALUES LESS THAN (96001), PARTITION p3 VALUES LESS THAN MAXVALUE)", [parallel_schema, "partitioned"])
+session.run_sql("INSERT INTO !.! SELECT * FROM !.!", [parallel_schema, "partitioned", parallel_schema, parallel_table])
+session.run_sql("ANALYZE TABLE !.!, !.!, !.!", [parallel_schema, parallel_table, parallel_schema, "no_index", parallel_schema, "partitioned"])
+
+def export_hash(table, options):
+    run_options = { "showProgress": False }
+    run_options.update(options)
+    EXPECT_SUCCESS(quote(parallel_schema, table), test_output_absolute, run_options)
+    return hash_file(test_output_absolute)
+
+#@<> parallel export - ordered chunks produce the same file as a single thread
+for options in [{}, { "dialect": "csv" }, { "dialect": "json" }, { "where": "`id` % 3 = 0" }]:
+    print("---> testing options:", options)
+    single = export_hash(parallel_table, options)
+    for threads in [2, 8]:
+        parallel_options = { "threads": threads, "bytesPerChunk": "128k" }
+        parallel_options.update(options)
+        EXPECT_EQ(single, export_hash(parallel_table, parallel_options), f"threads: {threads}")
+
+#@<> parallel export - table without an index is exported using a single thread
+EXPECT_EQ(export_hash("no_index", {}), export_hash("no_index", { "threads": 4, "bytesPerChunk": "128k" }))
+
+#@<> parallel export - partitioned table produces the same file as a single thread
+for options in [{}, { "partitions": ["p1"] }, { "partitions": ["p0", "p2"] }, { "partitions": ["p0", "p1", "p2", "p3"] }, { "partitions": ["p1", "p3"], "where": "`id` % 3 = 0" }]:
+    print("---> testing options:", options)
+    single = export_hash("partitioned", options)
+    for threads in [2, 8]:
+        parallel_options = { "threads": threads, "bytesPerChunk": "128k" }
+        parallel_options.update(options)
+        EXPECT_EQ(single, export_hash("partitioned", parallel_options), f"threads: {threads}")
+
+#@<> parallel export - data can be loaded
+TEST_LOAD(parallel_schema, parallel_table, { "threads": 4, "bytesPerChunk": "128k" })
+TEST_LOAD(parallel_schema, "partitioned", { "threads": 4, "bytesPerChunk": "128k" })
+TEST_LOAD(parallel_schema, "partitioned", { "partitions": ["p1"], "threads": 4, "bytesPerChunk": "128k" })
+TEST_LOAD(parallel_schema, "partitioned", { "partitions": ["p0", "p2"], "threads": 4, "bytesPerChunk": "128k" })
+
+#@<> parallel export - cleanup
+session.run_sql("DROP SCHEMA !", [parallel_schema])
+
 #@<> Cleanup
 drop_all_schemas()
 session.run_sql("SET GLOBAL local_infile = false;")
@@ -88,6 +88,12 @@ util.help('load_dump')
 #@ util load_dump help, \? [USE:util load_dump help]
 \? load_dump
 
+#@ util replay_workload help
+util.help('replay_workload')
+
+#@ util replay_workload help, \? [USE:util replay_workload help]
+\? replay_workload
+
 #@ util debug collect_diagnostics (full path)
 \? util.debug.collect_diagnostics
 
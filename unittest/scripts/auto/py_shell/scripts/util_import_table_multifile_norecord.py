@@ -162,6 +162,16 @@ EXPECT_STDOUT_CONTAINS(gz_files[0] + ": Records: 100  Deleted: 0  Skipped: 0  Wa
 EXPECT_STDOUT_CONTAINS("3 files (7.48 KB uncompressed, 3.77 KB compressed) were imported in ")
 EXPECT_STDOUT_CONTAINS("Total rows affected in " + target_schema + ".lorem: Records: 300  Deleted: 0  Skipped: 0  Warnings: 0")
 
+#@<> Compressed files are decompressed in background and loaded in chunks when there are fewer of them than threads
+session.run_sql("TRUNCATE TABLE `lorem`")
+util.import_table([os.path.join(chunked_dir, zst_files[0]), os.path.join(chunked_dir, gz_files[0]), os.path.join(chunked_dir, raw_files[0])], {'schema': target_schema, 'table': 'lorem', 'threads': 4, 'skipRows': 1, 'maxBytesPerTransaction': '4096'})
+EXPECT_STDOUT_CONTAINS(zst_files[0] + ": Records: 99  Deleted: 0  Skipped: 0  Warnings: 0")
+EXPECT_STDOUT_CONTAINS(gz_files[0] + ": Records: 99  Deleted: 0  Skipped: 0  Warnings: 0")
+EXPECT_STDOUT_CONTAINS(raw_files[0] + ": Records: 99  Deleted: 0  Skipped: 0  Warnings: 0")
+EXPECT_STDOUT_CONTAINS("3 files (")
+EXPECT_STDOUT_CONTAINS("Total rows affected in " + target_schema + ".lorem: Records: 297  Deleted: 0  Skipped: 0  Warnings: 0")
+EXPECT_EQ(297, session.run_sql("SELECT COUNT(*) FROM `lorem`").fetch_one()[0])
+
 #@<> Mixed file list input
 EXPECT_THROWS(lambda: util.import_table([os.path.join(chunked_dir, "nonexisting_a.csv"), os.path.join(chunked_dir, "lorem_a*"), os.path.join(chunked_dir, "lorem_b*"), '', os.path.join(chunked_dir, zst_files[0]), os.path.join(chunked_dir, zst_files[1]), os.path.join(chunked_dir, gz_files[0])], {'schema': target_schema, 'table': 'lorem', 'replaceDuplicates': True}),
     "File " + filename_for_output(os.path.join(chunked_dir, "nonexisting_a.csv")) + " does not exist."
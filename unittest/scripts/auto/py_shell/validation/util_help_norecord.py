@@ -58,6 +58,12 @@ FUNCTIONS
       load_dump(url[, options])
             Loads database dumps created by MySQL Shell.
 
+      replay_workload(path[, options])
+            Replays the workload captured using the --capture-workload command
+            line option and reports the statistics of the executed statements.
+            Requires an open global Shell session to the target instance, if
+            there is none, an exception is raised.
+
 #@<OUT> util check_for_server_upgrade help
 NAME
       check_for_server_upgrade - Performs series of tests on specified MySQL
@@ -276,6 +282,13 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxMemory: string (default: "0") - Limit the memory used to store the
+        metadata and DDL of the copy, supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). If this limit is reached, the source waits
+        until the target reads the stored files. If the target needs files
+        which cannot be stored within this limit, the copy is aborted. Table
+        data is not stored in memory and is not subject to this limit. Use
+        maxMemory="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -288,6 +301,15 @@ DESCRIPTION
         "all", creation of "all" indexes except PRIMARY is deferred until after
         table data is copied, which in many cases can reduce load times. If
         "fulltext", only full-text indexes will be deferred.
+      - disableRedoLog: bool (default: false) - Disables the InnoDB redo log
+        while the copy is loaded, which significantly speeds up loading of the
+        data and recreation of the indexes. The redo log is disabled only if
+        the target instance does not contain any user schemas and the load is
+        not being resumed, otherwise data is loaded normally. The redo log is
+        enabled again once the load finishes. Requires MySQL 8.0.21 or newer
+        and the INNODB_REDO_LOG_ENABLE privilege. WARNING: if the server stops
+        unexpectedly while the redo log is disabled, the instance needs to be
+        recreated.
       - handleGrantErrors: "abort", "drop_account", "ignore" (default: abort) -
         Specifies action to be performed in case of errors related to the
         GRANT/REVOKE statements, "abort": throws an error and aborts the copy,
@@ -298,6 +320,14 @@ DESCRIPTION
       - ignoreVersion: bool (default false) - Load the copy even if the major
         version number of the server where it was created is different from
         where it will be loaded.
+      - indexBuildMemory: string (default: the value of innodb_ddl_buffer_size
+        multiplied by the number of threads) - Specifies the amount of memory
+        which can be used by all the concurrent statements which recreate the
+        deferred indexes. Each statement is given a sort buffer proportional to
+        the size of its table, and as many of them are executed in parallel as
+        fit in this amount. Supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). Minimum value: 65536. Used only if the
+        target server is 8.0.27 or newer.
       - loadIndexes: bool (default: true) - use together with deferTableIndexes
         to control whether secondary indexes should be recreated at the end of
         the copy.
@@ -401,6 +431,13 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxMemory: string (default: "0") - Limit the memory used to store the
+        metadata and DDL of the copy, supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). If this limit is reached, the source waits
+        until the target reads the stored files. If the target needs files
+        which cannot be stored within this limit, the copy is aborted. Table
+        data is not stored in memory and is not subject to this limit. Use
+        maxMemory="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -413,6 +450,15 @@ DESCRIPTION
         "all", creation of "all" indexes except PRIMARY is deferred until after
         table data is copied, which in many cases can reduce load times. If
         "fulltext", only full-text indexes will be deferred.
+      - disableRedoLog: bool (default: false) - Disables the InnoDB redo log
+        while the copy is loaded, which significantly speeds up loading of the
+        data and recreation of the indexes. The redo log is disabled only if
+        the target instance does not contain any user schemas and the load is
+        not being resumed, otherwise data is loaded normally. The redo log is
+        enabled again once the load finishes. Requires MySQL 8.0.21 or newer
+        and the INNODB_REDO_LOG_ENABLE privilege. WARNING: if the server stops
+        unexpectedly while the redo log is disabled, the instance needs to be
+        recreated.
       - handleGrantErrors: "abort", "drop_account", "ignore" (default: abort) -
         Specifies action to be performed in case of errors related to the
         GRANT/REVOKE statements, "abort": throws an error and aborts the copy,
@@ -423,6 +469,14 @@ DESCRIPTION
       - ignoreVersion: bool (default false) - Load the copy even if the major
         version number of the server where it was created is different from
         where it will be loaded.
+      - indexBuildMemory: string (default: the value of innodb_ddl_buffer_size
+        multiplied by the number of threads) - Specifies the amount of memory
+        which can be used by all the concurrent statements which recreate the
+        deferred indexes. Each statement is given a sort buffer proportional to
+        the size of its table, and as many of them are executed in parallel as
+        fit in this amount. Supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). Minimum value: 65536. Used only if the
+        target server is 8.0.27 or newer.
       - loadIndexes: bool (default: true) - use together with deferTableIndexes
         to control whether secondary indexes should be recreated at the end of
         the copy.
@@ -515,6 +569,13 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxMemory: string (default: "0") - Limit the memory used to store the
+        metadata and DDL of the copy, supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). If this limit is reached, the source waits
+        until the target reads the stored files. If the target needs files
+        which cannot be stored within this limit, the copy is aborted. Table
+        data is not stored in memory and is not subject to this limit. Use
+        maxMemory="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -527,6 +588,15 @@ DESCRIPTION
         "all", creation of "all" indexes except PRIMARY is deferred until after
         table data is copied, which in many cases can reduce load times. If
         "fulltext", only full-text indexes will be deferred.
+      - disableRedoLog: bool (default: false) - Disables the InnoDB redo log
+        while the copy is loaded, which significantly speeds up loading of the
+        data and recreation of the indexes. The redo log is disabled only if
+        the target instance does not contain any user schemas and the load is
+        not being resumed, otherwise data is loaded normally. The redo log is
+        enabled again once the load finishes. Requires MySQL 8.0.21 or newer
+        and the INNODB_REDO_LOG_ENABLE privilege. WARNING: if the server stops
+        unexpectedly while the redo log is disabled, the instance needs to be
+        recreated.
       - handleGrantErrors: "abort", "drop_account", "ignore" (default: abort) -
         Specifies action to be performed in case of errors related to the
         GRANT/REVOKE statements, "abort": throws an error and aborts the copy,
@@ -537,6 +607,14 @@ DESCRIPTION
       - ignoreVersion: bool (default false) - Load the copy even if the major
         version number of the server where it was created is different from
         where it will be loaded.
+      - indexBuildMemory: string (default: the value of innodb_ddl_buffer_size
+        multiplied by the number of threads) - Specifies the amount of memory
+        which can be used by all the concurrent statements which recreate the
+        deferred indexes. Each statement is given a sort buffer proportional to
+        the size of its table, and as many of them are executed in parallel as
+        fit in this amount. Supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). Minimum value: 65536. Used only if the
+        target server is 8.0.27 or newer.
       - loadIndexes: bool (default: true) - use together with deferTableIndexes
         to control whether secondary indexes should be recreated at the end of
         the copy.
@@ -629,6 +707,10 @@ DESCRIPTION
         specified users. Each user is in the format of 'user_name'[@'host']. If
         the host is not specified, all the accounts with the given user name
         are included. By default, all users are included.
+      - incrementalFrom: string (default: not set) - Location of a complete
+        dump of this instance. If set, an incremental dump is created, which
+        holds only the changes recorded in the binary log since that dump was
+        created.
       - triggers: bool (default: true) - Include triggers for each dumped
         table.
       - excludeTriggers: list of strings (default: empty) - List of triggers to
@@ -657,6 +739,13 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - checksum: bool (default: false) - Compute and include checksum of the
         dumped data.
+      - dataChecksum: bool (default: false) - Compute checksums of the data
+        files while they are written and include them in the dump. Unlike the
+        checksum option, this does not execute any additional queries.
+      - deduplicateDdl: bool (default: false) - Store the DDL of tables with
+        identical definitions only once, table metadata refers to the shared
+        DDL file. Dumps created with this option can be loaded by MySQL Shell
+        8.3.0 or newer.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything. If ocimds is enabled, also checks for
         compatibility issues with MySQL HeatWave Service.
@@ -757,6 +846,30 @@ DESCRIPTION
       - mysql.schema
       - mysql.slow_log
 
+      Incremental dumps
+
+      The incrementalFrom option uses the binary log position stored in the
+      base dump, and streams all the binary log events written since then, up
+      to the current position, into chunk files. The base can be either a full
+      dump or another incremental dump, allowing to create a chain of dumps.
+      The schema and user filtering options and the users option do not apply
+      to the incremental dumps.
+
+      The incremental dump can be created only if binary logging is enabled,
+      the binlog_format system variable is set to ROW, transaction compression
+      is disabled and the binary log files were not purged since the base dump
+      was created.
+
+      The incremental dump is loaded with the util.loadDump() function into an
+      instance which already holds the contents of its base dump. The changes
+      are applied sequentially, using the BINLOG statements, which requires the
+      BINLOG_ADMIN or REPLICATION_APPLIER privilege. The schema and table
+      filtering options and the loadUsers option of the util.loadDump()
+      function apply to the changes, changes to the system schemas are skipped.
+      Statements logged using the statement-based format cannot be applied. The
+      progress is recorded after each transaction, when the load is resumed,
+      the transactions which were already applied are skipped.
+
       Dumps cannot be created for the following schemas:
 
       - information_schema,
@@ -1296,6 +1409,13 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - checksum: bool (default: false) - Compute and include checksum of the
         dumped data.
+      - dataChecksum: bool (default: false) - Compute checksums of the data
+        files while they are written and include them in the dump. Unlike the
+        checksum option, this does not execute any additional queries.
+      - deduplicateDdl: bool (default: false) - Store the DDL of tables with
+        identical definitions only once, table metadata refers to the shared
+        DDL file. Dumps created with this option can be loaded by MySQL Shell
+        8.3.0 or newer.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything. If ocimds is enabled, also checks for
         compatibility issues with MySQL HeatWave Service.
@@ -1912,6 +2032,13 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - checksum: bool (default: false) - Compute and include checksum of the
         dumped data.
+      - dataChecksum: bool (default: false) - Compute checksums of the data
+        files while they are written and include them in the dump. Unlike the
+        checksum option, this does not execute any additional queries.
+      - deduplicateDdl: bool (default: false) - Store the DDL of tables with
+        identical definitions only once, table metadata refers to the shared
+        DDL file. Dumps created with this option can be loaded by MySQL Shell
+        8.3.0 or newer.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything. If ocimds is enabled, also checks for
         compatibility issues with MySQL HeatWave Service.
@@ -2490,6 +2617,11 @@ DESCRIPTION
       - partitions: list of strings (default: not set) - A list of valid
         partition names used to limit the data export to just the specified
         partitions.
+      - threads: int (default: 1) - Use N threads to export the data from the
+        server.
+      - bytesPerChunk: string (minimum: "128k", default: "64M") - Sets average
+        estimated number of bytes to be read by each thread in a single step,
+        used only if threads is greater than 1.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -2586,6 +2718,18 @@ DESCRIPTION
 
       i.e. maxRate="2k" - limit throughput to 2000 bytes per second.
 
+      If the threads option is greater than 1 and the table has an index which
+      can be used to order its rows, the table is split into chunks using this
+      index and the chunks are read from the server in parallel. Each chunk is
+      buffered in memory until all the chunks which precede it are written, so
+      the output file has the same contents as if it was exported using a
+      single thread. Memory usage is roughly proportional to threads multiplied
+      by bytesPerChunk. If such index does not exist, or if data of more than
+      one partition is exported, the table is exported using a single thread.
+
+      Each thread uses its own session, the data is not read from a consistent
+      snapshot of the table.
+
       Dumping to a Bucket in the OCI Object Storage
 
       There are 2 ways to create a dump in OCI Object Storage:
@@ -3241,6 +3385,11 @@ DESCRIPTION
       If you specify one separator that is the same as or a prefix of another,
       LOAD DATA INFILE cannot interpret the input properly.
 
+      When importing multiple files and there are fewer compressed files than
+      threads, these files are decompressed in background threads, split into
+      chunks and loaded by all threads. Size of a chunk is set by the
+      maxBytesPerTransaction option, or is 50M if this option is not set.
+
       Connection options set in the global session, such as compression,
       ssl-mode, etc. are used in parallel connections.
 
@@ -3301,6 +3450,11 @@ DESCRIPTION
       LOAD DATA LOCAL INFILE is used to load table data and thus, the
       'local_infile' MySQL global setting must be enabled.
 
+      If the dump was created with the 'dataChecksum' option enabled, checksums
+      of the data files are verified while they are loaded. If a mismatch is
+      detected, the load is aborted. Chunks which are resumed from the middle of
+      a file are not verified.
+
       Resuming
 
       The load command will store progress information into a file for each
@@ -3357,6 +3511,15 @@ DESCRIPTION
         "all", creation of "all" indexes except PRIMARY is deferred until after
         table data is loaded, which in many cases can reduce load times. If
         "fulltext", only full-text indexes will be deferred.
+      - disableRedoLog: bool (default: false) - Disables the InnoDB redo log
+        while the dump is loaded, which significantly speeds up loading of the
+        data and recreation of the indexes. The redo log is disabled only if
+        the target instance does not contain any user schemas and the load is
+        not being resumed, otherwise data is loaded normally. The redo log is
+        enabled again once the load finishes. Requires MySQL 8.0.21 or newer
+        and the INNODB_REDO_LOG_ENABLE privilege. WARNING: if the server stops
+        unexpectedly while the redo log is disabled, the instance needs to be
+        recreated.
       - dryRun: bool (default: false) - Scans the dump and prints everything
         that would be performed, without actually doing so.
       - excludeEvents: array of strings (default not set) - Skip loading
@@ -3416,6 +3579,14 @@ DESCRIPTION
         'user_name'[@'host']. If the host is not specified, all the accounts
         with the given user name are included. By default, all users are
         included.
+      - indexBuildMemory: string (default: the value of innodb_ddl_buffer_size
+        multiplied by the number of threads) - Specifies the amount of memory
+        which can be used by all the concurrent statements which recreate the
+        deferred indexes. Each statement is given a sort buffer proportional to
+        the size of its table, and as many of them are executed in parallel as
+        fit in this amount. Supports unit suffixes: k (kilobytes), M
+        (Megabytes), G (Gigabytes). Minimum value: 65536. Used only if the
+        target server is 8.0.27 or newer.
       - loadData: bool (default: true) - Loads table data from the dump.
       - loadDdl: bool (default: true) - Executes DDL/SQL scripts in the dump.
       - loadIndexes: bool (default: true) - use together with deferTableIndexes
@@ -3559,6 +3730,47 @@ DESCRIPTION
 
       util.load_dump(uri, { 'progressFile': 'load_progress.txt' })
 
+#@<OUT> util replay_workload help
+NAME
+      replay_workload - Replays the workload captured using the
+                        --capture-workload command line option and reports the
+                        statistics of the executed statements. Requires an open
+                        global Shell session to the target instance, if there
+                        is none, an exception is raised.
+
+SYNTAX
+      util.replay_workload(path[, options])
+
+WHERE
+      path: Path to the file with the captured workload.
+      options: Dictionary with the replay options.
+
+DESCRIPTION
+      Each of the captured sessions is replayed using a separate session to the
+      target instance, statements within a session are executed in the order in
+      which they were captured. The captured sessions are distributed among the
+      threads.
+
+      Once the replay is finished, statements which differ only in values of
+      literals are grouped together, and for each such group, the number of
+      executions, the total and average execution time, the 50th, 95th and 99th
+      percentiles of the latency, the maximum latency and the number of errors
+      are reported. The percentiles are estimated using histograms with
+      power-of-two buckets.
+
+      Only SQL statements are captured, CRUD operations executed using X
+      Protocol sessions are not replayed.
+
+      The following options are supported:
+
+      - threads: int (default: 4) - Maximum number of concurrently replayed
+        sessions.
+      - speedUp: float (default: 1) - Factor by which the intervals between the
+        statements are shortened. If set to 0, statements are executed as fast
+        as possible, without any delays.
+      - top: int (default: 20) - Number of statement groups with the highest
+        total execution time to be reported.
+
 #@<OUT> util debug collect_diagnostics (full path)
 NAME
       collect_diagnostics - Collects MySQL diagnostics information for
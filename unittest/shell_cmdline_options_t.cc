@@ -1675,6 +1675,46 @@ TEST_F(Shell_cmdline_options, conflicts_execute_and_file) {
   }
 }
 
+#ifndef _WIN32
+TEST_F(Shell_cmdline_options, conflicts_daemon) {
+  {
+    char *argv[] = {const_cast<char *>("ut"),
+                    const_cast<char *>("--daemon=/tmp/mysqlsh.sock"),
+                    const_cast<char *>("--use-daemon=/tmp/mysqlsh.sock"),
+                    nullptr};
+
+    test_conflicting_options(
+        "--daemon --use-daemon", 3, argv,
+        "Conflicting options: --daemon and --use-daemon cannot be used at the "
+        "same time.\n");
+  }
+
+  {
+    char *argv[] = {const_cast<char *>("ut"),
+                    const_cast<char *>("--daemon=/tmp/mysqlsh.sock"),
+                    const_cast<char *>("-e"), const_cast<char *>("SELECT 1"),
+                    nullptr};
+
+    test_conflicting_options(
+        "--daemon -e", 4, argv,
+        "The --daemon option cannot be used to execute code, it only handles "
+        "the requests forwarded using the --use-daemon option.\n");
+  }
+
+  {
+    char *argv[] = {const_cast<char *>("ut"),
+                    const_cast<char *>("--use-daemon=/tmp/mysqlsh.sock"),
+                    const_cast<char *>("-f"),
+                    const_cast<char *>("select_2.sql"), nullptr};
+
+    test_conflicting_options(
+        "--use-daemon -f", 4, argv,
+        "The --use-daemon option can be used only with --execute, the command "
+        "line operations or with the code read from the standard input.\n");
+  }
+}
+#endif  // !_WIN32
+
 TEST_F(Shell_cmdline_options, test_file_and_execute) {
   const auto test_options = [](const std::string &context, size_t argc,
                                char *argv[]) {
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "src/mysqlsh/lazy_plugins.h"
+
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "unittest/test_utils.h"
+
+namespace mysqlsh {
+
+namespace {
+
+class Lazy_target : public shcore::Cpp_object_bridge {
+ public:
+  Lazy_target() { expose("twice", &Lazy_target::twice, "value"); }
+
+  std::string class_name() const override { return "Lazy_target"; }
+
+  int twice(int value) { return 2 * value; }
+};
+
+}  // namespace
+
+class Lazy_plugins_test : public Shell_core_test_wrapper {
+ protected:
+  void SetUp() override {
+    Shell_core_test_wrapper::SetUp();
+
+    m_test_dir = shcore::path::join_path(getenv("TMPDIR"), "lazy_plugins");
+    m_plugin_dir = shcore::path::join_path(m_test_dir, "plugins", "test");
+    m_init_file = shcore::path::join_path(m_plugin_dir, "init.py");
+    m_manifest_file = shcore::path::join_path(m_test_dir, "manifest.json");
+
+    shcore::create_directory(m_plugin_dir, true);
+    shcore::create_file(m_init_file, "import helper\n");
+    shcore::create_file(plugin_file("helper.py"), "value = 1\n");
+  }
+
+  void TearDown() override {
+    shcore::remove_directory(m_test_dir, true);
+
+    Shell_core_test_wrapper::TearDown();
+  }
+
+  std::string plugin_file(const std::string &name) const {
+    return shcore::path::join_path(m_plugin_dir, name);
+  }
+
+  Plugin_manifest::Plugin plugin() const {
+    Plugin_manifest::Plugin p;
+    p.file = m_init_file;
+    p.globals = {"lazy", "eager"};
+    p.cli_globals = {"lazy"};
+    return p;
+  }
+
+  std::string m_test_dir;
+  std::string m_plugin_dir;
+  std::string m_init_file;
+  std::string m_manifest_file;
+};
+
+TEST_F(Lazy_plugins_test, manifest_store_and_load) {
+  {
+    Plugin_manifest manifest{m_manifest_file};
+    manifest.load();
+
+    EXPECT_EQ(nullptr, manifest.find(m_init_file));
+
+    manifest.store(plugin());
+
+    const auto entry = manifest.find(m_init_file);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(Plugin_manifest::signature(m_init_file), entry->signature);
+
+    manifest.save();
+  }
+
+  ASSERT_TRUE(shcore::is_file(m_manifest_file));
+
+  {
+    Plugin_manifest manifest{m_manifest_file};
+    manifest.load();
+
+    const auto entry = manifest.find(m_init_file);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(m_init_file, entry->file);
+    EXPECT_EQ(plugin().globals, entry->globals);
+    EXPECT_EQ(plugin().cli_globals, entry->cli_globals);
+    EXPECT_TRUE(entry->reports.empty());
+    EXPECT_FALSE(entry->side_effects);
+    EXPECT_TRUE(entry->lazy());
+
+    manifest.retain({});
+    EXPECT_EQ(nullptr, manifest.find(m_init_file));
+  }
+
+  // invalid manifest is ignored
+  shcore::create_file(m_manifest_file, "{\"version\":");
+
+  {
+    Plugin_manifest manifest{m_manifest_file};
+    manifest.load();
+
+    EXPECT_EQ(nullptr, manifest.find(m_init_file));
+  }
+
+  // manifest in a different version is ignored
+  shcore::create_file(m_manifest_file, "{\"version\": 1, \"plugins\": []}");
+
+  {
+    Plugin_manifest manifest{m_manifest_file};
+    manifest.load();
+
+    EXPECT_EQ(nullptr, manifest.find(m_init_file));
+  }
+}
+
+TEST_F(Lazy_plugins_test, manifest_lazy) {
+  auto p = plugin();
+  EXPECT_TRUE(p.lazy());
+
+  p.side_effects = true;
+  EXPECT_FALSE(p.lazy());
+
+  p = plugin();
+  p.reports = {"report"};
+  EXPECT_FALSE(p.lazy());
+
+  p = plugin();
+  p.globals.clear();
+  EXPECT_FALSE(p.lazy());
+}
+
+TEST_F(Lazy_plugins_test, manifest_signature) {
+  Plugin_manifest manifest{m_manifest_file};
+  manifest.store(plugin());
+  ASSERT_NE(nullptr, manifest.find(m_init_file));
+
+  // bytecode caches are written when plugin is loaded, they are ignored
+  shcore::create_directory(plugin_file("__pycache__"));
+  shcore::create_file(
+      shcore::path::join_path(plugin_file("__pycache__"), "helper.pyc"),
+      "bytecode");
+  shcore::create_file(plugin_file("init.pyc"), "bytecode");
+  EXPECT_NE(nullptr, manifest.find(m_init_file));
+
+  // modification of a file other than the init file invalidates the entry
+  shcore::create_file(plugin_file("helper.py"), "value = 12\n");
+  EXPECT_EQ(nullptr, manifest.find(m_init_file));
+
+  manifest.store(plugin());
+  ASSERT_NE(nullptr, manifest.find(m_init_file));
+
+  // so does a new file in a subdirectory
+  shcore::create_directory(plugin_file("lib"));
+  shcore::create_file(shcore::path::join_path(plugin_file("lib"), "module.py"),
+                      "");
+  EXPECT_EQ(nullptr, manifest.find(m_init_file));
+
+  manifest.store(plugin());
+  ASSERT_NE(nullptr, manifest.find(m_init_file));
+
+  // and a removed file
+  shcore::delete_file(plugin_file("helper.py"));
+  EXPECT_EQ(nullptr, manifest.find(m_init_file));
+}
+
+TEST_F(Lazy_plugins_test, output_detector) {
+  {
+    Output_detector output;
+    EXPECT_FALSE(output.detected());
+
+    current_console()->print_diag("diagnostic");
+    EXPECT_FALSE(output.detected());
+
+    current_console()->print("plugin output");
+    EXPECT_TRUE(output.detected());
+  }
+
+  // output is not consumed by the detector
+  MY_EXPECT_STDOUT_CONTAINS("plugin output");
+
+  {
+    Output_detector output;
+
+    current_console()->print_error("plugin error");
+    EXPECT_TRUE(output.detected());
+  }
+}
+
+TEST_F(Lazy_plugins_test, lazy_object) {
+  int loads = 0;
+  const auto target = std::make_shared<Lazy_target>();
+  Lazy_plugin_object object{"lazy", true, [&loads, &target]() {
+                              ++loads;
+                              return target;
+                            }};
+
+  EXPECT_TRUE(object.cli_enabled());
+  EXPECT_EQ(0, loads);
+
+  EXPECT_EQ("Lazy_target", object.class_name());
+  EXPECT_EQ(1, loads);
+
+  EXPECT_TRUE(object.has_method("twice"));
+
+  shcore::Argument_list args;
+  args.push_back(shcore::Value(21));
+  EXPECT_EQ(42, object.call("twice", args).as_int());
+  EXPECT_EQ(target, object.object());
+
+  // plugin is loaded only once
+  EXPECT_EQ(1, loads);
+}
+
+TEST_F(Lazy_plugins_test, lazy_object_load_failure) {
+  int loads = 0;
+  Lazy_plugin_object object{
+      "lazy", false,
+      [&loads]() -> std::shared_ptr<shcore::Cpp_object_bridge> {
+        ++loads;
+        return nullptr;
+      }};
+
+  EXPECT_FALSE(object.cli_enabled());
+  EXPECT_THROW_LIKE(object.class_name(), std::runtime_error,
+                    "The plugin which has registered the 'lazy' global object "
+                    "could not be loaded.");
+  EXPECT_EQ(1, loads);
+}
+
+}  // namespace mysqlsh
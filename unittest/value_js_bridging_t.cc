@@ -21,8 +21,10 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <string>
 
@@ -37,6 +39,9 @@
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
 #include "test_utils.h"
+#include "utils/utils_file.h"
+#include "utils/utils_general.h"
+#include "utils/utils_path.h"
 #include "utils/utils_string.h"
 
 using namespace std::placeholders;
@@ -542,5 +547,86 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 00:00:00\"", object.repr());
 }
+
+TEST_F(JavaScript, code_cache) {
+  // cache is written to a temporary configuration directory
+  const auto config_home =
+      shcore::path::join_path(getenv("TMPDIR"), "code_cache_test_home");
+  const char *home = getenv("MYSQLSH_USER_CONFIG_HOME");
+  const auto has_home = nullptr != home;
+  const std::string previous_home = has_home ? home : "";
+
+  shcore::setenv("MYSQLSH_USER_CONFIG_HOME", config_home);
+
+  shcore::on_leave_scope restore_home([&]() {
+    if (has_home) {
+      shcore::setenv("MYSQLSH_USER_CONFIG_HOME", previous_home);
+    } else {
+      shcore::unsetenv("MYSQLSH_USER_CONFIG_HOME");
+    }
+
+    shcore::remove_directory(config_home, true);
+  });
+
+  Environment local;
+  v8::Isolate::Scope isolate_scope(local.js->isolate());
+  v8::HandleScope handle_scope(local.js->isolate());
+
+  const auto cache_dir = shcore::path::join_path(config_home, "cache", "js");
+
+  // core module is compiled when context is created
+  ASSERT_TRUE(shcore::is_folder(cache_dir));
+  const auto initial_entries = shcore::listdir(cache_dir).size();
+  EXPECT_LT(0u, initial_entries);
+
+  const auto plugin =
+      shcore::path::join_path(config_home, "code_cache_test.js");
+  shcore::create_file(plugin, "var value = 'first';\n");
+
+  ASSERT_TRUE(local.js->load_plugin({plugin, true}));
+  EXPECT_EQ(initial_entries + 1, shcore::listdir(cache_dir).size());
+
+  // entry is reused
+  ASSERT_TRUE(local.js->load_plugin({plugin, true}));
+  EXPECT_EQ(initial_entries + 1, shcore::listdir(cache_dir).size());
+
+  // corrupted entries are rejected by V8 and replaced
+  for (const auto &entry : shcore::listdir(cache_dir)) {
+    shcore::create_file(shcore::path::join_path(cache_dir, entry), "invalid",
+                        true);
+  }
+
+  ASSERT_TRUE(local.js->load_plugin({plugin, true}));
+  EXPECT_EQ(initial_entries + 1, shcore::listdir(cache_dir).size());
+
+  {
+    Environment other;
+    EXPECT_EQ(2, other.js->execute("1+1").first.as_int());
+  }
+
+  // least recently used entries are removed once there are too many of them
+  const auto recent_entries = shcore::listdir(cache_dir);
+  // maximum number of entries in the cache
+  constexpr std::size_t k_max_entries = 256;
+  const auto an_hour_ago =
+      std::filesystem::file_time_type::clock::now() - std::chrono::hours(1);
+
+  for (std::size_t i = 0; i < k_max_entries; ++i) {
+    const auto entry =
+        shcore::path::join_path(cache_dir, "old_" + std::to_string(i) + ".bin");
+    shcore::create_file(entry, "old");
+    std::filesystem::last_write_time(entry, an_hour_ago);
+  }
+
+  shcore::create_file(plugin, "var value = 'second';\n");
+  ASSERT_TRUE(local.js->load_plugin({plugin, true}));
+
+  EXPECT_EQ(k_max_entries, shcore::listdir(cache_dir).size());
+
+  for (const auto &entry : recent_entries) {
+    EXPECT_TRUE(shcore::is_file(shcore::path::join_path(cache_dir, entry)))
+        << entry;
+  }
+}
 }  // namespace tests
 }  // namespace shcore